@@ -0,0 +1,61 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using BenchmarkDotNet.Attributes;
+using CSharp.Core;
+using Speculator.Core;
+using Speculator.Core.Tape;
+
+namespace Benchmarks;
+
+/// <summary>
+/// Storing and retrieving machine snapshots, as the rollback history does.
+/// </summary>
+[MemoryDiagnoser]
+public class CompressedDataStoreBenchmarks
+{
+    /// <summary>
+    /// As held by the CPU history.
+    /// </summary>
+    private const int SnapshotCount = 240;
+
+    private readonly CompressedDataStore<long> m_store = new CompressedDataStore<long>();
+    private byte[] m_snapshot;
+    private long m_nextKey;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var cpu = new CPU(new Memory());
+        var zxFileIo = new ZxFileIo(cpu, null, new TapeLoader());
+        zxFileIo.LoadFile(TestData.GameSnapshot);
+        using var stream = new MemoryStream();
+        zxFileIo.WriteSnaToStream(stream);
+        m_snapshot = stream.ToArray();
+
+        while (m_nextKey < SnapshotCount)
+            m_store.Add(m_nextKey++, m_snapshot);
+    }
+
+    /// <summary>
+    /// Add a snapshot, dropping the oldest.
+    /// </summary>
+    [Benchmark]
+    public void Add()
+    {
+        m_store.Add(m_nextKey++, m_snapshot);
+        m_store.RemoveAt(0);
+    }
+
+    [Benchmark]
+    public byte[] Get() =>
+        m_store.Get(m_nextKey - SnapshotCount / 2);
+}
@@ -0,0 +1,72 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using BenchmarkDotNet.Attributes;
+using CSharp.Core.Extensions;
+using Speculator.Core;
+
+namespace Benchmarks;
+
+/// <summary>
+/// Instruction throughput, reported per instruction (Or per frame).
+/// </summary>
+[MemoryDiagnoser]
+public class CpuBenchmarks
+{
+    private const int StepCount = 100_000;
+    private CPU m_zexCpu;
+    private HeadlessZxSpectrum m_gameMachine;
+
+    [GlobalSetup(Target = nameof(StepZexAll))]
+    public void SetupZexAll()
+    {
+        m_zexCpu = new CPU(new Memory())
+        {
+            TheRegisters =
+            {
+                PC = 0x0100,
+                SP = 0xF000
+            }
+        };
+        m_zexCpu.MainMemory.LoadData(TestData.ZexAll.ReadAllBytes(), 0x0100);
+
+        // Return immediately from CP/M BDOS calls (Console output) and the frame interrupt.
+        m_zexCpu.MainMemory.Data[0x0005] = 0xC9; // RET
+        m_zexCpu.MainMemory.Data[0x0038] = 0xFB; // EI
+        m_zexCpu.MainMemory.Data[0x0039] = 0xC9; // RET
+    }
+
+    [GlobalSetup(Targets = new[] { nameof(StepGame), nameof(RunGameFrame) })]
+    public void SetupGame() =>
+        m_gameMachine = TestData.CreateGameMachine();
+
+    [Benchmark(OperationsPerInvoke = StepCount)]
+    public void StepZexAll()
+    {
+        for (var i = 0; i < StepCount; i++)
+            m_zexCpu.Step();
+    }
+
+    [Benchmark(OperationsPerInvoke = StepCount)]
+    public void StepGame()
+    {
+        var cpu = m_gameMachine.TheCpu;
+        for (var i = 0; i < StepCount; i++)
+            cpu.Step();
+    }
+
+    /// <summary>
+    /// A 1/50th second frame, run using StepToNextEvent() as the UI does.
+    /// </summary>
+    [Benchmark]
+    public void RunGameFrame() =>
+        m_gameMachine.RunFrames(1);
+}
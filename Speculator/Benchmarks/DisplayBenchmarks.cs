@@ -0,0 +1,97 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using Avalonia;
+using Avalonia.Headless;
+using BenchmarkDotNet.Attributes;
+using Speculator.Core;
+
+namespace Benchmarks;
+
+/// <summary>
+/// Building the screen from memory, and converting it into the UI bitmap.
+/// </summary>
+[MemoryDiagnoser]
+public class DisplayBenchmarks
+{
+    private const int ScanlinesPerFrame = 312;
+    private readonly byte[] m_screenBuffer = ZxDisplay.CreateScreenBuffer();
+    private Memory m_memory;
+    private ZxDisplay m_crtDisplay;
+    private ZxDisplay m_flatDisplay;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // Bitmaps need a rendering platform, so use Avalonia's headless one.
+        AppBuilder.Configure<Application>()
+            .UseSkia()
+            .UseHeadless(new AvaloniaHeadlessPlatformOptions { UseHeadlessDrawing = false })
+            .SetupWithoutStarting();
+
+        m_memory = TestData.CreateGameMachine().TheCpu.MainMemory;
+        m_crtDisplay = CreateDisplay(true);
+        m_flatDisplay = CreateDisplay(false);
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        m_crtDisplay.Dispose();
+        m_flatDisplay.Dispose();
+    }
+
+    private ZxDisplay CreateDisplay(bool isCrt)
+    {
+        var display = new ZxDisplay { IsCrt = isCrt };
+        for (var i = 0; i < ScanlinesPerFrame; i++)
+            display.OnRenderScanline(this, (m_memory, i));
+        return display;
+    }
+
+    /// <summary>
+    /// Every scanline of a frame, into a buffer already holding the same frame.
+    /// Incremental rendering only draws cells written since the last frame (None, for a static screen).
+    /// Reported per scanline.
+    /// </summary>
+    [Benchmark(OperationsPerInvoke = ScanlinesPerFrame)]
+    [Arguments(false)]
+    [Arguments(true)]
+    public bool RenderScanlineIntoBuffer(bool isIncremental)
+    {
+        var didPixelsChange = false;
+        for (var i = 0; i < ScanlinesPerFrame; i++)
+            ZxDisplay.RenderScanlineIntoBuffer(m_memory, i, m_screenBuffer, 0x00, false, isIncremental, ref didPixelsChange);
+        return didPixelsChange;
+    }
+
+    [Benchmark]
+    public void UpdateScreenCrt() =>
+        m_crtDisplay.UpdateScreen();
+
+    [Benchmark]
+    public void UpdateScreenFlat() =>
+        m_flatDisplay.UpdateScreen();
+
+    /// <summary>
+    /// Frame latency of the CRT pass, against the number of bands shaded in parallel.
+    /// </summary>
+    [Benchmark]
+    [Arguments(1)]
+    [Arguments(2)]
+    [Arguments(4)]
+    [Arguments(8)]
+    public void UpdateScreenCrtBands(int bandCount)
+    {
+        m_crtDisplay.BandCount = bandCount;
+        m_crtDisplay.UpdateScreen();
+    }
+}
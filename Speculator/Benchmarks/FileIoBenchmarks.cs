@@ -0,0 +1,127 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using BenchmarkDotNet.Attributes;
+using CSharp.Core;
+using Speculator.Core;
+using Speculator.Core.Tape;
+
+namespace Benchmarks;
+
+/// <summary>
+/// Loading and saving snapshots.
+/// </summary>
+[MemoryDiagnoser]
+public class FileIoBenchmarks
+{
+    private readonly MemoryStream m_snaStream = new MemoryStream(49179);
+    private CPU m_cpu;
+    private ZxFileIo m_zxFileIo;
+    private TempFile m_z80File;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        m_cpu = new CPU(new Memory());
+        m_zxFileIo = new ZxFileIo(m_cpu, null, new TapeLoader());
+        m_zxFileIo.LoadFile(TestData.GameSnapshot);
+
+        m_z80File = new TempFile(".z80");
+        WriteZ80(m_cpu, m_z80File);
+    }
+
+    [GlobalCleanup]
+    public void Cleanup() =>
+        m_z80File.Dispose();
+
+    [Benchmark]
+    public void LoadSna() =>
+        m_zxFileIo.LoadFile(TestData.GameSnapshot);
+
+    [Benchmark]
+    public long SaveSna()
+    {
+        m_snaStream.SetLength(0);
+        m_zxFileIo.WriteSnaToStream(m_snaStream);
+        return m_snaStream.Length;
+    }
+
+    /// <summary>
+    /// A compressed version 1 file, the same machine state as the .sna.
+    /// </summary>
+    /// <remarks>
+    /// There is no .z80 save benchmark, as ZxFileIo only saves .sna files.
+    /// </remarks>
+    [Benchmark]
+    public void LoadZ80() =>
+        m_zxFileIo.LoadFile(m_z80File);
+
+    /// <summary>
+    /// Write the machine state as a compressed version 1 .z80 file.
+    /// </summary>
+    private static void WriteZ80(CPU cpu, FileInfo file)
+    {
+        var registers = cpu.TheRegisters;
+        using var stream = file.Create();
+        stream.WriteByte(registers.Main.A);
+        stream.WriteByte(registers.Main.F);
+        WriteWord(stream, registers.Main.BC);
+        WriteWord(stream, registers.Main.HL);
+        WriteWord(stream, registers.PC);
+        WriteWord(stream, registers.SP);
+        stream.WriteByte(registers.I);
+        stream.WriteByte((byte)(registers.R & 0x7F));
+        stream.WriteByte((byte)(registers.R >> 7 | 0x20)); // R bit 7, black border, compressed.
+        WriteWord(stream, registers.Main.DE);
+        WriteWord(stream, registers.Alt.BC);
+        WriteWord(stream, registers.Alt.DE);
+        WriteWord(stream, registers.Alt.HL);
+        stream.WriteByte(registers.Alt.A);
+        stream.WriteByte(registers.Alt.F);
+        WriteWord(stream, registers.IY);
+        WriteWord(stream, registers.IX);
+        stream.WriteByte((byte)(registers.IFF1 ? 1 : 0));
+        stream.WriteByte((byte)(registers.IFF2 ? 1 : 0));
+        stream.WriteByte(registers.IM);
+
+        // Runs of 5+ bytes (Or 2+ EDs) become 'ED ED count byte'. A byte following a single ED is never compressed.
+        var data = cpu.MainMemory.Data[..0x10000]; // The 48K memory map.
+        var i = 0x4000;
+        while (i < data.Length)
+        {
+            var b = data[i];
+            var runLength = 1;
+            while (i + runLength < data.Length && data[i + runLength] == b && runLength < 255)
+                runLength++;
+
+            if (runLength >= 5 || (b == 0xED && runLength >= 2))
+            {
+                stream.Write(new byte[] { 0xED, 0xED, (byte)runLength, b });
+                i += runLength;
+                continue;
+            }
+
+            stream.WriteByte(b);
+            i++;
+            if (b == 0xED && i < data.Length)
+                stream.WriteByte(data[i++]);
+        }
+
+        // End marker.
+        stream.Write(new byte[] { 0x00, 0xED, 0xED, 0x00 });
+    }
+
+    private static void WriteWord(Stream stream, ushort n)
+    {
+        stream.WriteByte((byte)(n & 0xFF));
+        stream.WriteByte((byte)(n >> 8));
+    }
+}
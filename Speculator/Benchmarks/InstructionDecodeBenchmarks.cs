@@ -0,0 +1,57 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using BenchmarkDotNet.Attributes;
+using Speculator.Core;
+
+namespace Benchmarks;
+
+/// <summary>
+/// Decoding every opcode on each prefix page, bypassing the <see cref="InstructionCache"/>.
+/// Reported per instruction.
+/// </summary>
+public class InstructionDecodeBenchmarks
+{
+    private const int OpcodeCount = 256;
+    private const ushort BaseAddr = 0x8000;
+    private const int BytesPerSlot = 8;
+    private readonly Z80Instructions m_instructionSet = new Z80Instructions();
+    private readonly Memory m_memory = new Memory();
+
+    [Params("", "CB", "DD", "ED", "FD", "DDCB", "FDCB")]
+    public string Prefix { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var prefixBytes = Convert.FromHexString(Prefix);
+        var isIndexedBitOp = prefixBytes.Length == 2;
+        for (var opcode = 0; opcode < OpcodeCount; opcode++)
+        {
+            var addr = BaseAddr + opcode * BytesPerSlot;
+            prefixBytes.CopyTo(m_memory.Data, addr);
+            addr += prefixBytes.Length;
+
+            // DDCB/FDCB instructions have their displacement before the opcode.
+            var instructionBytes = isIndexedBitOp ? new byte[] { 0x05, (byte)opcode } : new byte[] { (byte)opcode, 0x12, 0x34 };
+            instructionBytes.CopyTo(m_memory.Data, addr);
+        }
+    }
+
+    [Benchmark(OperationsPerInvoke = OpcodeCount)]
+    public int FindInstructionAtMemoryLocation()
+    {
+        var byteCount = 0;
+        for (var opcode = 0; opcode < OpcodeCount; opcode++)
+            byteCount += m_instructionSet.FindInstructionAtMemoryLocation(m_memory, (ushort)(BaseAddr + opcode * BytesPerSlot))?.ByteCount ?? 0;
+        return byteCount;
+    }
+}
@@ -0,0 +1,36 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Exporters.Csv;
+using BenchmarkDotNet.Exporters.Json;
+using BenchmarkDotNet.Running;
+
+namespace Benchmarks;
+
+/// <summary>
+/// Benchmarks for the emulator's hot paths.
+/// </summary>
+/// <remarks>
+/// Usage: Benchmarks [--filter *Cpu*] (Any BenchmarkDotNet arguments)
+/// Results are written as JSON and CSV to BenchmarkDotNet.Artifacts/results, to compare between releases.
+/// </remarks>
+internal static class Program
+{
+    private static void Main(string[] args)
+    {
+        var config =
+            DefaultConfig.Instance
+                .AddExporter(JsonExporter.Full)
+                .AddExporter(CsvExporter.Default);
+        BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args, config);
+    }
+}
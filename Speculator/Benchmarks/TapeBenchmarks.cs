@@ -0,0 +1,66 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using BenchmarkDotNet.Attributes;
+using Speculator.Core.Tape;
+
+namespace Benchmarks;
+
+/// <summary>
+/// Starting a tape block, and sampling the tape signal from it.
+/// </summary>
+[MemoryDiagnoser]
+public class TapeBenchmarks
+{
+    private const int SampleCount = 10_000;
+    private const int TStatesPerSample = 10_000;
+    private readonly byte[] m_blockBytes = CreateScreenDataBlock();
+    private TapeBlock m_startedBlock;
+
+    [GlobalSetup]
+    public void Setup() =>
+        m_startedBlock = new TapeBlock(m_blockBytes, 0, m_blockBytes.Length).Start(0);
+
+    /// <summary>
+    /// A data block as saved by SAVE "" SCREEN$ (Flag, 6912 bytes and checksum).
+    /// </summary>
+    private static byte[] CreateScreenDataBlock()
+    {
+        var blockBytes = new byte[1 + 6912 + 1];
+        blockBytes[0] = 0xFF;
+        new Random(0).NextBytes(blockBytes.AsSpan(1, 6912));
+        blockBytes[^1] = blockBytes[..^1].Aggregate((a, b) => (byte)(a ^ b));
+        return blockBytes;
+    }
+
+    /// <summary>
+    /// Includes the 'Loading tape block' log message, as the emulator sees it.
+    /// </summary>
+    [Benchmark]
+    public TapeBlock Start() =>
+        new TapeBlock(m_blockBytes, 0, m_blockBytes.Length).Start(0);
+
+    /// <summary>
+    /// Samples spread through the pilot tone and data, reported per sample.
+    /// </summary>
+    [Benchmark(OperationsPerInvoke = SampleCount)]
+    public int GetSignal()
+    {
+        var highCount = 0;
+        for (var i = 0; i < SampleCount; i++)
+        {
+            if (m_startedBlock.GetSignal((long)i * TStatesPerSample) == true)
+                highCount++;
+        }
+
+        return highCount;
+    }
+}
@@ -0,0 +1,38 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using System.Reflection;
+using CSharp.Core.Extensions;
+using Speculator.Core;
+
+namespace Benchmarks;
+
+/// <summary>
+/// Files shared by the benchmarks, copied alongside the assembly.
+/// </summary>
+internal static class TestData
+{
+    private static DirectoryInfo Dir => Assembly.GetExecutingAssembly().GetDirectory().GetDir("TestData");
+
+    public static FileInfo SystemRom => Dir.GetFile("Standard Spectrum 48K BASIC.rom");
+    public static FileInfo ZexAll => Dir.GetFile("zexall.com");
+    public static FileInfo GameSnapshot => Dir.GetFile("HumanShader.sna");
+
+    /// <summary>
+    /// A 48K machine running the game snapshot.
+    /// </summary>
+    public static HeadlessZxSpectrum CreateGameMachine()
+    {
+        var machine = new HeadlessZxSpectrum(SystemRom);
+        machine.LoadFile(GameSnapshot);
+        return machine;
+    }
+}
@@ -9,6 +9,8 @@
 //
 // THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
 
+using System.Runtime.CompilerServices;
+
 namespace Speculator.Core;
 
 public class Alu
@@ -272,13 +274,90 @@ public class Alu
             0x9283,0x9387,0x9483,0x9587,0x9687,0x9783,0x988B,0x998F
         };
     
+    /// <summary>
+    /// ALU operations whose flags can be recorded now and computed when F is next read.
+    /// </summary>
+    internal enum DeferredOp { None, Add, Subtract, Compare, Inc, Dec, And, Or, Xor }
+
     public Registers TheRegisters { get; }
 
+    /// <summary>
+    /// When set, 8-bit arithmetic and logic ops record their operands rather than updating F,
+    /// which is only computed if something reads it before the next flag-setting op.
+    /// </summary>
+    public bool LazyFlags { get; set; } = true;
+
+    /// <summary>
+    /// S, Z, 5, 3 and P flags for each byte value.
+    /// </summary>
+    private static readonly byte[] Sz53pTable = new byte[0x100];
+
+    /// <summary>
+    /// Full F results, indexed by carry-in (bit 16), a (bits 8-15) and b (bits 0-7).
+    /// </summary>
+    private static readonly byte[] AddFlagsTable = new byte[0x20000];
+    private static readonly byte[] SubtractFlagsTable = new byte[0x20000];
+    private static readonly byte[] CompareFlagsTable = new byte[0x10000];
+
+    /// <summary>
+    /// INC/DEC results (excluding the preserved carry), indexed by the original value.
+    /// </summary>
+    private static readonly byte[] IncFlagsTable = new byte[0x100];
+    private static readonly byte[] DecFlagsTable = new byte[0x100];
+
+    /// <summary>
+    /// BIT n results (excluding the preserved carry), indexed by bit number (bits 8-10) and value.
+    /// </summary>
+    private static readonly byte[] BitTestFlagsTable = new byte[0x800];
+
+    static Alu()
+    {
+        for (var i = 0; i < 0x100; i++)
+        {
+            var b = (byte)i;
+            Sz53pTable[i] = CalculateFlags(DeferredOp.Or, 0x00, b, b, false);
+            IncFlagsTable[i] = CalculateFlags(DeferredOp.Inc, b, 0x01, b + 1, false);
+            DecFlagsTable[i] = CalculateFlags(DeferredOp.Dec, b, 0x01, b - 1, false);
+
+            for (var bit = 0; bit < 8; bit++)
+            {
+                // From 'undocumented' docs: P mirrors Z, S is only set when testing bit 7, 5/3 come from the operand.
+                var isClear = (b & (1 << bit)) == 0;
+                BitTestFlagsTable[bit << 8 | i] = (byte)(0x10 | (b & 0x28) | (isClear ? 0x44 : 0x00) | (bit == 7 && !isClear ? 0x80 : 0x00));
+            }
+        }
+
+        for (var i = 0; i < 0x20000; i++)
+        {
+            var carry = i >= 0x10000;
+            var a = (byte)(i >> 8);
+            var b = (byte)i;
+            AddFlagsTable[i] = CalculateFlags(DeferredOp.Add, a, b, a + b + (carry ? 1 : 0), carry);
+            SubtractFlagsTable[i] = CalculateFlags(DeferredOp.Subtract, a, b, a - b - (carry ? 1 : 0), carry);
+            if (!carry)
+                CompareFlagsTable[i] = CalculateFlags(DeferredOp.Compare, a, b, a - b, false);
+        }
+    }
+
     internal Alu(Registers theRegisters)
     {
         TheRegisters = theRegisters;
     }
 
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static int FlagsIndex(byte a, byte b, bool carry) =>
+        (carry ? 0x10000 : 0) | a << 8 | b;
+
+    /// <summary>
+    /// The S, Z, 5, 3 and P flags for a byte value, with H, N and C reset.
+    /// </summary>
+    internal static byte GetSz53p(byte b) => Sz53pTable[b];
+
+    /// <summary>
+    /// The F register after BIT n,b, excluding the carry flag (which BIT preserves).
+    /// </summary>
+    internal static byte GetBitTestFlags(byte b, byte bit) => BitTestFlagsTable[bit << 8 | b];
+
     internal byte SubtractAndSetFlags(byte a, byte b, bool subCarryFlag)
     {
         int v = a;
@@ -288,18 +367,30 @@ public class Alu
         if (needCarry)
             v--;
 
-        var result = (byte) (v & 0xff);
+        if (LazyFlags)
+        {
+            TheRegisters.Main.DeferFlags(DeferredOp.Subtract, a, b, v, needCarry);
+            return (byte)v;
+        }
 
-        TheRegisters.HalfCarryFlag = IsHalfCarry8(a, b, needCarry, false);
-        TheRegisters.CarryFlag = IsCarry8(v);
-        TheRegisters.SignFlag = !IsBytePositive(result);
-        TheRegisters.ZeroFlag = v == 0;
-        TheRegisters.ParityFlag = IsOverflow8(a, b, result, false);
-        TheRegisters.SubtractFlag = true;
-        TheRegisters.SetFlags53From((byte)v);
+        TheRegisters.Main.F = SubtractFlagsTable[FlagsIndex(a, b, needCarry)];
         return (byte)v;
     }
 
+    /// <summary>
+    /// Compare b against a (CP), leaving flags 5 and 3 from the operand.
+    /// </summary>
+    internal void Compare(byte a, byte b)
+    {
+        if (LazyFlags)
+        {
+            TheRegisters.Main.DeferFlags(DeferredOp.Compare, a, b, a - b, false);
+            return;
+        }
+
+        TheRegisters.Main.F = CompareFlagsTable[FlagsIndex(a, b, false)];
+    }
+
     internal ushort SubtractAndSetFlags(int a, int b, bool subCarryFlag)
     {
         var v = a - b;
@@ -329,15 +420,13 @@ public class Alu
             v++;
 
         var result = (byte)v;
+        if (LazyFlags)
+        {
+            TheRegisters.Main.DeferFlags(DeferredOp.Add, a, b, v, needCarry);
+            return result;
+        }
 
-        TheRegisters.SignFlag = !IsBytePositive(result);
-        TheRegisters.ZeroFlag = result == 0;
-        TheRegisters.ParityFlag = IsOverflow8(a, b, result, true);
-        TheRegisters.HalfCarryFlag = IsHalfCarry8(a, b, needCarry, true);
-        TheRegisters.CarryFlag = IsCarry8(v);
-        TheRegisters.SubtractFlag = false;
-        TheRegisters.SetFlags53From(result);
-
+        TheRegisters.Main.F = AddFlagsTable[FlagsIndex(a, b, needCarry)];
         return result;
     }
 
@@ -382,43 +471,40 @@ public class Alu
     {
         int v = b;
         v -= 0x01;
+        if (LazyFlags)
+        {
+            TheRegisters.Main.DeferFlags(DeferredOp.Dec, b, 0x01, v, TheRegisters.CarryFlag);
+            return (byte)v;
+        }
 
-        var result1 = (byte) (v & 0xff);
-        TheRegisters.HalfCarryFlag = IsHalfCarry8(b, 0x01, false, false);
-        TheRegisters.SignFlag = !IsBytePositive(result1);
-        TheRegisters.ZeroFlag = (byte)v == 0;
-        TheRegisters.SubtractFlag = true;
-        var result = (byte)v;
-        TheRegisters.ParityFlag = b == 0x80;
-        TheRegisters.SetFlags53From(result);
-        return result;
+        TheRegisters.Main.F = (byte)(DecFlagsTable[b] | (TheRegisters.Main.F & 0x01));
+        return (byte)v;
     }
 
     public byte IncAndSetFlags(byte b)
     {
         int v = b;
         v += 0x01;
-        TheRegisters.HalfCarryFlag = IsHalfCarry8(b, 0x01, false, true);
-        TheRegisters.SignFlag = !IsBytePositive((byte)v);
-        TheRegisters.ZeroFlag = (byte)v == 0;
-        TheRegisters.SubtractFlag = false;
-        TheRegisters.ParityFlag = b == 0x7F;
-        TheRegisters.SetFlags53From((byte)v);
-        
+        if (LazyFlags)
+        {
+            TheRegisters.Main.DeferFlags(DeferredOp.Inc, b, 0x01, v, TheRegisters.CarryFlag);
+            return (byte)v;
+        }
+
+        TheRegisters.Main.F = (byte)(IncFlagsTable[b] | (TheRegisters.Main.F & 0x01));
         return (byte)v;
     }
 
     public void And(byte b)
     {
         var r = (byte) (TheRegisters.Main.A & b);
-        TheRegisters.SignFlag = !IsBytePositive(r);
-        TheRegisters.ZeroFlag = r == 0;
-        TheRegisters.HalfCarryFlag = true;
-        TheRegisters.ParityFlag = IsEvenParity(r);
-        TheRegisters.SubtractFlag = false;
-        TheRegisters.CarryFlag = false;
-        TheRegisters.SetFlags53From(r);
-
+        if (LazyFlags)
+        {
+            TheRegisters.Main.DeferFlags(DeferredOp.And, TheRegisters.Main.A, b, r, false);
+            TheRegisters.Main.A = r;
+            return;
+        }
+        TheRegisters.Main.F = (byte)(Sz53pTable[r] | 0x10);
         TheRegisters.Main.A = r;
     }
 
@@ -434,33 +520,34 @@ public class Alu
     }
 
     internal static bool IsEvenParity(byte b) =>
-        (CountBits(b) & 1) == 0;
+        (Sz53pTable[b] & 0x04) != 0;
 
     public void Or(byte b)
     {
         var r = (byte)(TheRegisters.Main.A | b);
-        TheRegisters.SignFlag = !IsBytePositive(r);
-        TheRegisters.ZeroFlag = r == 0;
-        TheRegisters.HalfCarryFlag = false;
-        TheRegisters.ParityFlag = IsEvenParity(r);
-        TheRegisters.SubtractFlag = false;
-        TheRegisters.CarryFlag = false;
-        TheRegisters.Main.A = r;
+        if (LazyFlags)
+        {
+            TheRegisters.Main.DeferFlags(DeferredOp.Or, TheRegisters.Main.A, b, r, false);
+            TheRegisters.Main.A = r;
+            return;
+        }
 
-        TheRegisters.SetFlags53From(r);
+        TheRegisters.Main.F = Sz53pTable[r];
+        TheRegisters.Main.A = r;
     }
 
     public void Xor(byte b)
     {
         var r = (byte)(TheRegisters.Main.A ^ b);
-        TheRegisters.SignFlag = !IsBytePositive(r);
-        TheRegisters.ZeroFlag = r == 0;
-        TheRegisters.HalfCarryFlag = false;
-        TheRegisters.ParityFlag = IsEvenParity(r);
-        TheRegisters.SubtractFlag = false;
-        TheRegisters.CarryFlag = false;
+        if (LazyFlags)
+        {
+            TheRegisters.Main.DeferFlags(DeferredOp.Xor, TheRegisters.Main.A, b, r, false);
+            TheRegisters.Main.A = r;
+            return;
+        }
+
+        TheRegisters.Main.F = Sz53pTable[r];
         TheRegisters.Main.A = r;
-        TheRegisters.SetFlags53From(r);
     }
 
     public void AdjustAccumulatorToBcd()
@@ -616,6 +703,68 @@ public class Alu
         return b;
     }
 
+    /// <summary>
+    /// Compute the F register for an operation recorded by <see cref="LazyFlags"/>.
+    /// </summary>
+    internal static byte ComputeDeferredFlags(DeferredOp op, byte a, byte b, int v, bool carry) =>
+        op switch
+        {
+            DeferredOp.Add => AddFlagsTable[FlagsIndex(a, b, carry)],
+            DeferredOp.Subtract => SubtractFlagsTable[FlagsIndex(a, b, carry)],
+            DeferredOp.Compare => CompareFlagsTable[FlagsIndex(a, b, false)],
+            DeferredOp.Inc => (byte)(IncFlagsTable[a] | (carry ? 0x01 : 0x00)),
+            DeferredOp.Dec => (byte)(DecFlagsTable[a] | (carry ? 0x01 : 0x00)),
+            DeferredOp.And => (byte)(Sz53pTable[(byte)v] | 0x10),
+            _ => Sz53pTable[(byte)v]
+        };
+
+    /// <summary>
+    /// Derive the F register bit by bit, as used to build the lookup tables.
+    /// </summary>
+    internal static byte CalculateFlags(DeferredOp op, byte a, byte b, int v, bool carry)
+    {
+        var result = (byte)v;
+        var f = (result & 0xA8) | (result == 0 ? 0x40 : 0x00);
+        switch (op)
+        {
+            case DeferredOp.Add:
+                if (IsOverflow8(a, b, result, true)) f |= 0x04;
+                if (IsHalfCarry8(a, b, carry, true)) f |= 0x10;
+                if (IsCarry8(v)) f |= 0x01;
+                break;
+            case DeferredOp.Subtract:
+            case DeferredOp.Compare:
+                f |= 0x02;
+                if (IsOverflow8(a, b, result, false)) f |= 0x04;
+                if (IsHalfCarry8(a, b, carry, false)) f |= 0x10;
+                if (IsCarry8(v)) f |= 0x01;
+                if (op == DeferredOp.Compare)
+                    f = (f & ~0x28) | (b & 0x28);
+                break;
+            case DeferredOp.Inc:
+                if (a == 0x7F) f |= 0x04;
+                if (IsHalfCarry8(a, 0x01, false, true)) f |= 0x10;
+                if (carry) f |= 0x01;
+                break;
+            case DeferredOp.Dec:
+                f |= 0x02;
+                if (a == 0x80) f |= 0x04;
+                if (IsHalfCarry8(a, 0x01, false, false)) f |= 0x10;
+                if (carry) f |= 0x01;
+                break;
+            case DeferredOp.And:
+                f |= 0x10;
+                if ((CountBits(result) & 1) == 0) f |= 0x04;
+                break;
+            case DeferredOp.Or:
+            case DeferredOp.Xor:
+                if ((CountBits(result) & 1) == 0) f |= 0x04;
+                break;
+        }
+
+        return (byte)f;
+    }
+
     private static bool IsOverflow16(ushort a, ushort b, ushort result, bool isAddition)
     {
         var signA = a >> 15 != 0;
@@ -0,0 +1,173 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+namespace Speculator.Core;
+
+/// <summary>
+/// Turns T-state stamped speaker level changes into band-limited 16-bit samples.
+/// </summary>
+/// <remarks>
+/// Each edge is added as a band-limited step (BLEP): a windowed-sinc impulse, chosen from a table of
+/// sub-sample phases, is accumulated into a buffer of level deltas, which is integrated into samples
+/// once per frame. This avoids the aliasing of point-sampling the speaker, without oversampling.
+/// A DC blocker re-centres the output, as the speaker's levels are all positive.
+/// </remarks>
+internal sealed class BeeperSynth
+{
+    private const int BlepWidth = 16;
+    private const int BlepPhases = 64;
+    private const double BlepCutoff = 0.9;
+    private const int MaxEdgeCount = 8192;
+    private const float LevelAmplitude = 8192.0f;
+    private const float DcBlockerPole = 0.995f;
+
+    private static readonly float[][] BlepKernel = CreateBlepKernel();
+
+    private readonly double m_samplesPerTState;
+    private readonly long[] m_edgeTStates = new long[MaxEdgeCount];
+    private readonly float[] m_edgeDeltas = new float[MaxEdgeCount];
+    private readonly float[] m_deltas;
+    private readonly short[] m_samples;
+    private int m_edgeCount;
+    private byte m_level;
+    private double m_startTStates;
+    private float m_amplitude;
+    private float m_dcInput;
+    private float m_dcOutput;
+
+    /// <param name="sampleHz">The output sample rate.</param>
+    public BeeperSynth(int sampleHz)
+    {
+        m_samplesPerTState = sampleHz / CPU.TStatesPerSecond;
+
+        // Room for a couple of frames, plus the tail of steps near the end.
+        m_samples = new short[(int)(2 * CPU.TStatesPerInterrupt * m_samplesPerTState)];
+        m_deltas = new float[m_samples.Length + BlepWidth];
+    }
+
+    /// <summary>
+    /// Record a speaker level (0 - 3) set at the given time.
+    /// </summary>
+    public void AddEdge(long tStates, byte level)
+    {
+        if (level == m_level)
+            return;
+        var delta = (level - m_level) * LevelAmplitude;
+        m_level = level;
+
+        // If there are too many edges to hold, merge into the last so the level stays correct.
+        if (m_edgeCount == MaxEdgeCount)
+        {
+            m_edgeDeltas[m_edgeCount - 1] += delta;
+            return;
+        }
+
+        m_edgeTStates[m_edgeCount] = tStates;
+        m_edgeDeltas[m_edgeCount] = delta;
+        m_edgeCount++;
+    }
+
+    /// <summary>
+    /// Synthesise the samples up to the given time.
+    /// </summary>
+    /// <returns>The new samples, valid until the next call.</returns>
+    public ReadOnlySpan<short> EndFrame(long tStates)
+    {
+        var sampleCount = (int)((tStates - m_startTStates) * m_samplesPerTState);
+        if (sampleCount < 0 || sampleCount > m_samples.Length)
+        {
+            // The CPU clock was reset, or has jumped - Restart from here.
+            Restart(tStates);
+            return ReadOnlySpan<short>.Empty;
+        }
+
+        // Add the edges covered by these samples. Any others are left for the next frame.
+        var endTStates = m_startTStates + sampleCount / m_samplesPerTState;
+        var edgeCount = 0;
+        while (edgeCount < m_edgeCount && m_edgeTStates[edgeCount] < endTStates)
+        {
+            AddStep(Math.Max(0.0, (m_edgeTStates[edgeCount] - m_startTStates) * m_samplesPerTState), m_edgeDeltas[edgeCount]);
+            edgeCount++;
+        }
+
+        m_edgeCount -= edgeCount;
+        Array.Copy(m_edgeTStates, edgeCount, m_edgeTStates, 0, m_edgeCount);
+        Array.Copy(m_edgeDeltas, edgeCount, m_edgeDeltas, 0, m_edgeCount);
+
+        // Integrate the deltas into samples.
+        for (var i = 0; i < sampleCount; i++)
+        {
+            m_amplitude += m_deltas[i];
+            var output = m_amplitude - m_dcInput + DcBlockerPole * m_dcOutput;
+            m_dcInput = m_amplitude;
+            m_dcOutput = output;
+            m_samples[i] = (short)Math.Clamp(output, short.MinValue, short.MaxValue);
+        }
+
+        // Keep the tails of steps which extend beyond these samples.
+        m_deltas.AsSpan(sampleCount, BlepWidth).CopyTo(m_deltas);
+        m_deltas.AsSpan(BlepWidth, sampleCount).Clear();
+
+        m_startTStates = endTStates;
+        return m_samples.AsSpan(0, sampleCount);
+    }
+
+    private void AddStep(double position, float delta)
+    {
+        var index = (int)position;
+        var kernel = BlepKernel[(int)((position - index) * BlepPhases)];
+        var deltas = m_deltas.AsSpan(index, BlepWidth);
+        for (var i = 0; i < BlepWidth; i++)
+            deltas[i] += delta * kernel[i];
+    }
+
+    /// <summary>
+    /// Apply everything pending immediately, and start synthesising from the given time.
+    /// </summary>
+    public void Restart(long tStates)
+    {
+        for (var i = 0; i < m_edgeCount; i++)
+            m_amplitude += m_edgeDeltas[i];
+        foreach (var delta in m_deltas)
+            m_amplitude += delta;
+        Array.Clear(m_deltas);
+        m_edgeCount = 0;
+        m_startTStates = tStates;
+    }
+
+    /// <summary>
+    /// A Blackman-windowed sinc impulse for each sub-sample phase, each summing to one so that
+    /// integrating it gives a unit step.
+    /// </summary>
+    private static float[][] CreateBlepKernel()
+    {
+        const double halfWidth = BlepWidth / 2;
+        var kernel = new float[BlepPhases][];
+        var taps = new double[BlepWidth];
+        for (var phase = 0; phase < BlepPhases; phase++)
+        {
+            var sum = 0.0;
+            for (var i = 0; i < BlepWidth; i++)
+            {
+                // Distance (In samples) from the step.
+                var x = i - (halfWidth - 1) - (double)phase / BlepPhases;
+                var sinc = x == 0.0 ? 1.0 : Math.Sin(Math.PI * BlepCutoff * x) / (Math.PI * BlepCutoff * x);
+                var window = 0.42 + 0.5 * Math.Cos(Math.PI * x / halfWidth) + 0.08 * Math.Cos(2.0 * Math.PI * x / halfWidth);
+                taps[i] = sinc * window;
+                sum += taps[i];
+            }
+
+            kernel[phase] = taps.Select(o => (float)(o / sum)).ToArray();
+        }
+
+        return kernel;
+    }
+}
@@ -0,0 +1,659 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.CompilerServices;
+
+namespace Speculator.Core;
+
+/// <summary>
+/// Compiles straight-line runs of Z80 instructions (basic blocks) into .NET methods,
+/// cached by their start address.
+/// </summary>
+/// <remarks>
+/// A block runs from its start address up to (but not including) the first instruction which
+/// can change the flow of control, or affect interrupts (JP, CALL, RET, EI, HALT, LDIR, etc),
+/// so its T-state count is known up front. A block only runs if it completes before the next
+/// event, leaving the interpreter to single-step up to the event itself.
+/// Common loads, stores and 8-bit ALU ops are emitted directly as IL over the registers and memory,
+/// skipping the flags of any ALU op whose flags are overwritten before they can be read. Everything
+/// else calls the interpreter's handler from the generated opcode tables. T-state and R register updates are
+/// batched, but brought up to date before any instruction which can observe them (IN, OUT, LD A,R),
+/// or write to memory (So display writes are logged at the right time).
+/// Memory writes to any byte of a compiled block evict it, including writes made by the
+/// block itself (in which case it stops after the writing instruction). Code which is
+/// rewritten repeatedly is left to the interpreter.
+/// </remarks>
+public class BlockJit
+{
+    private const int MaxInstructionCount = 32;
+    private const int MaxBlockBytes = MaxInstructionCount * 4;
+    private const int MinInstructionCount = 2;
+    private const int MaxEvictions = 4;
+
+    private static readonly HashSet<string> PortMnemonics = new HashSet<string> { "IN", "OUT", "INI", "IND", "OUTI", "OUTD" };
+    private static readonly HashSet<string> TerminatorMnemonics = new HashSet<string>
+    {
+        "JP", "JR", "CALL", "RET", "RETI", "RETN", "RST", "HALT", "EI", "DI",
+        "LDIR", "LDDR", "CPIR", "CPDR", "INIR", "INDR", "OTIR", "OTDR"
+    };
+    private static readonly HashSet<string> MemoryWriteMnemonics = new HashSet<string> { "PUSH", "LDI", "LDD", "RLD", "RRD" };
+    private static readonly string[] MainRegisterNames = { "A", "B", "C", "D", "E", "H", "L" };
+    private static readonly string[] WordRegisterNames = { "BC", "DE", "HL", "SP", "IX", "IY" };
+
+    private static readonly MethodInfo GetRegisters = typeof(CPU).GetProperty(nameof(CPU.TheRegisters))!.GetMethod;
+    private static readonly MethodInfo GetMemory = typeof(CPU).GetProperty(nameof(CPU.MainMemory))!.GetMethod;
+    private static readonly MethodInfo RetireInstructionsMethod = GetInternalMethod(typeof(CPU), nameof(CPU.RetireInstructions));
+    private static readonly MethodInfo GetBlockJit = typeof(Memory).GetProperty(nameof(Memory.BlockJit), BindingFlags.Instance | BindingFlags.NonPublic)!.GetMethod;
+    private static readonly MethodInfo GetIsRunningBlockEvicted = typeof(BlockJit).GetProperty(nameof(IsRunningBlockEvicted), BindingFlags.Instance | BindingFlags.NonPublic)!.GetMethod;
+    private static readonly MethodInfo PeekMethod = typeof(Memory).GetMethod(nameof(Memory.Peek));
+    private static readonly MethodInfo PokeMethod = typeof(Memory).GetMethod(nameof(Memory.Poke), new[] { typeof(ushort), typeof(byte) });
+    private static readonly MethodInfo GetMain = typeof(Registers).GetProperty(nameof(Registers.Main))!.GetMethod;
+    private static readonly MethodInfo SetPC = typeof(Registers).GetProperty(nameof(Registers.PC))!.SetMethod;
+    private static readonly MethodInfo GetCarryFlag = typeof(Registers).GetProperty(nameof(Registers.CarryFlag))!.GetMethod;
+    private static readonly MethodInfo IXPlusDMethod = typeof(Registers).GetMethod(nameof(Registers.IXPlusD));
+    private static readonly MethodInfo IYPlusDMethod = typeof(Registers).GetMethod(nameof(Registers.IYPlusD));
+    private static readonly MethodInfo SetF = typeof(Registers.StorageRegisters).GetProperty(nameof(Registers.StorageRegisters.F))!.SetMethod;
+    private static readonly MethodInfo DeferFlagsMethod = GetInternalMethod(typeof(Registers.StorageRegisters), nameof(Registers.StorageRegisters.DeferFlags));
+    private static readonly MethodInfo ComputeFlagsMethod = typeof(Alu).GetMethod(nameof(Alu.ComputeDeferredFlags), BindingFlags.Static | BindingFlags.NonPublic);
+
+    private readonly CPU m_cpu;
+    private readonly Memory m_memory;
+    private readonly CompiledBlock[] m_blocks = new CompiledBlock[0x10000];
+    private readonly bool[] m_isBlockByte = new bool[0x10000];
+    private readonly byte[] m_evictionCounts = new byte[0x10000];
+    private readonly bool[] m_isUncompilable = new bool[0x10000];
+
+    public int CompiledBlockCount { get; private set; }
+
+    /// <summary>
+    /// Set when the running block writes to compiled code (possibly its own), so must stop.
+    /// </summary>
+    internal bool IsRunningBlockEvicted { get; private set; }
+
+    public BlockJit(CPU cpu)
+    {
+        m_cpu = cpu;
+        m_memory = cpu.MainMemory;
+        m_memory.BlockJit = this;
+        m_memory.DataLoaded += (_, _) => Clear();
+    }
+
+    /// <summary>
+    /// Run the block starting at the given address, compiling it if required.
+    /// </summary>
+    /// <param name="addr">The block start address.</param>
+    /// <param name="maxTStates">The most T-states the block can take.</param>
+    /// <returns>False if there is no block at the address, or it takes too long.</returns>
+    internal bool TryRun(ushort addr, long maxTStates)
+    {
+        var block = m_blocks[addr] ?? Compile(addr);
+        if (block == null || block.TStateCount > maxTStates)
+            return false;
+
+        IsRunningBlockEvicted = false;
+        block.Run(m_cpu);
+        return true;
+    }
+
+    /// <summary>
+    /// Called when a byte of memory changes, evicting any compiled block which spans it.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void OnMemoryWritten(ushort addr)
+    {
+        if (m_isBlockByte[addr])
+            Evict(addr);
+    }
+
+    /// <summary>
+    /// Called when a range of memory changes.
+    /// </summary>
+    public void OnMemoryWritten(ushort addr, int count)
+    {
+        for (var i = 0; i < count; i++)
+            OnMemoryWritten((ushort)(addr + i));
+    }
+
+    /// <summary>
+    /// Called when a different memory page is mapped into a range of addresses, forgetting all blocks there.
+    /// </summary>
+    /// <remarks>
+    /// Unlike a write, this says nothing about how often the code changes, so eviction counts start afresh.
+    /// </remarks>
+    public void OnMemoryPaged(ushort addr, int count)
+    {
+        // Include any block starting just before the range which spills into it.
+        var start = Math.Max(0, addr - (MaxBlockBytes - 1));
+        for (var blockAddr = start; blockAddr < addr + count; blockAddr++)
+        {
+            if (m_blocks[blockAddr] == null)
+                continue;
+            m_blocks[blockAddr] = null;
+            CompiledBlockCount--;
+
+            // Conservatively assume this is the running block.
+            IsRunningBlockEvicted = true;
+        }
+
+        Array.Clear(m_isBlockByte, addr, count);
+        Array.Clear(m_evictionCounts, addr, count);
+        Array.Clear(m_isUncompilable, addr, count);
+    }
+
+    private void Evict(ushort addr)
+    {
+        for (var i = 0; i < MaxBlockBytes; i++)
+        {
+            var blockAddr = (ushort)(addr - i);
+            if (m_blocks[blockAddr] == null || m_blocks[blockAddr].ByteCount <= i)
+                continue;
+
+            m_blocks[blockAddr] = null;
+            CompiledBlockCount--;
+            if (m_evictionCounts[blockAddr] < MaxEvictions)
+                m_evictionCounts[blockAddr]++;
+
+            // Conservatively assume this is the running block.
+            IsRunningBlockEvicted = true;
+        }
+
+        m_isBlockByte[addr] = false;
+    }
+
+    public void Clear()
+    {
+        Array.Clear(m_blocks);
+        Array.Clear(m_isBlockByte);
+        Array.Clear(m_evictionCounts);
+        Array.Clear(m_isUncompilable);
+        CompiledBlockCount = 0;
+    }
+
+    private CompiledBlock Compile(ushort addr)
+    {
+        if (m_isUncompilable[addr] || m_evictionCounts[addr] >= MaxEvictions)
+            return null;
+
+        var instructions = FindBlockInstructions(addr);
+        if (instructions.Count < MinInstructionCount)
+        {
+            // Not worth compiling, and won't be until the code changes.
+            m_isUncompilable[addr] = true;
+            return null;
+        }
+
+        var block = new CompiledBlock(Emit(addr, instructions), instructions.Sum(o => o.ByteCount), instructions.Sum(o => o.Instruction.TStateCount));
+        m_blocks[addr] = block;
+        for (var i = 0; i < block.ByteCount; i++)
+            m_isBlockByte[(ushort)(addr + i)] = true;
+        CompiledBlockCount++;
+        return block;
+    }
+
+    private List<DecodedInstruction> FindBlockInstructions(ushort addr)
+    {
+        var instructions = new List<DecodedInstruction>();
+        while (instructions.Count < MaxInstructionCount)
+        {
+            var instruction = m_cpu.InstructionCache.Find(addr);
+            if (instruction == null || IsTerminator(instruction.Instruction))
+                break;
+
+            // Reaching the 'LOAD ""' or LD-BYTES traps must be handled by the CPU.
+            var nextAddr = (ushort)(addr + instruction.ByteCount);
+            if (CPU.IsTrapAddress(nextAddr) || nextAddr < addr)
+                break;
+
+            instructions.Add(instruction);
+            addr = nextAddr;
+        }
+
+        return instructions;
+    }
+
+    private static bool IsTerminator(Instruction instruction) =>
+        TerminatorMnemonics.Contains(GetMnemonic(instruction));
+
+    private static string GetMnemonic(Instruction instruction) =>
+        GetParts(instruction)[0];
+
+    private static string[] GetParts(Instruction instruction) =>
+        instruction.Id.ToString().Split('_');
+
+    /// <summary>
+    /// Whether an instruction might write to memory (Conservatively including any which access it,
+    /// other than the inlined loads and ALU ops).
+    /// </summary>
+    private static bool CanWriteMemory(Instruction instruction, string[] parts) =>
+        MemoryWriteMnemonics.Contains(parts[0]) ||
+        instruction.Id.ToString().Contains("addr") && !IsInlineLoad(parts) && !TryParseAluOp(parts, out _, out _);
+
+    private Action<CPU> Emit(ushort addr, List<DecodedInstruction> instructions)
+    {
+        var method = new DynamicMethod($"Block_{addr:X4}", typeof(void), new[] { typeof(DecodedInstruction[]), typeof(CPU) }, typeof(CPU), true);
+        var il = method.GetILGenerator();
+
+        var locals = new BlockLocals(il, m_cpu.LazyFlags);
+        var jit = il.DeclareLocal(typeof(BlockJit));
+        il.Emit(OpCodes.Ldarg_1);
+        il.Emit(OpCodes.Call, GetRegisters);
+        il.Emit(OpCodes.Stloc, locals.Regs);
+        il.Emit(OpCodes.Ldarg_1);
+        il.Emit(OpCodes.Call, GetMemory);
+        il.Emit(OpCodes.Stloc, locals.Memory);
+        il.Emit(OpCodes.Ldloc, locals.Memory);
+        il.Emit(OpCodes.Call, GetBlockJit);
+        il.Emit(OpCodes.Stloc, jit);
+
+        // T-states and R increments not yet passed to the CPU.
+        var pendingTStates = 0;
+        var pendingR = 0;
+        var evictionExits = new List<(Label Label, ushort PC, int TStates, int R)>();
+        for (var i = 0; i < instructions.Count; i++)
+        {
+            var decoded = instructions[i];
+            var instruction = decoded.Instruction;
+
+            // R increases for each opcode fetch (including any prefix).
+            pendingR += m_memory.Peek(addr) is 0xDD or 0xFD or 0xED or 0xCB ? 2 : 1;
+            addr += instruction.ByteCount;
+
+            var parts = GetParts(instruction);
+            var canWriteMemory = CanWriteMemory(instruction, parts);
+            if (PortMnemonics.Contains(parts[0]) || instruction.Id == Z80Instructions.InstructionID.LD_A_R || canWriteMemory)
+            {
+                // Bring the CPU up to date before it is observed (Display writes are logged at the CPU's T-state count).
+                EmitRetire(il, pendingTStates, pendingR);
+                pendingTStates = pendingR = 0;
+            }
+
+            if (!TryEmitInline(il, decoded, parts, locals, AreFlagsOverwritten(instructions, i + 1)))
+            {
+                // Call the generated opcode table handler directly.
+                il.Emit(OpCodes.Ldarg_1);
+                il.Emit(OpCodes.Ldarg_0);
+                il.Emit(OpCodes.Ldc_I4, i);
+                il.Emit(OpCodes.Ldelem_Ref);
+                EmitLoadHandler(il, decoded);
+                il.EmitCalli(OpCodes.Calli, CallingConventions.Standard, typeof(int), new[] { typeof(CPU), typeof(DecodedInstruction) }, null);
+
+                // T-states are fixed for all instructions in a block.
+                il.Emit(OpCodes.Pop);
+                canWriteMemory = true;
+            }
+
+            pendingTStates += instruction.TStateCount;
+            if (!canWriteMemory)
+                continue;
+
+            // Stop if the instruction wrote to this block.
+            var evictionExit = il.DefineLabel();
+            evictionExits.Add((evictionExit, addr, pendingTStates, pendingR));
+            il.Emit(OpCodes.Ldloc, jit);
+            il.Emit(OpCodes.Callvirt, GetIsRunningBlockEvicted);
+            il.Emit(OpCodes.Brtrue, evictionExit);
+        }
+
+        EmitExit(il, locals.Regs, addr, pendingTStates, pendingR);
+        foreach (var exit in evictionExits)
+        {
+            il.MarkLabel(exit.Label);
+            EmitExit(il, locals.Regs, exit.PC, exit.TStates, exit.R);
+        }
+
+        return (Action<CPU>)method.CreateDelegate(typeof(Action<CPU>), instructions.ToArray());
+    }
+
+    private static void EmitExit(ILGenerator il, LocalBuilder regs, ushort pc, int tStates, int rIncrements)
+    {
+        il.Emit(OpCodes.Ldloc, regs);
+        il.Emit(OpCodes.Ldc_I4, (int)pc);
+        il.Emit(OpCodes.Callvirt, SetPC);
+        EmitRetire(il, tStates, rIncrements);
+        il.Emit(OpCodes.Ret);
+    }
+
+    private static void EmitRetire(ILGenerator il, int tStates, int rIncrements)
+    {
+        if (tStates == 0 && rIncrements == 0)
+            return;
+        il.Emit(OpCodes.Ldarg_1);
+        il.Emit(OpCodes.Ldc_I4, tStates);
+        il.Emit(OpCodes.Ldc_I4, rIncrements);
+        il.Emit(OpCodes.Call, RetireInstructionsMethod);
+    }
+
+    private static unsafe void EmitLoadHandler(ILGenerator il, DecodedInstruction decoded)
+    {
+        il.Emit(OpCodes.Ldc_I8, (long)decoded.Handler);
+        il.Emit(OpCodes.Conv_I);
+    }
+
+    /// <summary>
+    /// Emit IL for the common loads, stores and 8-bit ALU ops, rather than calling their handlers.
+    /// </summary>
+    /// <remarks>
+    /// Immediate values are baked in, as any write to them evicts the block.
+    /// </remarks>
+    /// <param name="isFlagResultDead">Set if a later instruction overwrites the flags before they can be read.</param>
+    private static bool TryEmitInline(ILGenerator il, DecodedInstruction decoded, string[] parts, BlockLocals locals, bool isFlagResultDead)
+    {
+        switch (parts)
+        {
+            case ["NOP"]:
+                return true;
+
+            // LD r,r' / LD r,n / LD r,(HL) / LD A,(BC) / LD A,(nn) / LD r,(IX+d) etc.
+            case ["LD", var to, .. var from] when IsInlineLoad(parts):
+                EmitLoadMain(il, locals.Regs);
+                EmitLoadByte(il, string.Join('_', from), decoded, locals);
+                il.Emit(OpCodes.Callvirt, GetRegisterAccessor(to, false));
+                return true;
+
+            // LD (HL),r / LD (HL),n / LD (BC),A / LD (nn),A / LD (IX+d),r etc.
+            case ["LD", .. var to, var from] when IsAddress(string.Join('_', to)) && IsRegisterOrImmediate(from):
+                il.Emit(OpCodes.Ldloc, locals.Memory);
+                EmitLoadAddress(il, string.Join('_', to), decoded, locals.Regs);
+                EmitLoadByte(il, from, decoded, locals);
+                il.Emit(OpCodes.Call, PokeMethod);
+                il.Emit(OpCodes.Pop);
+                return true;
+
+            // LD rr,nn
+            case ["LD", var to, "nn"] when WordRegisterNames.Contains(to):
+                EmitLoadRegisterOwner(il, locals.Regs, to);
+                il.Emit(OpCodes.Ldc_I4, decoded.Immediate);
+                il.Emit(OpCodes.Callvirt, GetRegisterAccessor(to, false));
+                return true;
+
+            // INC rr, DEC rr
+            case [var op and ("INC" or "DEC"), var reg] when WordRegisterNames.Contains(reg):
+                EmitLoadRegisterOwner(il, locals.Regs, reg);
+                EmitLoadRegisterOwner(il, locals.Regs, reg);
+                il.Emit(OpCodes.Callvirt, GetRegisterAccessor(reg, true));
+                il.Emit(OpCodes.Ldc_I4_1);
+                il.Emit(op == "INC" ? OpCodes.Add : OpCodes.Sub);
+                il.Emit(OpCodes.Conv_U2);
+                il.Emit(OpCodes.Callvirt, GetRegisterAccessor(reg, false));
+                return true;
+
+            default:
+                if (!TryParseAluOp(parts, out var aluOp, out var operand))
+                    return false;
+                EmitAluOp(il, aluOp, operand, decoded, locals, isFlagResultDead);
+                return true;
+        }
+    }
+
+    /// <summary>
+    /// Emit an 8-bit ALU op on A (or the INC/DEC target), recording its flags the same way as <see cref="Alu"/>.
+    /// </summary>
+    private static void EmitAluOp(ILGenerator il, string op, string operand, DecodedInstruction decoded, BlockLocals locals, bool isFlagResultDead)
+    {
+        var isIncDec = op is "INC" or "DEC";
+        var target = isIncDec ? operand : "A";
+
+        EmitLoadMain(il, locals.Regs);
+        il.Emit(OpCodes.Callvirt, GetRegisterAccessor(target, true));
+        il.Emit(OpCodes.Stloc, locals.A);
+        if (isIncDec)
+            il.Emit(OpCodes.Ldc_I4_1);
+        else
+            EmitLoadByte(il, operand, decoded, locals);
+        il.Emit(OpCodes.Stloc, locals.B);
+
+        // Carry in for ADC/SBC, or preserved by INC/DEC.
+        if (op is "ADC" or "SBC" || isIncDec && !isFlagResultDead)
+        {
+            il.Emit(OpCodes.Ldloc, locals.Regs);
+            il.Emit(OpCodes.Callvirt, GetCarryFlag);
+        }
+        else
+        {
+            il.Emit(OpCodes.Ldc_I4_0);
+        }
+        il.Emit(OpCodes.Stloc, locals.Carry);
+
+        il.Emit(OpCodes.Ldloc, locals.A);
+        il.Emit(OpCodes.Ldloc, locals.B);
+        il.Emit(op switch
+        {
+            "ADD" or "ADC" or "INC" => OpCodes.Add,
+            "SUB" or "SBC" or "CP" or "DEC" => OpCodes.Sub,
+            "AND" => OpCodes.And,
+            "OR" => OpCodes.Or,
+            _ => OpCodes.Xor
+        });
+        if (op is "ADC" or "SBC")
+        {
+            il.Emit(OpCodes.Ldloc, locals.Carry);
+            il.Emit(op == "ADC" ? OpCodes.Add : OpCodes.Sub);
+        }
+        il.Emit(OpCodes.Stloc, locals.Result);
+
+        if (!isFlagResultDead)
+        {
+            var deferredOp = op switch
+            {
+                "ADD" or "ADC" => Alu.DeferredOp.Add,
+                "SUB" or "SBC" => Alu.DeferredOp.Subtract,
+                "CP" => Alu.DeferredOp.Compare,
+                "INC" => Alu.DeferredOp.Inc,
+                "DEC" => Alu.DeferredOp.Dec,
+                "AND" => Alu.DeferredOp.And,
+                "OR" => Alu.DeferredOp.Or,
+                _ => Alu.DeferredOp.Xor
+            };
+            EmitLoadMain(il, locals.Regs);
+            il.Emit(OpCodes.Ldc_I4, (int)deferredOp);
+            il.Emit(OpCodes.Ldloc, locals.A);
+            il.Emit(OpCodes.Ldloc, locals.B);
+            il.Emit(OpCodes.Ldloc, locals.Result);
+            il.Emit(OpCodes.Ldloc, locals.Carry);
+            if (locals.IsLazyFlags)
+            {
+                il.Emit(OpCodes.Callvirt, DeferFlagsMethod);
+            }
+            else
+            {
+                il.Emit(OpCodes.Call, ComputeFlagsMethod);
+                il.Emit(OpCodes.Callvirt, SetF);
+            }
+        }
+
+        if (op == "CP")
+            return;
+        EmitLoadMain(il, locals.Regs);
+        il.Emit(OpCodes.Ldloc, locals.Result);
+        il.Emit(OpCodes.Conv_U1);
+        il.Emit(OpCodes.Callvirt, GetRegisterAccessor(target, false));
+    }
+
+    /// <summary>
+    /// Parse an inlinable 8-bit ALU op (e.g. ADD A,n, SUB (HL), XOR (IX+d), INC r).
+    /// </summary>
+    /// <param name="operand">The source operand, or the register for INC/DEC.</param>
+    private static bool TryParseAluOp(string[] parts, out string op, out string operand)
+    {
+        (op, operand) = parts switch
+        {
+            [var m and ("ADD" or "ADC" or "SBC"), "A", .. var rest] => (m, string.Join('_', rest)),
+            [var m and ("SUB" or "AND" or "OR" or "XOR" or "CP"), .. var rest] => (m, string.Join('_', rest)),
+            [var m and ("INC" or "DEC"), var reg] when MainRegisterNames.Contains(reg) => (m, reg),
+            _ => (null, null)
+        };
+        return op != null && IsByteSource(operand);
+    }
+
+    /// <summary>
+    /// LD r,r', LD r,n, or LD r from memory.
+    /// </summary>
+    private static bool IsInlineLoad(string[] parts) =>
+        parts is ["LD", var to, .. var from] && MainRegisterNames.Contains(to) && IsByteSource(string.Join('_', from));
+
+    /// <summary>
+    /// Whether the flags set by an instruction are overwritten before anything can read them, allowing them to be skipped.
+    /// </summary>
+    /// <remarks>
+    /// Only looks through inlined instructions which don't touch the flags, and can't leave the block early.
+    /// </remarks>
+    private static bool AreFlagsOverwritten(List<DecodedInstruction> instructions, int index)
+    {
+        for (var i = index; i < instructions.Count; i++)
+        {
+            var parts = GetParts(instructions[i].Instruction);
+            if (TryParseAluOp(parts, out var op, out _))
+                return op is "ADD" or "SUB" or "AND" or "OR" or "XOR" or "CP";
+
+            var isFlagFree =
+                parts is ["NOP"] ||
+                IsInlineLoad(parts) ||
+                (parts is ["LD", _, "nn"] or ["INC" or "DEC", _] && WordRegisterNames.Contains(parts[1]));
+            if (!isFlagFree)
+                return false;
+        }
+
+        return false;
+    }
+
+    private static bool IsByteSource(string operand) =>
+        IsRegisterOrImmediate(operand) || IsAddress(operand);
+
+    private static bool IsRegisterOrImmediate(string operand) =>
+        operand == "n" || MainRegisterNames.Contains(operand);
+
+    private static bool IsAddress(string operand) =>
+        operand is "addr" or "addrHL" or "addrBC" or "addrDE" || IsIndexedAddress(operand);
+
+    private static bool IsIndexedAddress(string operand) =>
+        operand is "addrIXplus_d" or "addrIYplus_d" or "addrIX_plus_d" or "addrIY_plus_d";
+
+    /// <summary>
+    /// Push a byte from a register, the immediate value, or memory.
+    /// </summary>
+    private static void EmitLoadByte(ILGenerator il, string operand, DecodedInstruction decoded, BlockLocals locals)
+    {
+        if (operand == "n")
+        {
+            il.Emit(OpCodes.Ldc_I4, decoded.Immediate & 0xFF);
+        }
+        else if (MainRegisterNames.Contains(operand))
+        {
+            EmitLoadMain(il, locals.Regs);
+            il.Emit(OpCodes.Callvirt, GetRegisterAccessor(operand, true));
+        }
+        else
+        {
+            il.Emit(OpCodes.Ldloc, locals.Memory);
+            EmitLoadAddress(il, operand, decoded, locals.Regs);
+            il.Emit(OpCodes.Call, PeekMethod);
+        }
+    }
+
+    private static void EmitLoadAddress(ILGenerator il, string operand, DecodedInstruction decoded, LocalBuilder regs)
+    {
+        if (operand == "addr")
+        {
+            il.Emit(OpCodes.Ldc_I4, decoded.Immediate);
+        }
+        else if (IsIndexedAddress(operand))
+        {
+            il.Emit(OpCodes.Ldloc, regs);
+            il.Emit(OpCodes.Ldc_I4, (int)decoded.Displacement);
+            il.Emit(OpCodes.Callvirt, operand.StartsWith("addrIX") ? IXPlusDMethod : IYPlusDMethod);
+        }
+        else
+        {
+            EmitLoadMain(il, regs);
+            il.Emit(OpCodes.Callvirt, GetRegisterAccessor(operand[4..], true));
+        }
+    }
+
+    private static void EmitLoadMain(ILGenerator il, LocalBuilder regs)
+    {
+        // Not cached, as EXX can switch register sets mid-block.
+        il.Emit(OpCodes.Ldloc, regs);
+        il.Emit(OpCodes.Callvirt, GetMain);
+    }
+
+    /// <summary>
+    /// Push the object owning the named register (The main register set, or the registers themselves).
+    /// </summary>
+    private static void EmitLoadRegisterOwner(ILGenerator il, LocalBuilder regs, string name)
+    {
+        if (IsMainRegister(name))
+            EmitLoadMain(il, regs);
+        else
+            il.Emit(OpCodes.Ldloc, regs);
+    }
+
+    private static bool IsMainRegister(string name) => name is not ("SP" or "IX" or "IY");
+
+    private static MethodInfo GetRegisterAccessor(string name, bool isGetter)
+    {
+        var ownerType = IsMainRegister(name) ? typeof(Registers.StorageRegisters) : typeof(Registers);
+        var property = ownerType.GetProperty(name)!;
+        return isGetter ? property.GetMethod : property.SetMethod;
+    }
+
+    private static MethodInfo GetInternalMethod(Type type, string name) =>
+        type.GetMethod(name, BindingFlags.Instance | BindingFlags.NonPublic);
+
+    /// <summary>
+    /// The locals shared by all instructions in a block.
+    /// </summary>
+    private sealed class BlockLocals
+    {
+        public BlockLocals(ILGenerator il, bool isLazyFlags)
+        {
+            Regs = il.DeclareLocal(typeof(Registers));
+            Memory = il.DeclareLocal(typeof(Memory));
+            A = il.DeclareLocal(typeof(int));
+            B = il.DeclareLocal(typeof(int));
+            Result = il.DeclareLocal(typeof(int));
+            Carry = il.DeclareLocal(typeof(bool));
+            IsLazyFlags = isLazyFlags;
+        }
+
+        public LocalBuilder Regs { get; }
+        public LocalBuilder Memory { get; }
+
+        /// <summary>
+        /// ALU operands and result.
+        /// </summary>
+        public LocalBuilder A { get; }
+        public LocalBuilder B { get; }
+        public LocalBuilder Result { get; }
+        public LocalBuilder Carry { get; }
+
+        /// <summary>
+        /// Whether flags are deferred (<see cref="CPU.LazyFlags"/>), fixed when the block is compiled.
+        /// </summary>
+        public bool IsLazyFlags { get; }
+    }
+
+    private sealed class CompiledBlock
+    {
+        public CompiledBlock(Action<CPU> run, int byteCount, int tStateCount)
+        {
+            Run = run;
+            ByteCount = byteCount;
+            TStateCount = tStateCount;
+        }
+
+        public Action<CPU> Run { get; }
+        public int ByteCount { get; }
+        public int TStateCount { get; }
+    }
+}
@@ -28,12 +28,31 @@ public partial class CPU : ViewModelBase
     private bool m_isDebuggerActive;
     private int m_previousScanline;
 
-    private const int TStatesPerInterrupt = 69888;
+    public const int TStatesPerInterrupt = 69888;
+    internal const int TStatesPerScanline = 224;
+
+    /// <summary>
+    /// Instructions are stamped with their start time, but OUT writes the port in its last machine cycle.
+    /// </summary>
+    internal const int PortWriteTStates = 8;
+    private const int HaltTStates = 4;
+    internal const ushort LoadTrapAddress = 0x056A;
+    internal const ushort LdBytesTrapAddress = 0x0556;
+    internal const ushort LdBreakTrapAddress = 0x056B;
     public const double TStatesPerSecond = 3494400;
 
     public event EventHandler PoweredOff;
     public event EventHandler LoadRequested;
 
+    /// <summary>
+    /// Raised when the ROM's LD-BYTES routine is entered (Or is waiting for a leader tone),
+    /// allowing a tape block to be loaded instantly.
+    /// </summary>
+    /// <remarks>
+    /// Handlers which load the block must leave PC pointing where the routine would return to.
+    /// </remarks>
+    public event EventHandler LdBytesRequested;
+
     
     public long TStatesSinceCpuStart { get; private set; }
 
@@ -53,17 +72,32 @@ public partial class CPU : ViewModelBase
     public event EventHandler<(Memory memory, int scanline)> RenderScanline;
     
     public Z80Instructions InstructionSet { get; }
+    public InstructionCache InstructionCache { get; }
     public ClockSync ClockSync { get; }
     public Registers TheRegisters { get; }
     public Memory MainMemory { get; }
     public bool IsHalted { get; private set; }
     public object CpuStepLock { get; } = new object();
 
+    /// <summary>
+    /// Defer computing the flags register until it is read (Default: On).
+    /// </summary>
+    public bool LazyFlags
+    {
+        get => TheAlu.LazyFlags;
+        set
+        {
+            TheAlu.LazyFlags = value;
+            m_blockJit?.Clear(); // Compiled blocks record flags in the chosen way.
+        }
+    }
+
     public CPU(Memory mainMemory, IPortHandler portHandler = null, SoundHandler soundHandler = null)
     {
         m_soundHandler = soundHandler;
         MainMemory = mainMemory;
         InstructionSet = new Z80Instructions();
+        InstructionCache = new InstructionCache(InstructionSet, MainMemory);
         TheRegisters = new Registers();
         TheAlu = new Alu(TheRegisters);
         ThePortHandler = portHandler;
@@ -82,6 +116,7 @@ public partial class CPU : ViewModelBase
     public void PowerOnAsync()
     {
         TheRegisters.Clear();
+        MainMemory.ResetPaging();
         m_cpuThread = new Thread(RunLoop) { Name = "Z80 CPU" };
         m_cpuThread.Start();
     }
@@ -141,11 +176,19 @@ public partial class CPU : ViewModelBase
 
             lock (CpuStepLock)
             {
-                var prevPC = TheRegisters.PC;
-                var oldTickCount = TStatesSinceCpuStart;
-                Step();
-                var elapsedTicks = (int)(TStatesSinceCpuStart - oldTickCount);
-                Ticked?.Invoke(this, (elapsedTicks, prevPC, TheRegisters.PC));
+                // Only single-step when something needs to see every instruction.
+                if (IsDebuggerActive || Ticked != null)
+                {
+                    var prevPC = TheRegisters.PC;
+                    var oldTickCount = TStatesSinceCpuStart;
+                    Step();
+                    var elapsedTicks = (int)(TStatesSinceCpuStart - oldTickCount);
+                    Ticked?.Invoke(this, (elapsedTicks, prevPC, TheRegisters.PC));
+                }
+                else
+                {
+                    StepToNextEvent();
+                }
             }
         }
 
@@ -166,30 +209,137 @@ public partial class CPU : ViewModelBase
         var oldIFF = TheRegisters.IFF1;
 
         // Execute instruction.
-        var tStates = Tick();
+        var profiler = m_profiler;
+        var tStates = profiler == null ? Tick() : TickProfiled(profiler);
+        CompleteStep(oldIFF, tStates);
+    }
+
+    /// <summary>
+    /// Run instructions until the next scheduled event (scanline, interrupt or a ROM tape trap)
+    /// is reached, which is then handled exactly as <see cref="Step"/> would.
+    /// </summary>
+    /// <remarks>
+    /// Instructions before the event only advance the T-state count, avoiding the per-instruction
+    /// interrupt and scanline bookkeeping. The tape signal is derived from the T-state count
+    /// when read, and speaker changes are stamped with it, so neither needs an event of its own.
+    /// With <see cref="UseJit"/> enabled, straight-line code runs as compiled blocks.
+    /// If the CPU is halted it can only be woken by an interrupt, so this runs through each event
+    /// up to the next interrupt in one call.
+    /// While <see cref="IsProfiling"/>, this runs a single instruction so the profiler sees each one.
+    /// </remarks>
+    /// <param name="stopAtTStates">An optional external stop, such as the end of a headless frame.</param>
+    public void StepToNextEvent(long stopAtTStates = long.MaxValue)
+    {
+        if (m_profiler != null)
+        {
+            Step();
+            return;
+        }
+
+        var haltedUntilTStates = IsHalted ? Math.Min(GetNextInterruptTStates(), stopAtTStates) : 0;
+        do
+        {
+            RunToEvent(Math.Min(GetNextEventTStates(), stopAtTStates));
+        } while (IsHalted && TStatesSinceCpuStart < haltedUntilTStates);
+    }
+
+    private void RunToEvent(long eventTStates)
+    {
+        m_bulkRepeatLimitTStates = eventTStates;
+        while (true)
+        {
+            if (IsHalted && !IsTrapAddress(TheRegisters.PC))
+                SkipHalts(eventTStates);
+
+            if (TryRunCompiledBlock(eventTStates))
+                continue;
+
+            var oldIFF = TheRegisters.IFF1;
+            var tStates = Tick();
+            if (TStatesSinceCpuStart + tStates < eventTStates && !IsTrapAddress(TheRegisters.PC))
+            {
+                TStatesSinceCpuStart += tStates;
+                continue;
+            }
+
+            m_bulkRepeatLimitTStates = 0;
+            CompleteStep(oldIFF, tStates);
+            return;
+        }
+    }
+
+    /// <summary>
+    /// Account for the repeated HALT instructions which complete before the given event,
+    /// as if each had been stepped.
+    /// </summary>
+    private void SkipHalts(long eventTStates)
+    {
+        var haltCount = (eventTStates - TStatesSinceCpuStart - 1) / HaltTStates;
+        if (haltCount <= 0)
+            return;
+
+        var tStates = haltCount * HaltTStates;
+        TStatesSinceCpuStart += tStates;
+        var r = TheRegisters.R;
+        TheRegisters.R = (byte)((r + haltCount & 0x7F) | (r & 0x80));
+    }
+
+    private long GetNextInterruptTStates() =>
+        TStatesSinceCpuStart - TStatesSinceCpuStart % TStatesPerInterrupt + TStatesPerInterrupt;
+
+    /// <summary>
+    /// The T-state count at which the next scanline starts.
+    /// </summary>
+    private long GetNextEventTStates()
+    {
+        // The instruction completing a frame reports it as scanline 312, so the next instruction
+        // must be stepped to report scanline 0.
+        if (m_previousScanline != TStatesSinceCpuStart % TStatesPerInterrupt / TStatesPerScanline)
+            return TStatesSinceCpuStart + 1;
+
+        // Interrupts coincide with the start of a scanline, as each frame is a whole number of them.
+        return TStatesSinceCpuStart - TStatesSinceCpuStart % TStatesPerScanline + TStatesPerScanline;
+    }
+
+    /// <summary>
+    /// Whether reaching the address must stop a run of instructions, so <see cref="CompleteStep"/> can trap it.
+    /// </summary>
+    internal static bool IsTrapAddress(ushort addr) =>
+        addr == LoadTrapAddress || addr == LdBytesTrapAddress || addr == LdBreakTrapAddress;
+
+    /// <summary>
+    /// Advance the clock after an instruction, and handle any scanline, trap or interrupt it triggers.
+    /// </summary>
+    private void CompleteStep(bool oldIFF, int tStates)
+    {
         var ticksSinceInterrupt = (int)((TStatesSinceCpuStart % TStatesPerInterrupt) + tStates);
         TStatesSinceCpuStart += tStates;
-            
-        // Record speaker state.
-        m_soundHandler?.SampleSpeakerState(tStates);
 
         // Screen build-up.
-        var scanline = ticksSinceInterrupt / 224;
+        var scanline = ticksSinceInterrupt / TStatesPerScanline;
         if (scanline != m_previousScanline)
         {
             m_previousScanline = scanline;
             RenderScanline?.Invoke(this, (MainMemory, scanline));
         }
         
-        // Special case 'LOAD ""' instruction.
+        // Special case 'LOAD ""' instruction, and the ROM's LD-BYTES tape routine.
         // (Double-checking the standard Sinclair BASIC ROM is loaded...)
-        if (TheRegisters.PC == 0x056A && MainMemory.Peek(0x1540) == 0x53)
-            LoadRequested?.Invoke(this, EventArgs.Empty);
+        if (IsTrapAddress(TheRegisters.PC) && MainMemory.Peek(0x1540) == 0x53)
+        {
+            if (TheRegisters.PC == LoadTrapAddress)
+                LoadRequested?.Invoke(this, EventArgs.Empty);
+            else
+                LdBytesRequested?.Invoke(this, EventArgs.Empty);
+        }
 
         // Time to handle interrupts?
         if (TStatesPerInterrupt == 0 || ticksSinceInterrupt < TStatesPerInterrupt)
             return;
 
+        // Synthesise the frame's speaker output.
+        m_soundHandler?.EndFrame();
+
         // Handle MI interrupts.
         if (TheRegisters.IFF1 && !oldIFF)
             return; // This instruction is EI, so wait one instruction.
@@ -211,10 +361,12 @@ public partial class CPU : ViewModelBase
             case 1:
                 CallIfTrue(0x0038, true);
                 TStatesSinceCpuStart += 17;
+                m_profiler?.OnInterrupt(17);
                 break;
             case 2:
                 CallIfTrue(MainMemory.PeekWord((ushort)((TheRegisters.I << 8) | 0xff)), true);
                 TStatesSinceCpuStart += 19;
+                m_profiler?.OnInterrupt(19);
                 break;
             default:
                 Debug.Fail("Invalid interrupt mode.");
@@ -228,15 +380,13 @@ public partial class CPU : ViewModelBase
     {
         var portAddress = (TheRegisters.Main.B << 8) + TheRegisters.Main.C;
         var b = ThePortHandler?.In((ushort)portAddress) ?? 0x00;
-        TheRegisters.SignFlag = !Alu.IsBytePositive(b);
-        TheRegisters.ZeroFlag = b == 0;
-        TheRegisters.HalfCarryFlag = false;
-        TheRegisters.ParityFlag = Alu.IsEvenParity(b);
-        TheRegisters.SubtractFlag = false;
-        TheRegisters.SetFlags53From(b);
+        TheRegisters.Main.F = (byte)(Alu.GetSz53p(b) | (TheRegisters.Main.F & 0x01));
         return b;
     }
 
+    private void PortOut(ushort portAddress, byte value) =>
+        ThePortHandler?.Out(portAddress, value);
+
     public void RETN()
     {
         doRet();
@@ -272,17 +422,8 @@ public partial class CPU : ViewModelBase
         return b;
     }
 
-    private void doBitTest(byte b, byte i)
-    {
-        TheRegisters.ZeroFlag = !b.IsBitSet(i);
-        TheRegisters.SubtractFlag = false;
-        TheRegisters.HalfCarryFlag = true;
-
-        // From 'undocumented' docs.
-        TheRegisters.ParityFlag = TheRegisters.ZeroFlag;
-        TheRegisters.SignFlag = i == 7 && !Alu.IsBytePositive(b);
-        TheRegisters.SetFlags53From(b);
-    }
+    private void doBitTest(byte b, byte i) =>
+        TheRegisters.Main.F = (byte)(Alu.GetBitTestFlags(b, i) | (TheRegisters.Main.F & 0x01));
 
     private void doCPI()
     {
@@ -0,0 +1,161 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+namespace Speculator.Core;
+
+/// <summary>
+/// Bulk execution of repeating block instructions (LDIR, CPIR, INIR, OTIR, etc).
+/// </summary>
+/// <remarks>
+/// When running via StepToNextEvent(), all but the last repeat that fits before the next event
+/// is run here without re-dispatching the instruction. The caller then runs the final repeat
+/// as normal, which sets the flags, so the end state matches single-stepping exactly.
+/// </remarks>
+public partial class CPU
+{
+    private const int TStatesPerBlockRepeat = 21;
+
+    /// <summary>
+    /// The T-state of the next event while in StepToNextEvent(), otherwise zero (disabling bulk repeats).
+    /// </summary>
+    private long m_bulkRepeatLimitTStates;
+
+    /// <summary>
+    /// The number of repeats which can complete before the next event.
+    /// </summary>
+    private int GetBulkRepeatBudget()
+    {
+        var availableTStates = m_bulkRepeatLimitTStates - TStatesSinceCpuStart - 1;
+        return availableTStates < TStatesPerBlockRepeat ? 0 : (int)Math.Min(availableTStates / TStatesPerBlockRepeat, 0x10000);
+    }
+
+    /// <summary>
+    /// Account for repeats run in bulk, as if each had been stepped.
+    /// </summary>
+    private void CompleteBulkRepeats(int repeatCount, long tStates)
+    {
+        TStatesSinceCpuStart += tStates;
+
+        // Each repeat fetches an ED prefix and an opcode.
+        var r = TheRegisters.R;
+        TheRegisters.R = (byte)((r + repeatCount * 2 & 0x7F) | (r & 0x80));
+    }
+
+    /// <summary>
+    /// LDIR/LDDR.
+    /// </summary>
+    private void RunBulkBlockCopy(ushort instructionAddr, bool isIncrementing)
+    {
+        var regs = TheRegisters.Main;
+        var count = Math.Min(GetBulkRepeatBudget(), (ushort)(regs.BC - 1));
+        if (count == 0)
+            return;
+
+        // Don't wrap around memory, or overwrite this instruction (which would change what runs next).
+        int hl = regs.HL;
+        int de = regs.DE;
+        if (isIncrementing)
+        {
+            count = Math.Min(count, Math.Min(0x10000 - hl, 0x10000 - de));
+            if (de <= instructionAddr + 1)
+                count = Math.Min(count, Math.Max(0, instructionAddr - de));
+        }
+        else
+        {
+            count = Math.Min(count, Math.Min(hl + 1, de + 1));
+            if (de >= instructionAddr)
+                count = Math.Min(count, Math.Max(0, de - instructionAddr - 1));
+        }
+
+        if (count == 0)
+            return;
+
+        MainMemory.CopyBlock(regs.HL, regs.DE, count, isIncrementing, TStatesPerBlockRepeat);
+        var step = isIncrementing ? count : -count;
+        regs.HL = (ushort)(hl + step);
+        regs.DE = (ushort)(de + step);
+        regs.BC = (ushort)(regs.BC - count);
+        CompleteBulkRepeats(count, (long)count * TStatesPerBlockRepeat);
+    }
+
+    /// <summary>
+    /// CPIR/CPDR - Skip the bytes which don't match A.
+    /// </summary>
+    private void RunBulkBlockCompare(bool isIncrementing)
+    {
+        var regs = TheRegisters.Main;
+        var count = Math.Min(GetBulkRepeatBudget(), (ushort)(regs.BC - 1));
+        int hl = regs.HL;
+        count = Math.Min(count, isIncrementing ? Memory.PageSize - (hl & (Memory.PageSize - 1)) : (hl & (Memory.PageSize - 1)) + 1); // Stay within the memory page.
+        if (count == 0)
+            return;
+
+        int mismatchCount;
+        long tStates;
+        if (isIncrementing)
+        {
+            var index = MainMemory.GetSlotSpan((ushort)hl, count).IndexOf(regs.A);
+            mismatchCount = index < 0 ? count : index;
+            if (mismatchCount == 0)
+                return;
+
+            // Matches CPIR's stepped timing, which tests the byte after each comparison.
+            tStates = (long)mismatchCount * TStatesPerBlockRepeat;
+            if (MainMemory.Peek((ushort)(hl + mismatchCount)) == regs.A)
+                tStates -= 5;
+            regs.HL = (ushort)(hl + mismatchCount);
+        }
+        else
+        {
+            var index = MainMemory.GetSlotSpan((ushort)(hl - count + 1), count).LastIndexOf(regs.A);
+            mismatchCount = index < 0 ? count : count - 1 - index;
+            if (mismatchCount == 0)
+                return;
+
+            tStates = (long)mismatchCount * TStatesPerBlockRepeat;
+            regs.HL = (ushort)(hl - mismatchCount);
+        }
+
+        regs.BC = (ushort)(regs.BC - mismatchCount);
+        CompleteBulkRepeats(mismatchCount, tStates);
+    }
+
+    /// <summary>
+    /// INIR/INDR/OTIR/OTDR - Each repeat still reaches the port handler at its own T-state.
+    /// </summary>
+    private void RunBulkBlockInOut(ushort instructionAddr, bool isInput, bool isIncrementing)
+    {
+        if (ThePortHandler == null)
+            return;
+
+        var regs = TheRegisters.Main;
+        var count = Math.Min(GetBulkRepeatBudget(), (byte)(regs.B - 1));
+        for (var i = 0; i < count; i++)
+        {
+            if (isInput)
+            {
+                if (regs.HL == instructionAddr || regs.HL == (ushort)(instructionAddr + 1))
+                    return; // About to overwrite this instruction.
+                MainMemory.Poke(regs.HL, ThePortHandler.In(regs.BC));
+                regs.B--;
+            }
+            else
+            {
+                regs.B--;
+                PortOut(regs.BC, MainMemory.Peek(regs.HL));
+            }
+
+            regs.HL = (ushort)(isIncrementing ? regs.HL + 1 : regs.HL - 1);
+            CompleteBulkRepeats(1, TStatesPerBlockRepeat);
+        }
+    }
+}
@@ -33,7 +33,7 @@ public partial class CPU
             IncrementR();
         }
         
-        var instruction = InstructionSet.FindInstructionAtMemoryLocation(MainMemory, TheRegisters.PC);
+        var instruction = InstructionCache.Find(TheRegisters.PC);
         if (instruction != null)
             return ExecuteInstruction(instruction);
 
@@ -49,8 +49,8 @@ public partial class CPU
                     // and process the next opcode as normal.
                     if (!m_opcodeWarningIssued)
                         Logger.Instance.Warn($"Ignoring {opcodeByte:X2} prefix for opcode {MainMemory.ReadAsHexString(TheRegisters.PC, 4, true)} (Disabling future warnings).");
-                    var nop = ExecuteInstruction(InstructionSet.Nop, false); // Don't increment R - We did it above.
-                    return nop + Tick();
+                    TheRegisters.PC++; // Don't increment R - We did it above.
+                    return 4 + Tick();
 
                 case 0xED:
                     var nextByte = MainMemory.Peek((ushort)(TheRegisters.PC + 1));
@@ -65,8 +65,10 @@ public partial class CPU
                         if (!m_opcodeWarningIssued)
                             Logger.Instance.Warn($"Ignoring ED prefix for opcode {MainMemory.ReadAsHexString(TheRegisters.PC, 4, true)} (Disabling future warnings).");
                     }
-                    
-                    return ExecuteInstruction(InstructionSet.NopNop);
+
+                    TheRegisters.PC += 2;
+                    IncrementR();
+                    return 8;
 
                 default:
                     throw new UnsupportedInstruction(this);
@@ -79,2557 +81,2793 @@ public partial class CPU
     }
 
     /// <summary>
-    /// Execute a specific instruction.
+    /// Execute a decoded instruction, using its handler from the generated opcode tables.
     /// </summary>
     /// <remarks>The program counter will automatically be incremented.</remarks>
     /// <returns>The number of TStates used by the instruction.</returns>
-    private int ExecuteInstruction(Instruction instruction, bool incrementR = true)
+    private unsafe int ExecuteInstruction(DecodedInstruction instruction)
     {
-        var regs = TheRegisters;
-        var instructionAddress = regs.PC;
-        regs.PC += instruction.ByteCount;
-        var valueAddress = (ushort)(instructionAddress + instruction.ValueByteOffset);
+        TheRegisters.PC += instruction.ByteCount;
 
         // R increased each time an opcode is read.
-        if (incrementR)
-            IncrementR();
+        IncrementR();
 
-        var imm8 = MainMemory.Peek(valueAddress);
-        switch (instruction.Id)
-        {
-            case Z80Instructions.InstructionID.NOP:
-            case Z80Instructions.InstructionID.NOPNOP:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_n:
-                regs.Main.A = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_n:
-                regs.Main.B = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_n:
-                regs.Main.C = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_n:
-                regs.Main.D = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_n:
-                regs.Main.E = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_n:
-                regs.Main.H = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_n:
-                regs.Main.L = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_addr:
-                regs.Main.A = MainMemory.Peek(MainMemory.PeekWord(valueAddress));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_A:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_B:
-                regs.Main.A = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_C:
-                regs.Main.A = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_D:
-                regs.Main.A = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_E:
-                regs.Main.A = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_H:
-                regs.Main.A = regs.Main.H;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_L:
-                regs.Main.A = regs.Main.L;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_A:
-                regs.Main.B = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_B:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_C:
-                regs.Main.B = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_D:
-                regs.Main.B = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_E:
-                regs.Main.B = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_H:
-                regs.Main.B = regs.Main.H;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_L:
-                regs.Main.B = regs.Main.L;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_A:
-                regs.Main.C = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_B:
-                regs.Main.C = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_C:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_D:
-                regs.Main.C = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_E:
-                regs.Main.C = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_H:
-                regs.Main.C = regs.Main.H;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_L:
-                regs.Main.C = regs.Main.L;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_A:
-                regs.Main.D = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_B:
-                regs.Main.D = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_C:
-                regs.Main.D = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_D:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_E:
-                regs.Main.D = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_H:
-                regs.Main.D = regs.Main.H;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_L:
-                regs.Main.D = regs.Main.L;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_A:
-                regs.Main.E = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_B:
-                regs.Main.E = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_C:
-                regs.Main.E = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_D:
-                regs.Main.E = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_E:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_H:
-                regs.Main.E = regs.Main.H;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_L:
-                regs.Main.E = regs.Main.L;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_A:
-                regs.Main.H = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_B:
-                regs.Main.H = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_C:
-                regs.Main.H = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_D:
-                regs.Main.H = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_E:
-                regs.Main.H = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_H:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_L:
-                regs.Main.H = regs.Main.L;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_A:
-                regs.Main.L = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_B:
-                regs.Main.L = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_C:
-                regs.Main.L = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_D:
-                regs.Main.L = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_E:
-                regs.Main.L = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_H:
-                regs.Main.L = regs.Main.H;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_L:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_addrHL:
-                regs.Main.A = MainMemory.Peek(regs.Main.HL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_addrHL:
-                regs.Main.B = MainMemory.Peek(regs.Main.HL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_addrHL:
-                regs.Main.C = MainMemory.Peek(regs.Main.HL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_addrHL:
-                regs.Main.D = MainMemory.Peek(regs.Main.HL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_addrHL:
-                regs.Main.E = MainMemory.Peek(regs.Main.HL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_addrHL:
-                regs.Main.H = MainMemory.Peek(regs.Main.HL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_addrHL:
-                regs.Main.L = MainMemory.Peek(regs.Main.HL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_addrIXplus_d:
-                regs.Main.A =
-                    MainMemory.Peek(regs.IXPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_addrIYplus_d:
-                regs.Main.A =
-                    MainMemory.Peek(regs.IYPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_addrIXplus_d:
-                regs.Main.B =
-                    MainMemory.Peek(regs.IXPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_addrIYplus_d:
-                regs.Main.B =
-                    MainMemory.Peek(regs.IYPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_addrIXplus_d:
-                regs.Main.C =
-                    MainMemory.Peek(regs.IXPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_addrIYplus_d:
-                regs.Main.C =
-                    MainMemory.Peek(regs.IYPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_addrIXplus_d:
-                regs.Main.D =
-                    MainMemory.Peek(regs.IXPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_addrIYplus_d:
-                regs.Main.D =
-                    MainMemory.Peek(regs.IYPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_addrIXplus_d:
-                regs.Main.E =
-                    MainMemory.Peek(regs.IXPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_addrIYplus_d:
-                regs.Main.E =
-                    MainMemory.Peek(regs.IYPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_addrIXplus_d:
-                regs.Main.H =
-                    MainMemory.Peek(regs.IXPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_H_addrIYplus_d:
-                regs.Main.H =
-                    MainMemory.Peek(regs.IYPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_addrIXplus_d:
-                regs.Main.L =
-                    MainMemory.Peek(regs.IXPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_L_addrIYplus_d:
-                regs.Main.L =
-                    MainMemory.Peek(regs.IYPlusD(imm8));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IX_nn:
-                regs.IX = MainMemory.PeekWord(valueAddress);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IY_nn:
-                regs.IY = MainMemory.PeekWord(valueAddress);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IX_addr:
-                regs.IX = MainMemory.PeekWord(MainMemory.PeekWord(valueAddress));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IY_addr:
-                regs.IY = MainMemory.PeekWord(MainMemory.PeekWord(valueAddress));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrHL_n:
-                MainMemory.Poke(regs.Main.HL, imm8);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrHL_A:
-                MainMemory.Poke(regs.Main.HL, regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrHL_B:
-                MainMemory.Poke(regs.Main.HL, regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrHL_C:
-                MainMemory.Poke(regs.Main.HL, regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrHL_D:
-                MainMemory.Poke(regs.Main.HL, regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrHL_E:
-                MainMemory.Poke(regs.Main.HL, regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrHL_H:
-                MainMemory.Poke(regs.Main.HL, regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrHL_L:
-                MainMemory.Poke(regs.Main.HL, regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIXplus_d_n:
-                MainMemory.Poke(regs.IXPlusD(imm8), MainMemory.Peek((ushort)(valueAddress + 1)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIYplus_d_n:
-                MainMemory.Poke(regs.IYPlusD(imm8), MainMemory.Peek((ushort)(valueAddress + 1)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIXplus_d_A:
-                MainMemory.Poke(regs.IXPlusD(imm8), regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIXplus_d_B:
-                MainMemory.Poke(regs.IXPlusD(imm8), regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIXplus_d_C:
-                MainMemory.Poke(regs.IXPlusD(imm8), regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIXplus_d_D:
-                MainMemory.Poke(regs.IXPlusD(imm8), regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIXplus_d_E:
-                MainMemory.Poke(regs.IXPlusD(imm8), regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIXplus_d_H:
-                MainMemory.Poke(regs.IXPlusD(imm8), regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIXplus_d_L:
-                MainMemory.Poke(regs.IXPlusD(imm8), regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIYplus_d_A:
-                MainMemory.Poke(regs.IYPlusD(imm8), regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIYplus_d_B:
-                MainMemory.Poke(regs.IYPlusD(imm8), regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIYplus_d_C:
-                MainMemory.Poke(regs.IYPlusD(imm8), regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIYplus_d_D:
-                MainMemory.Poke(regs.IYPlusD(imm8), regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIYplus_d_E:
-                MainMemory.Poke(regs.IYPlusD(imm8), regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIYplus_d_H:
-                MainMemory.Poke(regs.IYPlusD(imm8), regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrIYplus_d_L:
-                MainMemory.Poke(regs.IYPlusD(imm8), regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_addrBC:
-                regs.Main.A = MainMemory.Peek(regs.Main.BC);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_addrDE:
-                regs.Main.A = MainMemory.Peek(regs.Main.DE);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrBC_A:
-                MainMemory.Poke(regs.Main.BC, regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrDE_A:
-                MainMemory.Poke(regs.Main.DE, regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addr_A:
-                MainMemory.Poke(MainMemory.PeekWord(valueAddress), regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_I:
-                regs.Main.A = regs.I;
-                regs.SignFlag = !Alu.IsBytePositive(regs.I);
-                regs.ZeroFlag = regs.I == 0;
-                regs.HalfCarryFlag = false;
-                regs.ParityFlag = regs.IFF2;
-                regs.SubtractFlag = false;
-                regs.SetFlags53FromA();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_R:
-                regs.Main.A = regs.R;
-                regs.SignFlag = !Alu.IsBytePositive(regs.R);
-                regs.ZeroFlag = regs.R == 0;
-                regs.HalfCarryFlag = false;
-                regs.ParityFlag = regs.IFF2;
-                regs.SubtractFlag = false;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_I_A:
-                regs.I = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_R_A:
-                regs.R = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_BC_nn:
-                regs.Main.BC = MainMemory.PeekWord(valueAddress);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_DE_nn:
-                regs.Main.DE = MainMemory.PeekWord(valueAddress);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_HL_nn:
-                regs.Main.HL = MainMemory.PeekWord(valueAddress);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_SP_nn:
-                regs.SP = MainMemory.PeekWord(valueAddress);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_BC_addr:
-                regs.Main.BC = MainMemory.PeekWord(MainMemory.PeekWord(valueAddress));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_DE_addr:
-                regs.Main.DE = MainMemory.PeekWord(MainMemory.PeekWord(valueAddress));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_HL_addr:
-                regs.Main.HL = MainMemory.PeekWord(MainMemory.PeekWord(valueAddress));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_SP_addr:
-                regs.SP = MainMemory.PeekWord(MainMemory.PeekWord(valueAddress));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addr_BC:
-                MainMemory.Poke(MainMemory.PeekWord(valueAddress), regs.Main.BC);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addr_DE:
-                MainMemory.Poke(MainMemory.PeekWord(valueAddress), regs.Main.DE);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addrHL:
-                MainMemory.Poke(MainMemory.PeekWord(valueAddress), regs.Main.HL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addr_SP:
-                MainMemory.Poke(MainMemory.PeekWord(valueAddress), regs.SP);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addr_IX:
-                MainMemory.Poke(MainMemory.PeekWord(valueAddress), regs.IX);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_addr_IY:
-                MainMemory.Poke(MainMemory.PeekWord(valueAddress), regs.IY);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_SP_HL:
-                regs.SP = regs.Main.HL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_SP_IX:
-                regs.SP = regs.IX;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_SP_IY:
-                regs.SP = regs.IY;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.PUSH_AF:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.Main.AF);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.PUSH_BC:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.Main.BC);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.PUSH_DE:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.Main.DE);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.PUSH_HL:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.Main.HL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.PUSH_IX:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.IX);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.PUSH_IY:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.IY);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.POP_AF:
-                regs.Main.AF = MainMemory.PeekWord(regs.SP);
-                regs.SP += 2;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.POP_BC:
-                regs.Main.BC = MainMemory.PeekWord(regs.SP);
-                regs.SP += 2;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.POP_DE:
-                regs.Main.DE = MainMemory.PeekWord(regs.SP);
-                regs.SP += 2;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.POP_HL:
-                regs.Main.HL = MainMemory.PeekWord(regs.SP);
-                regs.SP += 2;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.POP_IX:
-                regs.IX = MainMemory.PeekWord(regs.SP);
-                regs.SP += 2;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.POP_IY:
-                regs.IY = MainMemory.PeekWord(regs.SP);
-                regs.SP += 2;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.EX_DE_HL:
-            {
-                (regs.Main.DE, regs.Main.HL) = (regs.Main.HL, regs.Main.DE);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.EX_AF_altAF:
-            {
-                (regs.Main.AF, regs.Alt.AF) = (regs.Alt.AF, regs.Main.AF);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.EXX:
-                regs.ExchangeRegisterSet();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.EX_addrSP_HL:
-            {
-                var v = regs.Main.HL;
-                regs.Main.HL = MainMemory.PeekWord(regs.SP);
-                MainMemory.Poke(regs.SP, v);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.EX_addrSP_IX:
-            {
-                var v = regs.IX;
-                regs.IX = MainMemory.PeekWord(regs.SP);
-                MainMemory.Poke(regs.SP, v);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.EX_addrSP_IY:
-            {
-                var v = regs.IY;
-                regs.IY = MainMemory.PeekWord(regs.SP);
-                MainMemory.Poke(regs.SP, v);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.LDD:
-                doLDD();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LDDR:
-            {
-                doLDD();
-                if (regs.Main.BC != 0)
-                    regs.PC -= 2;
-                return regs.Main.BC != 0 ? 21 : 16;
-            }
-            case Z80Instructions.InstructionID.LDI:
-                doLDI();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LDIR:
-            {
-                doLDI();
-                if (regs.Main.BC != 0)
-                    regs.PC -= 2;
-                return regs.Main.BC != 0 ? 21 : 16;
-            }
-            case Z80Instructions.InstructionID.CPD:
-                doCPD();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CPDR:
-            {
-                doCPD();
-                if (!regs.ZeroFlag && regs.Main.BC != 0)
-                    regs.PC -= 2;
-                regs.ParityFlag = regs.Main.BC != 0;
-                return regs.Main.BC != 0 ? 21 : 16;
-            }
-            case Z80Instructions.InstructionID.CPI:
-                doCPI();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CPIR:
-            {
-                doCPI();
-                if (!regs.ZeroFlag && regs.Main.BC != 0)
-                    regs.PC -= 2;
-                regs.ParityFlag = regs.Main.BC != 0;
-                return regs.Main.BC != 0 && regs.Main.A != MainMemory.Peek(regs.Main.HL) ? 21 : 16;
-            }
-            case Z80Instructions.InstructionID.ADC_A_n:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, imm8, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_A:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.A, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_B:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.B, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_C:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.C, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_D:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.D, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_E:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.E, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_H:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.H, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_L:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.L, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_addrHL:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, MainMemory.Peek(regs.Main.HL), true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_addrIXplus_d:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, MainMemory.Peek(regs.IXPlusD(imm8)), true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_addrIYplus_d:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, MainMemory.Peek(regs.IYPlusD(imm8)), true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_n:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, imm8, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_A:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.A, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_B:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.B, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_C:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.C, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_D:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.D, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_E:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.E, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_H:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.H, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_L:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.Main.L, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_addrHL:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, MainMemory.Peek(regs.Main.HL), false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_addrIXplus_d:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, MainMemory.Peek(regs.IXPlusD(imm8)), false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_addrIYplus_d:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, MainMemory.Peek(regs.IYPlusD(imm8)), false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_A:
-                regs.Main.A = TheAlu.DecAndSetFlags(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_B:
-                regs.Main.B = TheAlu.DecAndSetFlags(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_C:
-                regs.Main.C = TheAlu.DecAndSetFlags(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_D:
-                regs.Main.D = TheAlu.DecAndSetFlags(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_E:
-                regs.Main.E = TheAlu.DecAndSetFlags(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_H:
-                regs.Main.H = TheAlu.DecAndSetFlags(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_L:
-                regs.Main.L = TheAlu.DecAndSetFlags(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.DecAndSetFlags(MainMemory.Peek(regs.Main.HL)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_addrIXplus_d:
-                MainMemory.Poke(regs.IXPlusD(imm8), TheAlu.DecAndSetFlags(MainMemory.Peek(regs.IXPlusD(imm8))));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_addrIYplus_d:
-                MainMemory.Poke(regs.IYPlusD(imm8), TheAlu.DecAndSetFlags(MainMemory.Peek(regs.IYPlusD(imm8))));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_A:
-                regs.Main.A = TheAlu.IncAndSetFlags(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_B:
-                regs.Main.B = TheAlu.IncAndSetFlags(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_C:
-                regs.Main.C = TheAlu.IncAndSetFlags(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_D:
-                regs.Main.D = TheAlu.IncAndSetFlags(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_E:
-                regs.Main.E = TheAlu.IncAndSetFlags(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_H:
-                regs.Main.H = TheAlu.IncAndSetFlags(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_L:
-                regs.Main.L = TheAlu.IncAndSetFlags(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.IncAndSetFlags(MainMemory.Peek(regs.Main.HL)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_addrIXplus_d:
-                MainMemory.Poke(regs.IXPlusD(imm8), TheAlu.IncAndSetFlags(MainMemory.Peek(regs.IXPlusD(imm8))));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_addrIYplus_d:
-                MainMemory.Poke(regs.IYPlusD(imm8), TheAlu.IncAndSetFlags(MainMemory.Peek(regs.IYPlusD(imm8))));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_n:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, imm8, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_A:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.A, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_B:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.B, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_C:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.C, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_D:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.D, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_E:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.E, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_H:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.H, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_L:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.L, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_addrHL:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, MainMemory.Peek(regs.Main.HL), true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_addrIXplus_d:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, MainMemory.Peek(regs.IXPlusD(imm8)), true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_addrIYplus_d:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, MainMemory.Peek(regs.IYPlusD(imm8)), true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_n:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, imm8, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_A:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.A, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_B:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.B, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_C:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.C, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_D:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.D, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_E:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.E, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_H:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.H, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_L:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.L, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_addrHL:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, MainMemory.Peek(regs.Main.HL), false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_addrIXplus_d:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, MainMemory.Peek(regs.IXPlusD(imm8)), false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_addrIYplus_d:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, MainMemory.Peek(regs.IYPlusD(imm8)), false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_HL_BC:
-                regs.Main.HL = TheAlu.AddAndSetFlags(regs.Main.HL, regs.Main.BC, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_HL_DE:
-                regs.Main.HL = TheAlu.AddAndSetFlags(regs.Main.HL, regs.Main.DE, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_HL_HL:
-                regs.Main.HL = TheAlu.AddAndSetFlags(regs.Main.HL, regs.Main.HL, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_HL_SP:
-                regs.Main.HL = TheAlu.AddAndSetFlags(regs.Main.HL, regs.SP, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_HL_BC:
-                regs.Main.HL = TheAlu.SubtractAndSetFlags(regs.Main.HL, regs.Main.BC, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_HL_DE:
-                regs.Main.HL = TheAlu.SubtractAndSetFlags(regs.Main.HL, regs.Main.DE, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_HL_HL:
-                regs.Main.HL = TheAlu.SubtractAndSetFlags(regs.Main.HL, regs.Main.HL, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_HL_SP:
-                regs.Main.HL = TheAlu.SubtractAndSetFlags(regs.Main.HL, regs.SP, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_HL_BC:
-                regs.Main.HL = TheAlu.AddAndSetFlags(regs.Main.HL, regs.Main.BC, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_HL_DE:
-                regs.Main.HL = TheAlu.AddAndSetFlags(regs.Main.HL, regs.Main.DE, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_HL_HL:
-                regs.Main.HL = TheAlu.AddAndSetFlags(regs.Main.HL, regs.Main.HL, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_HL_SP:
-                regs.Main.HL = TheAlu.AddAndSetFlags(regs.Main.HL, regs.SP, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_IX_BC:
-                regs.IX = TheAlu.AddAndSetFlags(regs.IX, regs.Main.BC, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_IX_DE:
-                regs.IX = TheAlu.AddAndSetFlags(regs.IX, regs.Main.DE, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_IX_IX:
-                regs.IX = TheAlu.AddAndSetFlags(regs.IX, regs.IX, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_IX_SP:
-                regs.IX = TheAlu.AddAndSetFlags(regs.IX, regs.SP, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_IY_BC:
-                regs.IY = TheAlu.AddAndSetFlags(regs.IY, regs.Main.BC, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_IY_DE:
-                regs.IY = TheAlu.AddAndSetFlags(regs.IY, regs.Main.DE, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_IY_IY:
-                regs.IY = TheAlu.AddAndSetFlags(regs.IY, regs.IY, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_IY_SP:
-                regs.IY = TheAlu.AddAndSetFlags(regs.IY, regs.SP, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_BC:
-                regs.Main.BC = (ushort)(regs.Main.BC - 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_DE:
-                regs.Main.DE = (ushort)(regs.Main.DE - 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_HL:
-                regs.Main.HL = (ushort)(regs.Main.HL - 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_SP:
-                regs.SP = (ushort)(regs.SP - 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_IX:
-                regs.IX--;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_IY:
-                regs.IY--;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_BC:
-                regs.Main.BC++;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_DE:
-                regs.Main.DE++;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_HL:
-                regs.Main.HL++;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_SP:
-                regs.SP++;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_IX:
-                regs.IX++;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_IY:
-                regs.IY++;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_n:
-                TheAlu.And(imm8);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_A:
-                TheAlu.And(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_B:
-                TheAlu.And(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_C:
-                TheAlu.And(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_D:
-                TheAlu.And(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_E:
-                TheAlu.And(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_H:
-                TheAlu.And(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_L:
-                TheAlu.And(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_addrHL:
-                TheAlu.And(MainMemory.Peek(regs.Main.HL));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_addrIX_plus_d:
-                TheAlu.And(MainMemory.Peek(regs.IXPlusD(imm8)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_addrIY_plus_d:
-                TheAlu.And(MainMemory.Peek(regs.IYPlusD(imm8)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_n:
-            {
-                TheAlu.SubtractAndSetFlags(regs.Main.A, imm8, false);
-                regs.SetFlags53From(imm8);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.CP_A:
-            {
-                var a = regs.Main.A;
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.A, false);
-                regs.SetFlags53From(a);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.CP_B:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.B, false);
-                regs.SetFlags53From(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_C:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.C, false);
-                regs.SetFlags53From(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_D:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.D, false);
-                regs.SetFlags53From(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_E:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.E, false);
-                regs.SetFlags53From(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_H:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.H, false);
-                regs.SetFlags53From(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_L:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.Main.L, false);
-                regs.SetFlags53From(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_addrHL:
-            {
-                var b = MainMemory.Peek(regs.Main.HL);
-                TheAlu.SubtractAndSetFlags(regs.Main.A, b, false);
-                regs.SetFlags53From(b);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.CP_addrIX_plus_d:
-            {
-                var v = MainMemory.Peek(regs.IXPlusD(imm8));
-                TheAlu.SubtractAndSetFlags(regs.Main.A, v, false);
-                regs.SetFlags53From(v);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.CP_addrIY_plus_d:
-            {
-                var v = MainMemory.Peek(regs.IYPlusD(imm8));
-                TheAlu.SubtractAndSetFlags(regs.Main.A, v, false);
-                regs.SetFlags53From(v);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.OR_n:
-                TheAlu.Or(imm8);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_A:
-                TheAlu.Or(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_B:
-                TheAlu.Or(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_C:
-                TheAlu.Or(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_D:
-                TheAlu.Or(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_E:
-                TheAlu.Or(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_H:
-                TheAlu.Or(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_L:
-                TheAlu.Or(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_addrHL:
-                TheAlu.Or(MainMemory.Peek(regs.Main.HL));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_addrIX_plus_d:
-                TheAlu.Or(MainMemory.Peek(regs.IXPlusD(imm8)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_addrIY_plus_d:
-                TheAlu.Or(MainMemory.Peek(regs.IYPlusD(imm8)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_n:
-                TheAlu.Xor(imm8);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_A:
-                TheAlu.Xor(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_B:
-                TheAlu.Xor(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_C:
-                TheAlu.Xor(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_D:
-                TheAlu.Xor(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_E:
-                TheAlu.Xor(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_H:
-                TheAlu.Xor(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_L:
-                TheAlu.Xor(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_addrHL:
-                TheAlu.Xor(MainMemory.Peek(regs.Main.HL));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_addrIX_plus_d:
-                TheAlu.Xor(MainMemory.Peek(regs.IXPlusD(imm8)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_addrIY_plus_d:
-                TheAlu.Xor(MainMemory.Peek(regs.IYPlusD(imm8)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CCF:
-                regs.HalfCarryFlag = regs.CarryFlag;
-                regs.CarryFlag = !regs.CarryFlag;
-                regs.SubtractFlag = false;
-                regs.SetFlags53From(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CPL:
-                regs.HalfCarryFlag = true;
-                regs.SubtractFlag = true;
-                regs.Main.A = (byte)~regs.Main.A;
-                regs.SetFlags53From(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DAA:
-                TheAlu.AdjustAccumulatorToBcd();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.EI:
-                regs.IFF1 = regs.IFF2 = true;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DI:
-                regs.IFF1 = regs.IFF2 = false;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.HALT:
-                IsHalted = true;
-                regs.PC--;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IM0:
-                regs.IM = 0;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IM1:
-                regs.IM = 1;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IM2:
-                regs.IM = 2;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.NEG:
-            {
-                var newA = TheAlu.SubtractAndSetFlags((byte)0x00, regs.Main.A, false);
-                regs.ParityFlag = regs.Main.A == 0x80;
-                regs.CarryFlag = regs.Main.A != 0x00;
-                regs.Main.A = newA;
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.SCF:
-                regs.HalfCarryFlag = false;
-                regs.CarryFlag = true;
-                regs.SubtractFlag = false;
-                regs.SetFlags53FromA();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RL_A:
-                regs.Main.A = TheAlu.RotateLeft(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RL_B:
-                regs.Main.B = TheAlu.RotateLeft(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RL_C:
-                regs.Main.C = TheAlu.RotateLeft(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RL_D:
-                regs.Main.D = TheAlu.RotateLeft(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RL_E:
-                regs.Main.E = TheAlu.RotateLeft(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RL_H:
-                regs.Main.H = TheAlu.RotateLeft(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RL_L:
-                regs.Main.L = TheAlu.RotateLeft(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RL_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.RotateLeft(MainMemory.Peek(regs.Main.HL)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLA:
-            {
-                var b = regs.Main.A;
-                var oldHighBit = (byte)(b & 0x80);
-                var oldCarry = (byte)(TheAlu.TheRegisters.CarryFlag ? 1 : 0);
-                b <<= 1;
-                b |= oldCarry;
-                TheAlu.TheRegisters.HalfCarryFlag = false;
-                TheAlu.TheRegisters.SubtractFlag = false;
-                TheAlu.TheRegisters.CarryFlag = oldHighBit != 0x00;
-                regs.Main.A = b;
-                regs.SetFlags53From(b);
-
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.RLC_A:
-                regs.Main.A = TheAlu.RotateLeftCircular(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLC_B:
-                regs.Main.B = TheAlu.RotateLeftCircular(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLC_C:
-                regs.Main.C = TheAlu.RotateLeftCircular(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLC_D:
-                regs.Main.D = TheAlu.RotateLeftCircular(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLC_E:
-                regs.Main.E = TheAlu.RotateLeftCircular(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLC_H:
-                regs.Main.H = TheAlu.RotateLeftCircular(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLC_L:
-                regs.Main.L = TheAlu.RotateLeftCircular(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLCA:
-                regs.CarryFlag = (regs.Main.A & 0x80) != 0x00;
-                regs.Main.A = (byte)((regs.Main.A << 1) + (regs.Main.A >> 7));
-                regs.HalfCarryFlag = false;
-                regs.SubtractFlag = false;
-                regs.SetFlags53From(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLC_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.RotateLeftCircular(MainMemory.Peek(regs.Main.HL)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RR_A:
-                regs.Main.A = TheAlu.RotateRight(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RR_B:
-                regs.Main.B = TheAlu.RotateRight(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RR_C:
-                regs.Main.C = TheAlu.RotateRight(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RR_D:
-                regs.Main.D = TheAlu.RotateRight(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RR_E:
-                regs.Main.E = TheAlu.RotateRight(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RR_H:
-                regs.Main.H = TheAlu.RotateRight(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RR_L:
-                regs.Main.L = TheAlu.RotateRight(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RR_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.RotateRight(MainMemory.Peek(regs.Main.HL)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RRA:
-            {
-                var oldCarry = (byte)(regs.CarryFlag ? 1 : 0);
-                regs.CarryFlag = (regs.Main.A & 0x01) != 0x00;
-                regs.Main.A = (byte)((regs.Main.A >> 1) + (oldCarry << 7));
-                regs.HalfCarryFlag = false;
-                regs.SubtractFlag = false;
-                regs.SetFlags53From(regs.Main.A);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.RRC_A:
-                regs.Main.A = TheAlu.RotateRightCircular(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RRC_B:
-                regs.Main.B = TheAlu.RotateRightCircular(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RRC_C:
-                regs.Main.C = TheAlu.RotateRightCircular(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RRC_D:
-                regs.Main.D = TheAlu.RotateRightCircular(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RRC_E:
-                regs.Main.E = TheAlu.RotateRightCircular(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RRC_H:
-                regs.Main.H = TheAlu.RotateRightCircular(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RRC_L:
-                regs.Main.L = TheAlu.RotateRightCircular(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RRC_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.RotateRightCircular(MainMemory.Peek(regs.Main.HL)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RRCA:
-            {
-                regs.CarryFlag = (regs.Main.A & 0x01) != 0x00;
-                var v = (byte)((regs.Main.A >> 1) + ((regs.Main.A & 0x01) << 7));
-                regs.Main.A = v;
-                regs.HalfCarryFlag = false;
-                regs.SubtractFlag = false;
-                regs.SetFlags53From(v);
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.SLA_A:
-                regs.Main.A = TheAlu.ShiftLeft(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLA_B:
-                regs.Main.B = TheAlu.ShiftLeft(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLA_C:
-                regs.Main.C = TheAlu.ShiftLeft(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLA_D:
-                regs.Main.D = TheAlu.ShiftLeft(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLA_E:
-                regs.Main.E = TheAlu.ShiftLeft(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLA_H:
-                regs.Main.H = TheAlu.ShiftLeft(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLA_L:
-                regs.Main.L = TheAlu.ShiftLeft(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLA_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.ShiftLeft(MainMemory.Peek(regs.Main.HL)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLL_A:
-                regs.Main.A = TheAlu.ShiftLeft(regs.Main.A, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLL_B:
-                regs.Main.B = TheAlu.ShiftLeft(regs.Main.B, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLL_C:
-                regs.Main.C = TheAlu.ShiftLeft(regs.Main.C, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLL_D:
-                regs.Main.D = TheAlu.ShiftLeft(regs.Main.D, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLL_E:
-                regs.Main.E = TheAlu.ShiftLeft(regs.Main.E, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLL_H:
-                regs.Main.H = TheAlu.ShiftLeft(regs.Main.H, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLL_L:
-                regs.Main.L = TheAlu.ShiftLeft(regs.Main.L, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SLL_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.ShiftLeft(MainMemory.Peek(regs.Main.HL), 1));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRA_A:
-                regs.Main.A = TheAlu.ShiftRightArithmetic(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRA_B:
-                regs.Main.B = TheAlu.ShiftRightArithmetic(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRA_C:
-                regs.Main.C = TheAlu.ShiftRightArithmetic(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRA_D:
-                regs.Main.D = TheAlu.ShiftRightArithmetic(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRA_E:
-                regs.Main.E = TheAlu.ShiftRightArithmetic(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRA_H:
-                regs.Main.H = TheAlu.ShiftRightArithmetic(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRA_L:
-                regs.Main.L = TheAlu.ShiftRightArithmetic(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRA_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.ShiftRightArithmetic(MainMemory.Peek(regs.Main.HL)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRL_A:
-                regs.Main.A = TheAlu.ShiftRightLogical(regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRL_B:
-                regs.Main.B = TheAlu.ShiftRightLogical(regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRL_C:
-                regs.Main.C = TheAlu.ShiftRightLogical(regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRL_D:
-                regs.Main.D = TheAlu.ShiftRightLogical(regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRL_E:
-                regs.Main.E = TheAlu.ShiftRightLogical(regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRL_H:
-                regs.Main.H = TheAlu.ShiftRightLogical(regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRL_L:
-                regs.Main.L = TheAlu.ShiftRightLogical(regs.Main.L);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SRL_addrHL:
-                MainMemory.Poke(regs.Main.HL, TheAlu.ShiftRightLogical(MainMemory.Peek(regs.Main.HL)));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_0_A:
-                doBitTest(regs.Main.A, 0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_1_A:
-                doBitTest(regs.Main.A, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_2_A:
-                doBitTest(regs.Main.A, 2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_3_A:
-                doBitTest(regs.Main.A, 3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_4_A:
-                doBitTest(regs.Main.A, 4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_5_A:
-                doBitTest(regs.Main.A, 5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_6_A:
-                doBitTest(regs.Main.A, 6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_7_A:
-                doBitTest(regs.Main.A, 7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_0_B:
-                doBitTest(regs.Main.B, 0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_1_B:
-                doBitTest(regs.Main.B, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_2_B:
-                doBitTest(regs.Main.B, 2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_3_B:
-                doBitTest(regs.Main.B, 3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_4_B:
-                doBitTest(regs.Main.B, 4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_5_B:
-                doBitTest(regs.Main.B, 5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_6_B:
-                doBitTest(regs.Main.B, 6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_7_B:
-                doBitTest(regs.Main.B, 7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_0_C:
-                doBitTest(regs.Main.C, 0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_1_C:
-                doBitTest(regs.Main.C, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_2_C:
-                doBitTest(regs.Main.C, 2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_3_C:
-                doBitTest(regs.Main.C, 3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_4_C:
-                doBitTest(regs.Main.C, 4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_5_C:
-                doBitTest(regs.Main.C, 5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_6_C:
-                doBitTest(regs.Main.C, 6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_7_C:
-                doBitTest(regs.Main.C, 7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_0_D:
-                doBitTest(regs.Main.D, 0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_1_D:
-                doBitTest(regs.Main.D, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_2_D:
-                doBitTest(regs.Main.D, 2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_3_D:
-                doBitTest(regs.Main.D, 3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_4_D:
-                doBitTest(regs.Main.D, 4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_5_D:
-                doBitTest(regs.Main.D, 5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_6_D:
-                doBitTest(regs.Main.D, 6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_7_D:
-                doBitTest(regs.Main.D, 7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_0_E:
-                doBitTest(regs.Main.E, 0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_1_E:
-                doBitTest(regs.Main.E, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_2_E:
-                doBitTest(regs.Main.E, 2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_3_E:
-                doBitTest(regs.Main.E, 3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_4_E:
-                doBitTest(regs.Main.E, 4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_5_E:
-                doBitTest(regs.Main.E, 5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_6_E:
-                doBitTest(regs.Main.E, 6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_7_E:
-                doBitTest(regs.Main.E, 7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_0_H:
-                doBitTest(regs.Main.H, 0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_1_H:
-                doBitTest(regs.Main.H, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_2_H:
-                doBitTest(regs.Main.H, 2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_3_H:
-                doBitTest(regs.Main.H, 3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_4_H:
-                doBitTest(regs.Main.H, 4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_5_H:
-                doBitTest(regs.Main.H, 5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_6_H:
-                doBitTest(regs.Main.H, 6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_7_H:
-                doBitTest(regs.Main.H, 7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_0_L:
-                doBitTest(regs.Main.L, 0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_1_L:
-                doBitTest(regs.Main.L, 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_2_L:
-                doBitTest(regs.Main.L, 2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_3_L:
-                doBitTest(regs.Main.L, 3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_4_L:
-                doBitTest(regs.Main.L, 4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_5_L:
-                doBitTest(regs.Main.L, 5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_6_L:
-                doBitTest(regs.Main.L, 6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_7_L:
-                doBitTest(regs.Main.L, 7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_0_addrHL:
-                doBitTest(MainMemory.Peek(regs.Main.HL), 0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_1_addrHL:
-                doBitTest(MainMemory.Peek(regs.Main.HL), 1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_2_addrHL:
-                doBitTest(MainMemory.Peek(regs.Main.HL), 2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_3_addrHL:
-                doBitTest(MainMemory.Peek(regs.Main.HL), 3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_4_addrHL:
-                doBitTest(MainMemory.Peek(regs.Main.HL), 4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_5_addrHL:
-                doBitTest(MainMemory.Peek(regs.Main.HL), 5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_6_addrHL:
-                doBitTest(MainMemory.Peek(regs.Main.HL), 6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.BIT_7_addrHL:
-                doBitTest(MainMemory.Peek(regs.Main.HL), 7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_0_A:
-                regs.Main.A = regs.Main.A.ResetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_1_A:
-                regs.Main.A = regs.Main.A.ResetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_2_A:
-                regs.Main.A = regs.Main.A.ResetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_3_A:
-                regs.Main.A = regs.Main.A.ResetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_4_A:
-                regs.Main.A = regs.Main.A.ResetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_5_A:
-                regs.Main.A = regs.Main.A.ResetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_6_A:
-                regs.Main.A = regs.Main.A.ResetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_7_A:
-                regs.Main.A = regs.Main.A.ResetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_0_B:
-                regs.Main.B = regs.Main.B.ResetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_1_B:
-                regs.Main.B = regs.Main.B.ResetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_2_B:
-                regs.Main.B = regs.Main.B.ResetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_3_B:
-                regs.Main.B = regs.Main.B.ResetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_4_B:
-                regs.Main.B = regs.Main.B.ResetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_5_B:
-                regs.Main.B = regs.Main.B.ResetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_6_B:
-                regs.Main.B = regs.Main.B.ResetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_7_B:
-                regs.Main.B = regs.Main.B.ResetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_0_C:
-                regs.Main.C = regs.Main.C.ResetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_1_C:
-                regs.Main.C = regs.Main.C.ResetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_2_C:
-                regs.Main.C = regs.Main.C.ResetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_3_C:
-                regs.Main.C = regs.Main.C.ResetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_4_C:
-                regs.Main.C = regs.Main.C.ResetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_5_C:
-                regs.Main.C = regs.Main.C.ResetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_6_C:
-                regs.Main.C = regs.Main.C.ResetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_7_C:
-                regs.Main.C = regs.Main.C.ResetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_0_D:
-                regs.Main.D = regs.Main.D.ResetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_1_D:
-                regs.Main.D = regs.Main.D.ResetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_2_D:
-                regs.Main.D = regs.Main.D.ResetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_3_D:
-                regs.Main.D = regs.Main.D.ResetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_4_D:
-                regs.Main.D = regs.Main.D.ResetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_5_D:
-                regs.Main.D = regs.Main.D.ResetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_6_D:
-                regs.Main.D = regs.Main.D.ResetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_7_D:
-                regs.Main.D = regs.Main.D.ResetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_0_E:
-                regs.Main.E = regs.Main.E.ResetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_1_E:
-                regs.Main.E = regs.Main.E.ResetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_2_E:
-                regs.Main.E = regs.Main.E.ResetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_3_E:
-                regs.Main.E = regs.Main.E.ResetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_4_E:
-                regs.Main.E = regs.Main.E.ResetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_5_E:
-                regs.Main.E = regs.Main.E.ResetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_6_E:
-                regs.Main.E = regs.Main.E.ResetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_7_E:
-                regs.Main.E = regs.Main.E.ResetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_0_H:
-                regs.Main.H = regs.Main.H.ResetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_1_H:
-                regs.Main.H = regs.Main.H.ResetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_2_H:
-                regs.Main.H = regs.Main.H.ResetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_3_H:
-                regs.Main.H = regs.Main.H.ResetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_4_H:
-                regs.Main.H = regs.Main.H.ResetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_5_H:
-                regs.Main.H = regs.Main.H.ResetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_6_H:
-                regs.Main.H = regs.Main.H.ResetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_7_H:
-                regs.Main.H = regs.Main.H.ResetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_0_L:
-                regs.Main.L = regs.Main.L.ResetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_1_L:
-                regs.Main.L = regs.Main.L.ResetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_2_L:
-                regs.Main.L = regs.Main.L.ResetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_3_L:
-                regs.Main.L = regs.Main.L.ResetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_4_L:
-                regs.Main.L = regs.Main.L.ResetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_5_L:
-                regs.Main.L = regs.Main.L.ResetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_6_L:
-                regs.Main.L = regs.Main.L.ResetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_7_L:
-                regs.Main.L = regs.Main.L.ResetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_0_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).ResetBit(0));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_1_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).ResetBit(1));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_2_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).ResetBit(2));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_3_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).ResetBit(3));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_4_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).ResetBit(4));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_5_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).ResetBit(5));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_6_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).ResetBit(6));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_7_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).ResetBit(7));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RES_n_addrIX_plus_d:
-            {
-                var ixPlusD = regs.IXPlusD(imm8);
-                MainMemory.Poke(ixPlusD, MainMemory.Peek(ixPlusD).ResetBit(0));
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.SET_0_A:
-                regs.Main.A = regs.Main.A.SetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_1_A:
-                regs.Main.A = regs.Main.A.SetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_2_A:
-                regs.Main.A = regs.Main.A.SetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_3_A:
-                regs.Main.A = regs.Main.A.SetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_4_A:
-                regs.Main.A = regs.Main.A.SetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_5_A:
-                regs.Main.A = regs.Main.A.SetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_6_A:
-                regs.Main.A = regs.Main.A.SetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_7_A:
-                regs.Main.A = regs.Main.A.SetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_0_B:
-                regs.Main.B = regs.Main.B.SetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_1_B:
-                regs.Main.B = regs.Main.B.SetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_2_B:
-                regs.Main.B = regs.Main.B.SetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_3_B:
-                regs.Main.B = regs.Main.B.SetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_4_B:
-                regs.Main.B = regs.Main.B.SetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_5_B:
-                regs.Main.B = regs.Main.B.SetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_6_B:
-                regs.Main.B = regs.Main.B.SetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_7_B:
-                regs.Main.B = regs.Main.B.SetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_0_C:
-                regs.Main.C = regs.Main.C.SetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_1_C:
-                regs.Main.C = regs.Main.C.SetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_2_C:
-                regs.Main.C = regs.Main.C.SetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_3_C:
-                regs.Main.C = regs.Main.C.SetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_4_C:
-                regs.Main.C = regs.Main.C.SetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_5_C:
-                regs.Main.C = regs.Main.C.SetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_6_C:
-                regs.Main.C = regs.Main.C.SetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_7_C:
-                regs.Main.C = regs.Main.C.SetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_0_D:
-                regs.Main.D = regs.Main.D.SetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_1_D:
-                regs.Main.D = regs.Main.D.SetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_2_D:
-                regs.Main.D = regs.Main.D.SetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_3_D:
-                regs.Main.D = regs.Main.D.SetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_4_D:
-                regs.Main.D = regs.Main.D.SetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_5_D:
-                regs.Main.D = regs.Main.D.SetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_6_D:
-                regs.Main.D = regs.Main.D.SetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_7_D:
-                regs.Main.D = regs.Main.D.SetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_0_E:
-                regs.Main.E = regs.Main.E.SetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_1_E:
-                regs.Main.E = regs.Main.E.SetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_2_E:
-                regs.Main.E = regs.Main.E.SetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_3_E:
-                regs.Main.E = regs.Main.E.SetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_4_E:
-                regs.Main.E = regs.Main.E.SetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_5_E:
-                regs.Main.E = regs.Main.E.SetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_6_E:
-                regs.Main.E = regs.Main.E.SetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_7_E:
-                regs.Main.E = regs.Main.E.SetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_0_H:
-                regs.Main.H = regs.Main.H.SetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_1_H:
-                regs.Main.H = regs.Main.H.SetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_2_H:
-                regs.Main.H = regs.Main.H.SetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_3_H:
-                regs.Main.H = regs.Main.H.SetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_4_H:
-                regs.Main.H = regs.Main.H.SetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_5_H:
-                regs.Main.H = regs.Main.H.SetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_6_H:
-                regs.Main.H = regs.Main.H.SetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_7_H:
-                regs.Main.H = regs.Main.H.SetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_0_L:
-                regs.Main.L = regs.Main.L.SetBit(0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_1_L:
-                regs.Main.L = regs.Main.L.SetBit(1);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_2_L:
-                regs.Main.L = regs.Main.L.SetBit(2);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_3_L:
-                regs.Main.L = regs.Main.L.SetBit(3);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_4_L:
-                regs.Main.L = regs.Main.L.SetBit(4);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_5_L:
-                regs.Main.L = regs.Main.L.SetBit(5);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_6_L:
-                regs.Main.L = regs.Main.L.SetBit(6);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_7_L:
-                regs.Main.L = regs.Main.L.SetBit(7);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_0_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).SetBit(0));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_1_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).SetBit(1));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_2_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).SetBit(2));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_3_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).SetBit(3));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_4_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).SetBit(4));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_5_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).SetBit(5));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_6_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).SetBit(6));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SET_7_addrHL:
-                MainMemory.Poke(regs.Main.HL, MainMemory.Peek(regs.Main.HL).SetBit(7));
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CALL_nn:
-                CallIfTrue(MainMemory.PeekWord(valueAddress), true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CALL_NZ_nn:
-                return CallIfTrue(MainMemory.PeekWord(valueAddress), !regs.ZeroFlag) ? 17 : 10;
-            case Z80Instructions.InstructionID.CALL_Z_nn:
-                return CallIfTrue(MainMemory.PeekWord(valueAddress), regs.ZeroFlag) ? 17 : 10;
-            case Z80Instructions.InstructionID.CALL_NC_nn:
-                return CallIfTrue(MainMemory.PeekWord(valueAddress), !regs.CarryFlag) ? 17 : 10;
-            case Z80Instructions.InstructionID.CALL_C_nn:
-                return CallIfTrue(MainMemory.PeekWord(valueAddress), regs.CarryFlag) ? 17 : 10;
-            case Z80Instructions.InstructionID.CALL_PO_nn:
-                return CallIfTrue(MainMemory.PeekWord(valueAddress), !regs.ParityFlag) ? 17 : 10;
-            case Z80Instructions.InstructionID.CALL_PE_nn:
-                return CallIfTrue(MainMemory.PeekWord(valueAddress), regs.ParityFlag) ? 17 : 10;
-            case Z80Instructions.InstructionID.CALL_P_nn:
-                return CallIfTrue(MainMemory.PeekWord(valueAddress), !regs.SignFlag) ? 17 : 10;
-            case Z80Instructions.InstructionID.CALL_M_nn:
-                return CallIfTrue(MainMemory.PeekWord(valueAddress), regs.SignFlag) ? 17 : 10;
-            case Z80Instructions.InstructionID.CALL_DJNZ_n:
-                regs.Main.B--;
-                if (regs.Main.B == 0)
-                    return 8;
-                regs.PC = (ushort)(regs.PC + Alu.FromTwosCompliment(imm8));
-                return 13;
-            case Z80Instructions.InstructionID.JP_nn:
-                JumpIfTrue(MainMemory.PeekWord(valueAddress), true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_NZ_nn:
-                JumpIfTrue(MainMemory.PeekWord(valueAddress), !regs.ZeroFlag);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_Z_nn:
-                JumpIfTrue(MainMemory.PeekWord(valueAddress), regs.ZeroFlag);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_NC_nn:
-                JumpIfTrue(MainMemory.PeekWord(valueAddress), !regs.CarryFlag);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_C_nn:
-                JumpIfTrue(MainMemory.PeekWord(valueAddress), regs.CarryFlag);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_PO_nn:
-                JumpIfTrue(MainMemory.PeekWord(valueAddress), !regs.ParityFlag);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_PE_nn:
-                JumpIfTrue(MainMemory.PeekWord(valueAddress), regs.ParityFlag);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_P_nn:
-                JumpIfTrue(MainMemory.PeekWord(valueAddress), !regs.SignFlag);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_M_nn:
-                JumpIfTrue(MainMemory.PeekWord(valueAddress), regs.SignFlag);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_addrHL:
-                JumpIfTrue(regs.Main.HL, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_addr_IX:
-                JumpIfTrue(regs.IX, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JP_addr_IY:
-                JumpIfTrue(regs.IY, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JR_n:
-                JumpIfTrue((ushort)(regs.PC + Alu.FromTwosCompliment(imm8)), true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.JR_NZ_n:
-                return JumpIfTrue((ushort)(regs.PC + Alu.FromTwosCompliment(imm8)), !regs.ZeroFlag) ? 12 : 7;
-            case Z80Instructions.InstructionID.JR_Z_n:
-                return JumpIfTrue((ushort)(regs.PC + Alu.FromTwosCompliment(imm8)), regs.ZeroFlag) ? 12 : 7;
-            case Z80Instructions.InstructionID.JR_NC_n:
-                return JumpIfTrue((ushort)(regs.PC + Alu.FromTwosCompliment(imm8)), !regs.CarryFlag) ? 12 : 7;
-            case Z80Instructions.InstructionID.JR_C_n:
-                return JumpIfTrue((ushort)(regs.PC + Alu.FromTwosCompliment(imm8)), regs.CarryFlag) ? 12 : 7;
-            case Z80Instructions.InstructionID.RET:
-                doRet();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RET_NZ:
-                if (!regs.ZeroFlag)
-                {
-                    doRet();
-                    return 11;
-                }
-
-                return 5;
-            case Z80Instructions.InstructionID.RET_Z:
-                if (!regs.ZeroFlag)
-                    return 5;
-                doRet();
-                return 11;
-            case Z80Instructions.InstructionID.RET_NC:
-                if (regs.CarryFlag)
-                    return 5;
-                doRet();
-                return 11;
-            case Z80Instructions.InstructionID.RET_C:
-                if (!regs.CarryFlag)
-                    return 5;
-                doRet();
-                return 11;
-            case Z80Instructions.InstructionID.RET_PO:
-                if (regs.ParityFlag)
-                    return 5;
-                doRet();
-                return 11;
-            case Z80Instructions.InstructionID.RET_PE:
-                if (!regs.ParityFlag)
-                    return 5;
-                doRet();
-                return 11;
-
-            case Z80Instructions.InstructionID.RET_P:
-                if (regs.SignFlag)
-                    return 5;
-                doRet();
-                return 11;
-
-            case Z80Instructions.InstructionID.RET_M:
-                if (!regs.SignFlag)
-                    return 5;
-                doRet();
-                return 11;
-
-            case Z80Instructions.InstructionID.RETI:
-                doRet();
-                regs.IFF1 = regs.IFF2;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RETN:
-                RETN();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RST_00:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.PC);
-                regs.PC = 0x0000;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RST_08:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.PC);
-                regs.PC = 0x0008;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RST_10:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.PC);
-                regs.PC = 0x0010;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RST_18:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.PC);
-                regs.PC = 0x0018;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RST_20:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.PC);
-                regs.PC = 0x0020;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RST_28:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.PC);
-                regs.PC = 0x0028;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RST_30:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.PC);
-                regs.PC = 0x0030;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RST_38:
-                regs.SP -= 2;
-                MainMemory.Poke(regs.SP, regs.PC);
-                regs.PC = 0x0038;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.RLD:
-            {
-                int valueAtHl = MainMemory.Peek(regs.Main.HL);
-                var newValueAtHl = ((valueAtHl & 0x0f) << 4) + (regs.Main.A & 0x0f);
-                var newA = (regs.Main.A & 0xf0) + ((valueAtHl & 0xf0) >> 4);
-                regs.Main.A = (byte)newA;
-                MainMemory.Poke(regs.Main.HL, (byte)newValueAtHl);
-
-                regs.SignFlag = !Alu.IsBytePositive(regs.Main.A);
-                regs.ZeroFlag = regs.Main.A == 0;
-                regs.HalfCarryFlag = false;
-                regs.ParityFlag = Alu.IsEvenParity(regs.Main.A);
-                regs.SubtractFlag = false;
-                regs.SetFlags53FromA();
-                return instruction.TStateCount;
-            }
-            case Z80Instructions.InstructionID.RRD:
-            {
-                int valueAtHl = MainMemory.Peek(regs.Main.HL);
-                var newValueAtHl = ((regs.Main.A & 0x0f) << 4) + ((valueAtHl & 0xf0) >> 4);
-                var newA = (regs.Main.A & 0xf0) + (valueAtHl & 0x0f);
-                regs.Main.A = (byte)newA;
-                MainMemory.Poke(regs.Main.HL, (byte)newValueAtHl);
-
-                regs.SignFlag = !Alu.IsBytePositive(regs.Main.A);
-                regs.ZeroFlag = regs.Main.A == 0;
-                regs.HalfCarryFlag = false;
-                regs.ParityFlag = Alu.IsEvenParity(regs.Main.A);
-                regs.SubtractFlag = false;
-                regs.SetFlags53FromA();
-                return instruction.TStateCount;
-            }
+        return instruction.Handler(this, instruction);
+    }
 
-            case Z80Instructions.InstructionID.OUT_addr_C_0:
-                ThePortHandler?.Out(imm8, 0);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OUT_addr_n_A:
-                ThePortHandler?.Out(imm8, regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OUT_A_addr_C:
-                ThePortHandler?.Out(regs.Main.C, regs.Main.A);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OUT_B_addr_C:
-                ThePortHandler?.Out(regs.Main.C, regs.Main.B);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OUT_C_addr_C:
-                ThePortHandler?.Out(regs.Main.C, regs.Main.C);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OUT_D_addr_C:
-                ThePortHandler?.Out(regs.Main.C, regs.Main.D);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OUT_E_addr_C:
-                ThePortHandler?.Out(regs.Main.C, regs.Main.E);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OUT_H_addr_C:
-                ThePortHandler?.Out(regs.Main.C, regs.Main.H);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OUT_L_addr_C:
-                ThePortHandler?.Out(regs.Main.C, regs.Main.L);
-                return instruction.TStateCount;
-
-            case Z80Instructions.InstructionID.IN_A_addr_n:
-                if (ThePortHandler != null)
-                {
-                    var portAddress = (regs.Main.A << 8) + imm8;
-                    regs.Main.A = ThePortHandler.In((ushort)portAddress);
-                }
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IN_A_addr_C:
-                regs.Main.A = doIN_addrC();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IN_B_addr_C:
-                regs.Main.B = doIN_addrC();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IN_C_addr_C:
-                regs.Main.C = doIN_addrC();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IN_D_addr_C:
-                regs.Main.D = doIN_addrC();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IN_E_addr_C:
-                regs.Main.E = doIN_addrC();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IN_H_addr_C:
-                regs.Main.H = doIN_addrC();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IN_L_addr_C:
-                regs.Main.L = doIN_addrC();
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.IN_addr_C:
-                doIN_addrC();
-                return instruction.TStateCount;
-
-            case Z80Instructions.InstructionID.ADC_A_IXH:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.IXH, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_IXL:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.IXL, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_IYH:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.IYH, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADC_A_IYL:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.IYL, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_IXH:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.IXH, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_IXL:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.IXL, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_IYH:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.IYH, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.ADD_A_IYL:
-                regs.Main.A = TheAlu.AddAndSetFlags(regs.Main.A, regs.IYL, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_IXH:
-                TheAlu.And(regs.IXH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_IXL:
-                TheAlu.And(regs.IXL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_IYH:
-                TheAlu.And(regs.IYH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.AND_IYL:
-                TheAlu.And(regs.IYL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_IXH:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IXH, false);
-                regs.SetFlags53From(regs.IXH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_IXL:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IXL, false);
-                regs.SetFlags53From(regs.IXL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_IYH:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IYH, false);
-                regs.SetFlags53From(regs.IYH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.CP_IYL:
-                TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IYL, false);
-                regs.SetFlags53From(regs.IYL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_IXL:
-                regs.IXL = TheAlu.DecAndSetFlags(regs.IXL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_IXH:
-                regs.IXH = TheAlu.DecAndSetFlags(regs.IXH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_IYL:
-                regs.IYL = TheAlu.DecAndSetFlags(regs.IYL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.DEC_IYH:
-                regs.IYH = TheAlu.DecAndSetFlags(regs.IYH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_IXL:
-                regs.IXL = TheAlu.IncAndSetFlags(regs.IXL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_IYL:
-                regs.IYL = TheAlu.IncAndSetFlags(regs.IYL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_IXH:
-                regs.IXH = TheAlu.IncAndSetFlags(regs.IXH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.INC_IYH:
-                regs.IYH = TheAlu.IncAndSetFlags(regs.IYH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_IXH:
-                regs.Main.A = regs.IXH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_IXL:
-                regs.Main.A = regs.IXL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_IYH:
-                regs.Main.A = regs.IYH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_A_IYL:
-                regs.Main.A = regs.IYL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_IXH:
-                regs.Main.B = regs.IXH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_IXL:
-                regs.Main.B = regs.IXL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_IYH:
-                regs.Main.B = regs.IYH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_B_IYL:
-                regs.Main.B = regs.IYL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_IXH:
-                regs.Main.C = regs.IXH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_IXL:
-                regs.Main.C = regs.IXL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_IYH:
-                regs.Main.C = regs.IYH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_C_IYL:
-                regs.Main.C = regs.IYL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_IXH:
-                regs.Main.D = regs.IXH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_IXL:
-                regs.Main.D = regs.IXL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_IYH:
-                regs.Main.D = regs.IYH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_D_IYL:
-                regs.Main.D = regs.IYL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_IXH:
-                regs.Main.E = regs.IXH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_IXL:
-                regs.Main.E = regs.IXL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_IYH:
-                regs.Main.E = regs.IYH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_E_IYL:
-                regs.Main.E = regs.IYL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXH_A:
-                regs.IXH = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXH_B:
-                regs.IXH = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXH_C:
-                regs.IXH = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXH_D:
-                regs.IXH = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXH_E:
-                regs.IXH = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXH_IXH:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXH_IXL:
-                regs.IXH = regs.IXL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXH_n:
-                regs.IXH = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXL_A:
-                regs.IXL = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXL_B:
-                regs.IXL = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXL_C:
-                regs.IXL = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXL_D:
-                regs.IXL = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXL_E:
-                regs.IXL = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXL_IXH:
-                regs.IXL = regs.IXH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXL_IXL:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IXL_n:
-                regs.IXL = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYH_A:
-                regs.IYH = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYH_B:
-                regs.IYH = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYH_C:
-                regs.IYH = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYH_D:
-                regs.IYH = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYH_E:
-                regs.IYH = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYH_IYH:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYH_IYL:
-                regs.IYH = regs.IYL;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYH_n:
-                regs.IYH = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYL_A:
-                regs.IYL = regs.Main.A;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYL_B:
-                regs.IYL = regs.Main.B;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYL_C:
-                regs.IYL = regs.Main.C;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYL_D:
-                regs.IYL = regs.Main.D;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYL_E:
-                regs.IYL = regs.Main.E;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYL_IYH:
-                regs.IYL = regs.IYH;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYL_IYL:
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.LD_IYL_n:
-                regs.IYL = imm8;
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_IXH:
-                TheAlu.Or(regs.IXH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_IXL:
-                TheAlu.Or(regs.IXL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_IYH:
-                TheAlu.Or(regs.IYH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.OR_IYL:
-                TheAlu.Or(regs.IYL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_IXH:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IXH, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_IXL:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IXL, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_IYH:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IYH, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SBC_A_IYL:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IYL, true);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_IXH:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IXH, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_IXL:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IXL, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_IYH:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IYH, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.SUB_IYL:
-                regs.Main.A = TheAlu.SubtractAndSetFlags(regs.Main.A, regs.IYL, false);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_IXH:
-                TheAlu.Xor(regs.IXH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_IXL:
-                TheAlu.Xor(regs.IXL);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_IYH:
-                TheAlu.Xor(regs.IYH);
-                return instruction.TStateCount;
-            case Z80Instructions.InstructionID.XOR_IYL:
-                TheAlu.Xor(regs.IYL);
-                return instruction.TStateCount;
-
-            case Z80Instructions.InstructionID.INI:
-            {
-                var hlMem = MainMemory.Poke(regs.Main.HL, ThePortHandler.In(regs.Main.BC));
-                regs.Main.HL++;
-                regs.Main.B = TheAlu.DecAndSetFlags(regs.Main.B);
-
-                // 'Undocumented'.
-                var incC = (regs.Main.C + 1) & 255;
-                regs.HalfCarryFlag = hlMem + incC > 255;
-                regs.CarryFlag = hlMem + incC > 255;
-                regs.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + incC) & 7) ^ regs.Main.B));
-                regs.SubtractFlag = (hlMem & 0x80) != 0;
-                return instruction.TStateCount;
-            }
+    private void NOP()
+    {
+    }
 
-            case Z80Instructions.InstructionID.INIR:
-            {
-                // Looping version of INI.
-                var hlMem = MainMemory.Poke(regs.Main.HL, ThePortHandler.In(regs.Main.BC));
-                regs.Main.HL++;
-                regs.Main.B = TheAlu.DecAndSetFlags(regs.Main.B);
-                if (regs.Main.B != 0)
-                    regs.PC -= 2; // Repeat.
-
-                // 'Undocumented'.
-                var incC = (regs.Main.C + 1) & 255;
-                regs.HalfCarryFlag = hlMem + incC > 255;
-                regs.CarryFlag = hlMem + incC > 255;
-                regs.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + incC) & 7) ^ regs.Main.B));
-                regs.SubtractFlag = (hlMem & 0x80) != 0;
-
-                return regs.Main.B == 0 ? 16 : 21;
-            }
+    private void LD_A_n(byte n) =>
+        TheRegisters.Main.A = n;
 
-            case Z80Instructions.InstructionID.IND:
-            {
-                var hlMem = MainMemory.Poke(regs.Main.HL, ThePortHandler.In(regs.Main.BC));
-                regs.Main.HL--;
-                regs.Main.B = TheAlu.DecAndSetFlags(regs.Main.B);
-
-                // 'Undocumented'.
-                var decC = (regs.Main.C - 1) & 255;
-                regs.HalfCarryFlag = hlMem + decC > 255;
-                regs.CarryFlag = hlMem + decC > 255;
-                regs.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + decC) & 7) ^ regs.Main.B));
-                regs.SubtractFlag = (hlMem & 0x80) != 0;
-                
-                return instruction.TStateCount;
-            }
+    private void LD_B_n(byte n) =>
+        TheRegisters.Main.B = n;
 
-            case Z80Instructions.InstructionID.INDR:
-            {
-                // Looping version if IND.
-                var hlMem = MainMemory.Poke(regs.Main.HL, ThePortHandler.In(regs.Main.BC));
-                regs.Main.HL--;
-                regs.Main.B = TheAlu.DecAndSetFlags(regs.Main.B);
-                if (regs.Main.B != 0)
-                    regs.PC -= 2; // Repeat.
-
-                // 'Undocumented'.
-                var decC = (regs.Main.C - 1) & 255;
-                regs.HalfCarryFlag = hlMem + decC > 255;
-                regs.CarryFlag = hlMem + decC > 255;
-                regs.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + decC) & 7) ^ regs.Main.B));
-                regs.SubtractFlag = (hlMem & 0x80) != 0;
-
-                return regs.Main.B == 0 ? 16 : 21;
-            }
+    private void LD_C_n(byte n) =>
+        TheRegisters.Main.C = n;
 
-            case Z80Instructions.InstructionID.OUTI:
-            {
-                regs.Main.B = TheAlu.DecAndSetFlags(regs.Main.B);
-                var hlMem = MainMemory.Peek(regs.Main.HL);
-                ThePortHandler.Out(regs.Main.C, hlMem);
-                regs.Main.HL++;
-
-                // 'Undocumented'.
-                regs.HalfCarryFlag = hlMem + regs.Main.L > 255;
-                regs.CarryFlag = hlMem + regs.Main.L > 255;
-                regs.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + regs.Main.L) & 7) ^ regs.Main.B));
-                regs.SubtractFlag = (hlMem & 0x80) != 0;
-                return instruction.TStateCount;
-            }
+    private void LD_D_n(byte n) =>
+        TheRegisters.Main.D = n;
 
-            case Z80Instructions.InstructionID.OTIR:
-            {
-                // Looping version of OUTI.
-                var hlMem = MainMemory.Peek(regs.Main.HL);
-                regs.Main.B = TheAlu.DecAndSetFlags(regs.Main.B);
-                ThePortHandler.Out(regs.Main.C, hlMem);
-                regs.Main.HL++;
-                if (regs.Main.B != 0)
-                    regs.PC -= 2; // Repeat.
-
-                // 'Undocumented'.
-                regs.HalfCarryFlag = hlMem + regs.Main.L > 255;
-                regs.CarryFlag = hlMem + regs.Main.L > 255;
-                regs.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + regs.Main.L) & 7) ^ regs.Main.B));
-                regs.SubtractFlag = (hlMem & 0x80) != 0;
-
-                return regs.Main.B == 0 ? 16 : 21;
-            }
+    private void LD_E_n(byte n) =>
+        TheRegisters.Main.E = n;
 
-            case Z80Instructions.InstructionID.OUTD:
-            {
-                var hlMem = MainMemory.Peek(regs.Main.HL);
-                regs.Main.B = TheAlu.DecAndSetFlags(regs.Main.B);
-                ThePortHandler.Out(regs.Main.C, hlMem);
-                regs.Main.HL--;
-
-                // 'Undocumented'.
-                regs.HalfCarryFlag = hlMem + regs.Main.L > 255;
-                regs.CarryFlag = hlMem + regs.Main.L > 255;
-                regs.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + regs.Main.L) & 7) ^ regs.Main.B));
-                regs.SubtractFlag = (hlMem & 0x80) != 0;
-                
-                return instruction.TStateCount;
-            }
+    private void LD_H_n(byte n) =>
+        TheRegisters.Main.H = n;
 
-            case Z80Instructions.InstructionID.OTDR:
-            {
-                // Looping version of OUTD.
-                var hlMem = MainMemory.Peek(regs.Main.HL);
-                regs.Main.B = TheAlu.DecAndSetFlags(regs.Main.B);
-                ThePortHandler.Out(regs.Main.C, hlMem);
-                regs.Main.HL--;
-                if (regs.Main.B != 0)
-                    regs.PC -= 2; // Repeat.
-
-                // 'Undocumented'.
-                regs.HalfCarryFlag = hlMem + regs.Main.L > 255;
-                regs.CarryFlag = hlMem + regs.Main.L > 255;
-                regs.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + regs.Main.L) & 7) ^ regs.Main.B));
-                regs.SubtractFlag = (hlMem & 0x80) != 0;
-
-                return regs.Main.B == 0 ? 16 : 21;
-            }
+    private void LD_L_n(byte n) =>
+        TheRegisters.Main.L = n;
 
-            default:
-                if (instruction.Run == null)
-                    throw new UnsupportedInstruction(this, instruction);
-                
-                // Dynamic instruction.
-                return instruction.Run(MainMemory, regs, TheAlu, valueAddress);
-        }
+    private void LD_A_addr(ushort nn) =>
+        TheRegisters.Main.A = MainMemory.Peek(nn);
+
+    private void LD_A_A()
+    {
+    }
+
+    private void LD_A_B() =>
+        TheRegisters.Main.A = TheRegisters.Main.B;
+
+    private void LD_A_C() =>
+        TheRegisters.Main.A = TheRegisters.Main.C;
+
+    private void LD_A_D() =>
+        TheRegisters.Main.A = TheRegisters.Main.D;
+
+    private void LD_A_E() =>
+        TheRegisters.Main.A = TheRegisters.Main.E;
+
+    private void LD_A_H() =>
+        TheRegisters.Main.A = TheRegisters.Main.H;
+
+    private void LD_A_L() =>
+        TheRegisters.Main.A = TheRegisters.Main.L;
+
+    private void LD_B_A() =>
+        TheRegisters.Main.B = TheRegisters.Main.A;
+
+    private void LD_B_B()
+    {
+    }
+
+    private void LD_B_C() =>
+        TheRegisters.Main.B = TheRegisters.Main.C;
+
+    private void LD_B_D() =>
+        TheRegisters.Main.B = TheRegisters.Main.D;
+
+    private void LD_B_E() =>
+        TheRegisters.Main.B = TheRegisters.Main.E;
+
+    private void LD_B_H() =>
+        TheRegisters.Main.B = TheRegisters.Main.H;
+
+    private void LD_B_L() =>
+        TheRegisters.Main.B = TheRegisters.Main.L;
+
+    private void LD_C_A() =>
+        TheRegisters.Main.C = TheRegisters.Main.A;
+
+    private void LD_C_B() =>
+        TheRegisters.Main.C = TheRegisters.Main.B;
+
+    private void LD_C_C()
+    {
+    }
+
+    private void LD_C_D() =>
+        TheRegisters.Main.C = TheRegisters.Main.D;
+
+    private void LD_C_E() =>
+        TheRegisters.Main.C = TheRegisters.Main.E;
+
+    private void LD_C_H() =>
+        TheRegisters.Main.C = TheRegisters.Main.H;
+
+    private void LD_C_L() =>
+        TheRegisters.Main.C = TheRegisters.Main.L;
+
+    private void LD_D_A() =>
+        TheRegisters.Main.D = TheRegisters.Main.A;
+
+    private void LD_D_B() =>
+        TheRegisters.Main.D = TheRegisters.Main.B;
+
+    private void LD_D_C() =>
+        TheRegisters.Main.D = TheRegisters.Main.C;
+
+    private void LD_D_D()
+    {
+    }
+
+    private void LD_D_E() =>
+        TheRegisters.Main.D = TheRegisters.Main.E;
+
+    private void LD_D_H() =>
+        TheRegisters.Main.D = TheRegisters.Main.H;
+
+    private void LD_D_L() =>
+        TheRegisters.Main.D = TheRegisters.Main.L;
+
+    private void LD_E_A() =>
+        TheRegisters.Main.E = TheRegisters.Main.A;
+
+    private void LD_E_B() =>
+        TheRegisters.Main.E = TheRegisters.Main.B;
+
+    private void LD_E_C() =>
+        TheRegisters.Main.E = TheRegisters.Main.C;
+
+    private void LD_E_D() =>
+        TheRegisters.Main.E = TheRegisters.Main.D;
+
+    private void LD_E_E()
+    {
+    }
+
+    private void LD_E_H() =>
+        TheRegisters.Main.E = TheRegisters.Main.H;
+
+    private void LD_E_L() =>
+        TheRegisters.Main.E = TheRegisters.Main.L;
+
+    private void LD_H_A() =>
+        TheRegisters.Main.H = TheRegisters.Main.A;
+
+    private void LD_H_B() =>
+        TheRegisters.Main.H = TheRegisters.Main.B;
+
+    private void LD_H_C() =>
+        TheRegisters.Main.H = TheRegisters.Main.C;
+
+    private void LD_H_D() =>
+        TheRegisters.Main.H = TheRegisters.Main.D;
+
+    private void LD_H_E() =>
+        TheRegisters.Main.H = TheRegisters.Main.E;
+
+    private void LD_H_H()
+    {
+    }
+
+    private void LD_H_L() =>
+        TheRegisters.Main.H = TheRegisters.Main.L;
+
+    private void LD_L_A() =>
+        TheRegisters.Main.L = TheRegisters.Main.A;
+
+    private void LD_L_B() =>
+        TheRegisters.Main.L = TheRegisters.Main.B;
+
+    private void LD_L_C() =>
+        TheRegisters.Main.L = TheRegisters.Main.C;
+
+    private void LD_L_D() =>
+        TheRegisters.Main.L = TheRegisters.Main.D;
+
+    private void LD_L_E() =>
+        TheRegisters.Main.L = TheRegisters.Main.E;
+
+    private void LD_L_H() =>
+        TheRegisters.Main.L = TheRegisters.Main.H;
+
+    private void LD_L_L()
+    {
+    }
+
+    private void LD_A_addrHL() =>
+        TheRegisters.Main.A = MainMemory.Peek(TheRegisters.Main.HL);
+
+    private void LD_B_addrHL() =>
+        TheRegisters.Main.B = MainMemory.Peek(TheRegisters.Main.HL);
+
+    private void LD_C_addrHL() =>
+        TheRegisters.Main.C = MainMemory.Peek(TheRegisters.Main.HL);
+
+    private void LD_D_addrHL() =>
+        TheRegisters.Main.D = MainMemory.Peek(TheRegisters.Main.HL);
+
+    private void LD_E_addrHL() =>
+        TheRegisters.Main.E = MainMemory.Peek(TheRegisters.Main.HL);
+
+    private void LD_H_addrHL() =>
+        TheRegisters.Main.H = MainMemory.Peek(TheRegisters.Main.HL);
+
+    private void LD_L_addrHL() =>
+        TheRegisters.Main.L = MainMemory.Peek(TheRegisters.Main.HL);
+
+    private void LD_A_addrIXplus_d(byte d)
+    {
+        TheRegisters.Main.A =
+            MainMemory.Peek(TheRegisters.IXPlusD(d));
+    }
+
+    private void LD_A_addrIYplus_d(byte d)
+    {
+        TheRegisters.Main.A =
+            MainMemory.Peek(TheRegisters.IYPlusD(d));
+    }
+
+    private void LD_B_addrIXplus_d(byte d)
+    {
+        TheRegisters.Main.B =
+            MainMemory.Peek(TheRegisters.IXPlusD(d));
+    }
+
+    private void LD_B_addrIYplus_d(byte d)
+    {
+        TheRegisters.Main.B =
+            MainMemory.Peek(TheRegisters.IYPlusD(d));
+    }
+
+    private void LD_C_addrIXplus_d(byte d)
+    {
+        TheRegisters.Main.C =
+            MainMemory.Peek(TheRegisters.IXPlusD(d));
+    }
+
+    private void LD_C_addrIYplus_d(byte d)
+    {
+        TheRegisters.Main.C =
+            MainMemory.Peek(TheRegisters.IYPlusD(d));
+    }
+
+    private void LD_D_addrIXplus_d(byte d)
+    {
+        TheRegisters.Main.D =
+            MainMemory.Peek(TheRegisters.IXPlusD(d));
+    }
+
+    private void LD_D_addrIYplus_d(byte d)
+    {
+        TheRegisters.Main.D =
+            MainMemory.Peek(TheRegisters.IYPlusD(d));
+    }
+
+    private void LD_E_addrIXplus_d(byte d)
+    {
+        TheRegisters.Main.E =
+            MainMemory.Peek(TheRegisters.IXPlusD(d));
+    }
+
+    private void LD_E_addrIYplus_d(byte d)
+    {
+        TheRegisters.Main.E =
+            MainMemory.Peek(TheRegisters.IYPlusD(d));
+    }
+
+    private void LD_H_addrIXplus_d(byte d)
+    {
+        TheRegisters.Main.H =
+            MainMemory.Peek(TheRegisters.IXPlusD(d));
+    }
+
+    private void LD_H_addrIYplus_d(byte d)
+    {
+        TheRegisters.Main.H =
+            MainMemory.Peek(TheRegisters.IYPlusD(d));
+    }
+
+    private void LD_L_addrIXplus_d(byte d)
+    {
+        TheRegisters.Main.L =
+            MainMemory.Peek(TheRegisters.IXPlusD(d));
+    }
+
+    private void LD_L_addrIYplus_d(byte d)
+    {
+        TheRegisters.Main.L =
+            MainMemory.Peek(TheRegisters.IYPlusD(d));
+    }
+
+    private void LD_IX_nn(ushort nn) =>
+        TheRegisters.IX = nn;
+
+    private void LD_IY_nn(ushort nn) =>
+        TheRegisters.IY = nn;
+
+    private void LD_IX_addr(ushort nn) =>
+        TheRegisters.IX = MainMemory.PeekWord(nn);
+
+    private void LD_IY_addr(ushort nn) =>
+        TheRegisters.IY = MainMemory.PeekWord(nn);
+
+    private void LD_addrHL_n(byte n) =>
+        MainMemory.Poke(TheRegisters.Main.HL, n);
+
+    private void LD_addrHL_A() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheRegisters.Main.A);
+
+    private void LD_addrHL_B() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheRegisters.Main.B);
+
+    private void LD_addrHL_C() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheRegisters.Main.C);
+
+    private void LD_addrHL_D() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheRegisters.Main.D);
+
+    private void LD_addrHL_E() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheRegisters.Main.E);
+
+    private void LD_addrHL_H() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheRegisters.Main.H);
+
+    private void LD_addrHL_L() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheRegisters.Main.L);
+
+    private void LD_addrIXplus_d_n(byte d, byte n) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), n);
+
+    private void LD_addrIYplus_d_n(byte d, byte n) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), n);
+
+    private void LD_addrIXplus_d_A(byte d) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), TheRegisters.Main.A);
+
+    private void LD_addrIXplus_d_B(byte d) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), TheRegisters.Main.B);
+
+    private void LD_addrIXplus_d_C(byte d) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), TheRegisters.Main.C);
+
+    private void LD_addrIXplus_d_D(byte d) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), TheRegisters.Main.D);
+
+    private void LD_addrIXplus_d_E(byte d) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), TheRegisters.Main.E);
+
+    private void LD_addrIXplus_d_H(byte d) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), TheRegisters.Main.H);
+
+    private void LD_addrIXplus_d_L(byte d) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), TheRegisters.Main.L);
+
+    private void LD_addrIYplus_d_A(byte d) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), TheRegisters.Main.A);
+
+    private void LD_addrIYplus_d_B(byte d) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), TheRegisters.Main.B);
+
+    private void LD_addrIYplus_d_C(byte d) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), TheRegisters.Main.C);
+
+    private void LD_addrIYplus_d_D(byte d) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), TheRegisters.Main.D);
+
+    private void LD_addrIYplus_d_E(byte d) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), TheRegisters.Main.E);
+
+    private void LD_addrIYplus_d_H(byte d) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), TheRegisters.Main.H);
+
+    private void LD_addrIYplus_d_L(byte d) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), TheRegisters.Main.L);
+
+    private void LD_A_addrBC() =>
+        TheRegisters.Main.A = MainMemory.Peek(TheRegisters.Main.BC);
+
+    private void LD_A_addrDE() =>
+        TheRegisters.Main.A = MainMemory.Peek(TheRegisters.Main.DE);
+
+    private void LD_addrBC_A() =>
+        MainMemory.Poke(TheRegisters.Main.BC, TheRegisters.Main.A);
+
+    private void LD_addrDE_A() =>
+        MainMemory.Poke(TheRegisters.Main.DE, TheRegisters.Main.A);
+
+    private void LD_addr_A(ushort nn) =>
+        MainMemory.Poke(nn, TheRegisters.Main.A);
+
+    private void LD_A_I()
+    {
+        TheRegisters.Main.A = TheRegisters.I;
+        TheRegisters.SignFlag = !Alu.IsBytePositive(TheRegisters.I);
+        TheRegisters.ZeroFlag = TheRegisters.I == 0;
+        TheRegisters.HalfCarryFlag = false;
+        TheRegisters.ParityFlag = TheRegisters.IFF2;
+        TheRegisters.SubtractFlag = false;
+        TheRegisters.SetFlags53FromA();
+    }
+
+    private void LD_A_R()
+    {
+        TheRegisters.Main.A = TheRegisters.R;
+        TheRegisters.SignFlag = !Alu.IsBytePositive(TheRegisters.R);
+        TheRegisters.ZeroFlag = TheRegisters.R == 0;
+        TheRegisters.HalfCarryFlag = false;
+        TheRegisters.ParityFlag = TheRegisters.IFF2;
+        TheRegisters.SubtractFlag = false;
+    }
+
+    private void LD_I_A() =>
+        TheRegisters.I = TheRegisters.Main.A;
+
+    private void LD_R_A() =>
+        TheRegisters.R = TheRegisters.Main.A;
+
+    private void LD_BC_nn(ushort nn) =>
+        TheRegisters.Main.BC = nn;
+
+    private void LD_DE_nn(ushort nn) =>
+        TheRegisters.Main.DE = nn;
+
+    private void LD_HL_nn(ushort nn) =>
+        TheRegisters.Main.HL = nn;
+
+    private void LD_SP_nn(ushort nn) =>
+        TheRegisters.SP = nn;
+
+    private void LD_BC_addr(ushort nn) =>
+        TheRegisters.Main.BC = MainMemory.PeekWord(nn);
+
+    private void LD_DE_addr(ushort nn) =>
+        TheRegisters.Main.DE = MainMemory.PeekWord(nn);
+
+    private void LD_HL_addr(ushort nn) =>
+        TheRegisters.Main.HL = MainMemory.PeekWord(nn);
+
+    private void LD_SP_addr(ushort nn) =>
+        TheRegisters.SP = MainMemory.PeekWord(nn);
+
+    private void LD_addr_BC(ushort nn) =>
+        MainMemory.Poke(nn, TheRegisters.Main.BC);
+
+    private void LD_addr_DE(ushort nn) =>
+        MainMemory.Poke(nn, TheRegisters.Main.DE);
+
+    private void LD_addrHL(ushort nn) =>
+        MainMemory.Poke(nn, TheRegisters.Main.HL);
+
+    private void LD_addr_SP(ushort nn) =>
+        MainMemory.Poke(nn, TheRegisters.SP);
+
+    private void LD_addr_IX(ushort nn) =>
+        MainMemory.Poke(nn, TheRegisters.IX);
+
+    private void LD_addr_IY(ushort nn) =>
+        MainMemory.Poke(nn, TheRegisters.IY);
+
+    private void LD_SP_HL() =>
+        TheRegisters.SP = TheRegisters.Main.HL;
+
+    private void LD_SP_IX() =>
+        TheRegisters.SP = TheRegisters.IX;
+
+    private void LD_SP_IY() =>
+        TheRegisters.SP = TheRegisters.IY;
+
+    private void PUSH_AF()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.Main.AF);
+    }
+
+    private void PUSH_BC()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.Main.BC);
+    }
+
+    private void PUSH_DE()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.Main.DE);
+    }
+
+    private void PUSH_HL()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.Main.HL);
+    }
+
+    private void PUSH_IX()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.IX);
+    }
+
+    private void PUSH_IY()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.IY);
+    }
+
+    private void POP_AF()
+    {
+        TheRegisters.Main.AF = MainMemory.PeekWord(TheRegisters.SP);
+        TheRegisters.SP += 2;
+    }
+
+    private void POP_BC()
+    {
+        TheRegisters.Main.BC = MainMemory.PeekWord(TheRegisters.SP);
+        TheRegisters.SP += 2;
+    }
+
+    private void POP_DE()
+    {
+        TheRegisters.Main.DE = MainMemory.PeekWord(TheRegisters.SP);
+        TheRegisters.SP += 2;
+    }
+
+    private void POP_HL()
+    {
+        TheRegisters.Main.HL = MainMemory.PeekWord(TheRegisters.SP);
+        TheRegisters.SP += 2;
+    }
+
+    private void POP_IX()
+    {
+        TheRegisters.IX = MainMemory.PeekWord(TheRegisters.SP);
+        TheRegisters.SP += 2;
+    }
+
+    private void POP_IY()
+    {
+        TheRegisters.IY = MainMemory.PeekWord(TheRegisters.SP);
+        TheRegisters.SP += 2;
+    }
+
+    private void EX_DE_HL() =>
+        (TheRegisters.Main.DE, TheRegisters.Main.HL) = (TheRegisters.Main.HL, TheRegisters.Main.DE);
+
+    private void EX_AF_altAF() =>
+        (TheRegisters.Main.AF, TheRegisters.Alt.AF) = (TheRegisters.Alt.AF, TheRegisters.Main.AF);
+
+    private void EXX() =>
+        TheRegisters.ExchangeRegisterSet();
+
+    private void EX_addrSP_HL()
+    {
+        var v = TheRegisters.Main.HL;
+        TheRegisters.Main.HL = MainMemory.PeekWord(TheRegisters.SP);
+        MainMemory.Poke(TheRegisters.SP, v);
+    }
+
+    private void EX_addrSP_IX()
+    {
+        var v = TheRegisters.IX;
+        TheRegisters.IX = MainMemory.PeekWord(TheRegisters.SP);
+        MainMemory.Poke(TheRegisters.SP, v);
+    }
+
+    private void EX_addrSP_IY()
+    {
+        var v = TheRegisters.IY;
+        TheRegisters.IY = MainMemory.PeekWord(TheRegisters.SP);
+        MainMemory.Poke(TheRegisters.SP, v);
+    }
+
+    private void LDD() =>
+        doLDD();
+
+    private int LDDR()
+    {
+        RunBulkBlockCopy((ushort)(TheRegisters.PC - 2), false);
+        doLDD();
+        if (TheRegisters.Main.BC != 0)
+            TheRegisters.PC -= 2;
+        return TheRegisters.Main.BC != 0 ? 21 : 16;
+    }
+
+    private void LDI() =>
+        doLDI();
+
+    private int LDIR()
+    {
+        RunBulkBlockCopy((ushort)(TheRegisters.PC - 2), true);
+        doLDI();
+        if (TheRegisters.Main.BC != 0)
+            TheRegisters.PC -= 2;
+        return TheRegisters.Main.BC != 0 ? 21 : 16;
+    }
+
+    private void CPD() =>
+        doCPD();
+
+    private int CPDR()
+    {
+        RunBulkBlockCompare(false);
+        doCPD();
+        if (!TheRegisters.ZeroFlag && TheRegisters.Main.BC != 0)
+            TheRegisters.PC -= 2;
+        TheRegisters.ParityFlag = TheRegisters.Main.BC != 0;
+        return TheRegisters.Main.BC != 0 ? 21 : 16;
+    }
+
+    private void CPI() =>
+        doCPI();
+
+    private int CPIR()
+    {
+        RunBulkBlockCompare(true);
+        doCPI();
+        if (!TheRegisters.ZeroFlag && TheRegisters.Main.BC != 0)
+            TheRegisters.PC -= 2;
+        TheRegisters.ParityFlag = TheRegisters.Main.BC != 0;
+        return TheRegisters.Main.BC != 0 && TheRegisters.Main.A != MainMemory.Peek(TheRegisters.Main.HL) ? 21 : 16;
+    }
+
+    private void ADC_A_n(byte n) =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, n, true);
+
+    private void ADC_A_A() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.A, true);
+
+    private void ADC_A_B() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.B, true);
+
+    private void ADC_A_C() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.C, true);
+
+    private void ADC_A_D() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.D, true);
+
+    private void ADC_A_E() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.E, true);
+
+    private void ADC_A_H() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.H, true);
+
+    private void ADC_A_L() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.L, true);
+
+    private void ADC_A_addrHL() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.Main.HL), true);
+
+    private void ADC_A_addrIXplus_d(byte d) =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.IXPlusD(d)), true);
+
+    private void ADC_A_addrIYplus_d(byte d) =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.IYPlusD(d)), true);
+
+    private void ADD_A_n(byte n) =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, n, false);
+
+    private void ADD_A_A() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.A, false);
+
+    private void ADD_A_B() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.B, false);
+
+    private void ADD_A_C() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.C, false);
+
+    private void ADD_A_D() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.D, false);
+
+    private void ADD_A_E() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.E, false);
+
+    private void ADD_A_H() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.H, false);
+
+    private void ADD_A_L() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.L, false);
+
+    private void ADD_A_addrHL() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.Main.HL), false);
+
+    private void ADD_A_addrIXplus_d(byte d) =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.IXPlusD(d)), false);
+
+    private void ADD_A_addrIYplus_d(byte d) =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.IYPlusD(d)), false);
+
+    private void DEC_A() =>
+        TheRegisters.Main.A = TheAlu.DecAndSetFlags(TheRegisters.Main.A);
+
+    private void DEC_B() =>
+        TheRegisters.Main.B = TheAlu.DecAndSetFlags(TheRegisters.Main.B);
+
+    private void DEC_C() =>
+        TheRegisters.Main.C = TheAlu.DecAndSetFlags(TheRegisters.Main.C);
+
+    private void DEC_D() =>
+        TheRegisters.Main.D = TheAlu.DecAndSetFlags(TheRegisters.Main.D);
+
+    private void DEC_E() =>
+        TheRegisters.Main.E = TheAlu.DecAndSetFlags(TheRegisters.Main.E);
+
+    private void DEC_H() =>
+        TheRegisters.Main.H = TheAlu.DecAndSetFlags(TheRegisters.Main.H);
+
+    private void DEC_L() =>
+        TheRegisters.Main.L = TheAlu.DecAndSetFlags(TheRegisters.Main.L);
+
+    private void DEC_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.DecAndSetFlags(MainMemory.Peek(TheRegisters.Main.HL)));
+
+    private void DEC_addrIXplus_d(byte d) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), TheAlu.DecAndSetFlags(MainMemory.Peek(TheRegisters.IXPlusD(d))));
+
+    private void DEC_addrIYplus_d(byte d) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), TheAlu.DecAndSetFlags(MainMemory.Peek(TheRegisters.IYPlusD(d))));
+
+    private void INC_A() =>
+        TheRegisters.Main.A = TheAlu.IncAndSetFlags(TheRegisters.Main.A);
+
+    private void INC_B() =>
+        TheRegisters.Main.B = TheAlu.IncAndSetFlags(TheRegisters.Main.B);
+
+    private void INC_C() =>
+        TheRegisters.Main.C = TheAlu.IncAndSetFlags(TheRegisters.Main.C);
+
+    private void INC_D() =>
+        TheRegisters.Main.D = TheAlu.IncAndSetFlags(TheRegisters.Main.D);
+
+    private void INC_E() =>
+        TheRegisters.Main.E = TheAlu.IncAndSetFlags(TheRegisters.Main.E);
+
+    private void INC_H() =>
+        TheRegisters.Main.H = TheAlu.IncAndSetFlags(TheRegisters.Main.H);
+
+    private void INC_L() =>
+        TheRegisters.Main.L = TheAlu.IncAndSetFlags(TheRegisters.Main.L);
+
+    private void INC_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.IncAndSetFlags(MainMemory.Peek(TheRegisters.Main.HL)));
+
+    private void INC_addrIXplus_d(byte d) =>
+        MainMemory.Poke(TheRegisters.IXPlusD(d), TheAlu.IncAndSetFlags(MainMemory.Peek(TheRegisters.IXPlusD(d))));
+
+    private void INC_addrIYplus_d(byte d) =>
+        MainMemory.Poke(TheRegisters.IYPlusD(d), TheAlu.IncAndSetFlags(MainMemory.Peek(TheRegisters.IYPlusD(d))));
+
+    private void SBC_A_n(byte n) =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, n, true);
+
+    private void SBC_A_A() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.A, true);
+
+    private void SBC_A_B() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.B, true);
+
+    private void SBC_A_C() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.C, true);
+
+    private void SBC_A_D() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.D, true);
+
+    private void SBC_A_E() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.E, true);
+
+    private void SBC_A_H() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.H, true);
+
+    private void SBC_A_L() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.L, true);
+
+    private void SBC_A_addrHL() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.Main.HL), true);
+
+    private void SBC_A_addrIXplus_d(byte d) =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.IXPlusD(d)), true);
+
+    private void SBC_A_addrIYplus_d(byte d) =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.IYPlusD(d)), true);
+
+    private void SUB_n(byte n) =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, n, false);
+
+    private void SUB_A() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.A, false);
+
+    private void SUB_B() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.B, false);
+
+    private void SUB_C() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.C, false);
+
+    private void SUB_D() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.D, false);
+
+    private void SUB_E() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.E, false);
+
+    private void SUB_H() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.H, false);
+
+    private void SUB_L() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.Main.L, false);
+
+    private void SUB_addrHL() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.Main.HL), false);
+
+    private void SUB_addrIXplus_d(byte d) =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.IXPlusD(d)), false);
+
+    private void SUB_addrIYplus_d(byte d) =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, MainMemory.Peek(TheRegisters.IYPlusD(d)), false);
+
+    private void ADC_HL_BC() =>
+        TheRegisters.Main.HL = TheAlu.AddAndSetFlags(TheRegisters.Main.HL, TheRegisters.Main.BC, true);
+
+    private void ADC_HL_DE() =>
+        TheRegisters.Main.HL = TheAlu.AddAndSetFlags(TheRegisters.Main.HL, TheRegisters.Main.DE, true);
+
+    private void ADC_HL_HL() =>
+        TheRegisters.Main.HL = TheAlu.AddAndSetFlags(TheRegisters.Main.HL, TheRegisters.Main.HL, true);
+
+    private void ADC_HL_SP() =>
+        TheRegisters.Main.HL = TheAlu.AddAndSetFlags(TheRegisters.Main.HL, TheRegisters.SP, true);
+
+    private void SBC_HL_BC() =>
+        TheRegisters.Main.HL = TheAlu.SubtractAndSetFlags(TheRegisters.Main.HL, TheRegisters.Main.BC, true);
+
+    private void SBC_HL_DE() =>
+        TheRegisters.Main.HL = TheAlu.SubtractAndSetFlags(TheRegisters.Main.HL, TheRegisters.Main.DE, true);
+
+    private void SBC_HL_HL() =>
+        TheRegisters.Main.HL = TheAlu.SubtractAndSetFlags(TheRegisters.Main.HL, TheRegisters.Main.HL, true);
+
+    private void SBC_HL_SP() =>
+        TheRegisters.Main.HL = TheAlu.SubtractAndSetFlags(TheRegisters.Main.HL, TheRegisters.SP, true);
+
+    private void ADD_HL_BC() =>
+        TheRegisters.Main.HL = TheAlu.AddAndSetFlags(TheRegisters.Main.HL, TheRegisters.Main.BC, false);
+
+    private void ADD_HL_DE() =>
+        TheRegisters.Main.HL = TheAlu.AddAndSetFlags(TheRegisters.Main.HL, TheRegisters.Main.DE, false);
+
+    private void ADD_HL_HL() =>
+        TheRegisters.Main.HL = TheAlu.AddAndSetFlags(TheRegisters.Main.HL, TheRegisters.Main.HL, false);
+
+    private void ADD_HL_SP() =>
+        TheRegisters.Main.HL = TheAlu.AddAndSetFlags(TheRegisters.Main.HL, TheRegisters.SP, false);
+
+    private void ADD_IX_BC() =>
+        TheRegisters.IX = TheAlu.AddAndSetFlags(TheRegisters.IX, TheRegisters.Main.BC, false);
+
+    private void ADD_IX_DE() =>
+        TheRegisters.IX = TheAlu.AddAndSetFlags(TheRegisters.IX, TheRegisters.Main.DE, false);
+
+    private void ADD_IX_IX() =>
+        TheRegisters.IX = TheAlu.AddAndSetFlags(TheRegisters.IX, TheRegisters.IX, false);
+
+    private void ADD_IX_SP() =>
+        TheRegisters.IX = TheAlu.AddAndSetFlags(TheRegisters.IX, TheRegisters.SP, false);
+
+    private void ADD_IY_BC() =>
+        TheRegisters.IY = TheAlu.AddAndSetFlags(TheRegisters.IY, TheRegisters.Main.BC, false);
+
+    private void ADD_IY_DE() =>
+        TheRegisters.IY = TheAlu.AddAndSetFlags(TheRegisters.IY, TheRegisters.Main.DE, false);
+
+    private void ADD_IY_IY() =>
+        TheRegisters.IY = TheAlu.AddAndSetFlags(TheRegisters.IY, TheRegisters.IY, false);
+
+    private void ADD_IY_SP() =>
+        TheRegisters.IY = TheAlu.AddAndSetFlags(TheRegisters.IY, TheRegisters.SP, false);
+
+    private void DEC_BC() =>
+        TheRegisters.Main.BC = (ushort)(TheRegisters.Main.BC - 1);
+
+    private void DEC_DE() =>
+        TheRegisters.Main.DE = (ushort)(TheRegisters.Main.DE - 1);
+
+    private void DEC_HL() =>
+        TheRegisters.Main.HL = (ushort)(TheRegisters.Main.HL - 1);
+
+    private void DEC_SP() =>
+        TheRegisters.SP = (ushort)(TheRegisters.SP - 1);
+
+    private void DEC_IX() =>
+        TheRegisters.IX--;
+
+    private void DEC_IY() =>
+        TheRegisters.IY--;
+
+    private void INC_BC() =>
+        TheRegisters.Main.BC++;
+
+    private void INC_DE() =>
+        TheRegisters.Main.DE++;
+
+    private void INC_HL() =>
+        TheRegisters.Main.HL++;
+
+    private void INC_SP() =>
+        TheRegisters.SP++;
+
+    private void INC_IX() =>
+        TheRegisters.IX++;
+
+    private void INC_IY() =>
+        TheRegisters.IY++;
+
+    private void AND_n(byte n) =>
+        TheAlu.And(n);
+
+    private void AND_A() =>
+        TheAlu.And(TheRegisters.Main.A);
+
+    private void AND_B() =>
+        TheAlu.And(TheRegisters.Main.B);
+
+    private void AND_C() =>
+        TheAlu.And(TheRegisters.Main.C);
+
+    private void AND_D() =>
+        TheAlu.And(TheRegisters.Main.D);
+
+    private void AND_E() =>
+        TheAlu.And(TheRegisters.Main.E);
+
+    private void AND_H() =>
+        TheAlu.And(TheRegisters.Main.H);
+
+    private void AND_L() =>
+        TheAlu.And(TheRegisters.Main.L);
+
+    private void AND_addrHL() =>
+        TheAlu.And(MainMemory.Peek(TheRegisters.Main.HL));
+
+    private void AND_addrIX_plus_d(byte d) =>
+        TheAlu.And(MainMemory.Peek(TheRegisters.IXPlusD(d)));
+
+    private void AND_addrIY_plus_d(byte d) =>
+        TheAlu.And(MainMemory.Peek(TheRegisters.IYPlusD(d)));
+
+    private void CP_n(byte n) =>
+        TheAlu.Compare(TheRegisters.Main.A, n);
+
+    private void CP_A() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.Main.A);
+
+    private void CP_B() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.Main.B);
+
+    private void CP_C() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.Main.C);
+
+    private void CP_D() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.Main.D);
+
+    private void CP_E() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.Main.E);
+
+    private void CP_H() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.Main.H);
+
+    private void CP_L() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.Main.L);
+
+    private void CP_addrHL()
+    {
+        var b = MainMemory.Peek(TheRegisters.Main.HL);
+        TheAlu.Compare(TheRegisters.Main.A, b);
+    }
+
+    private void CP_addrIX_plus_d(byte d)
+    {
+        var v = MainMemory.Peek(TheRegisters.IXPlusD(d));
+        TheAlu.Compare(TheRegisters.Main.A, v);
+    }
+
+    private void CP_addrIY_plus_d(byte d)
+    {
+        var v = MainMemory.Peek(TheRegisters.IYPlusD(d));
+        TheAlu.Compare(TheRegisters.Main.A, v);
+    }
+
+    private void OR_n(byte n) =>
+        TheAlu.Or(n);
+
+    private void OR_A() =>
+        TheAlu.Or(TheRegisters.Main.A);
+
+    private void OR_B() =>
+        TheAlu.Or(TheRegisters.Main.B);
+
+    private void OR_C() =>
+        TheAlu.Or(TheRegisters.Main.C);
+
+    private void OR_D() =>
+        TheAlu.Or(TheRegisters.Main.D);
+
+    private void OR_E() =>
+        TheAlu.Or(TheRegisters.Main.E);
+
+    private void OR_H() =>
+        TheAlu.Or(TheRegisters.Main.H);
+
+    private void OR_L() =>
+        TheAlu.Or(TheRegisters.Main.L);
+
+    private void OR_addrHL() =>
+        TheAlu.Or(MainMemory.Peek(TheRegisters.Main.HL));
+
+    private void OR_addrIX_plus_d(byte d) =>
+        TheAlu.Or(MainMemory.Peek(TheRegisters.IXPlusD(d)));
+
+    private void OR_addrIY_plus_d(byte d) =>
+        TheAlu.Or(MainMemory.Peek(TheRegisters.IYPlusD(d)));
+
+    private void XOR_n(byte n) =>
+        TheAlu.Xor(n);
+
+    private void XOR_A() =>
+        TheAlu.Xor(TheRegisters.Main.A);
+
+    private void XOR_B() =>
+        TheAlu.Xor(TheRegisters.Main.B);
+
+    private void XOR_C() =>
+        TheAlu.Xor(TheRegisters.Main.C);
+
+    private void XOR_D() =>
+        TheAlu.Xor(TheRegisters.Main.D);
+
+    private void XOR_E() =>
+        TheAlu.Xor(TheRegisters.Main.E);
+
+    private void XOR_H() =>
+        TheAlu.Xor(TheRegisters.Main.H);
+
+    private void XOR_L() =>
+        TheAlu.Xor(TheRegisters.Main.L);
+
+    private void XOR_addrHL() =>
+        TheAlu.Xor(MainMemory.Peek(TheRegisters.Main.HL));
+
+    private void XOR_addrIX_plus_d(byte d) =>
+        TheAlu.Xor(MainMemory.Peek(TheRegisters.IXPlusD(d)));
+
+    private void XOR_addrIY_plus_d(byte d) =>
+        TheAlu.Xor(MainMemory.Peek(TheRegisters.IYPlusD(d)));
+
+    private void CCF()
+    {
+        TheRegisters.HalfCarryFlag = TheRegisters.CarryFlag;
+        TheRegisters.CarryFlag = !TheRegisters.CarryFlag;
+        TheRegisters.SubtractFlag = false;
+        TheRegisters.SetFlags53From(TheRegisters.Main.A);
+    }
+
+    private void CPL()
+    {
+        TheRegisters.HalfCarryFlag = true;
+        TheRegisters.SubtractFlag = true;
+        TheRegisters.Main.A = (byte)~TheRegisters.Main.A;
+        TheRegisters.SetFlags53From(TheRegisters.Main.A);
+    }
+
+    private void DAA() =>
+        TheAlu.AdjustAccumulatorToBcd();
+
+    private void EI() =>
+        TheRegisters.IFF1 = TheRegisters.IFF2 = true;
+
+    private void DI() =>
+        TheRegisters.IFF1 = TheRegisters.IFF2 = false;
+
+    private void HALT()
+    {
+        IsHalted = true;
+        TheRegisters.PC--;
+    }
+
+    private void IM0() =>
+        TheRegisters.IM = 0;
+
+    private void IM1() =>
+        TheRegisters.IM = 1;
+
+    private void IM2() =>
+        TheRegisters.IM = 2;
+
+    private void NEG()
+    {
+        var newA = TheAlu.SubtractAndSetFlags((byte)0x00, TheRegisters.Main.A, false);
+        TheRegisters.ParityFlag = TheRegisters.Main.A == 0x80;
+        TheRegisters.CarryFlag = TheRegisters.Main.A != 0x00;
+        TheRegisters.Main.A = newA;
+    }
+
+    private void SCF()
+    {
+        TheRegisters.HalfCarryFlag = false;
+        TheRegisters.CarryFlag = true;
+        TheRegisters.SubtractFlag = false;
+        TheRegisters.SetFlags53FromA();
+    }
+
+    private void RL_A() =>
+        TheRegisters.Main.A = TheAlu.RotateLeft(TheRegisters.Main.A);
+
+    private void RL_B() =>
+        TheRegisters.Main.B = TheAlu.RotateLeft(TheRegisters.Main.B);
+
+    private void RL_C() =>
+        TheRegisters.Main.C = TheAlu.RotateLeft(TheRegisters.Main.C);
+
+    private void RL_D() =>
+        TheRegisters.Main.D = TheAlu.RotateLeft(TheRegisters.Main.D);
+
+    private void RL_E() =>
+        TheRegisters.Main.E = TheAlu.RotateLeft(TheRegisters.Main.E);
+
+    private void RL_H() =>
+        TheRegisters.Main.H = TheAlu.RotateLeft(TheRegisters.Main.H);
+
+    private void RL_L() =>
+        TheRegisters.Main.L = TheAlu.RotateLeft(TheRegisters.Main.L);
+
+    private void RL_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.RotateLeft(MainMemory.Peek(TheRegisters.Main.HL)));
+
+    private void RLA()
+    {
+        var b = TheRegisters.Main.A;
+        var oldHighBit = (byte)(b & 0x80);
+        var oldCarry = (byte)(TheAlu.TheRegisters.CarryFlag ? 1 : 0);
+        b <<= 1;
+        b |= oldCarry;
+        TheAlu.TheRegisters.HalfCarryFlag = false;
+        TheAlu.TheRegisters.SubtractFlag = false;
+        TheAlu.TheRegisters.CarryFlag = oldHighBit != 0x00;
+        TheRegisters.Main.A = b;
+        TheRegisters.SetFlags53From(b);
+    }
+
+    private void RLC_A() =>
+        TheRegisters.Main.A = TheAlu.RotateLeftCircular(TheRegisters.Main.A);
+
+    private void RLC_B() =>
+        TheRegisters.Main.B = TheAlu.RotateLeftCircular(TheRegisters.Main.B);
+
+    private void RLC_C() =>
+        TheRegisters.Main.C = TheAlu.RotateLeftCircular(TheRegisters.Main.C);
+
+    private void RLC_D() =>
+        TheRegisters.Main.D = TheAlu.RotateLeftCircular(TheRegisters.Main.D);
+
+    private void RLC_E() =>
+        TheRegisters.Main.E = TheAlu.RotateLeftCircular(TheRegisters.Main.E);
+
+    private void RLC_H() =>
+        TheRegisters.Main.H = TheAlu.RotateLeftCircular(TheRegisters.Main.H);
+
+    private void RLC_L() =>
+        TheRegisters.Main.L = TheAlu.RotateLeftCircular(TheRegisters.Main.L);
+
+    private void RLCA()
+    {
+        TheRegisters.CarryFlag = (TheRegisters.Main.A & 0x80) != 0x00;
+        TheRegisters.Main.A = (byte)((TheRegisters.Main.A << 1) + (TheRegisters.Main.A >> 7));
+        TheRegisters.HalfCarryFlag = false;
+        TheRegisters.SubtractFlag = false;
+        TheRegisters.SetFlags53From(TheRegisters.Main.A);
+    }
+
+    private void RLC_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.RotateLeftCircular(MainMemory.Peek(TheRegisters.Main.HL)));
+
+    private void RR_A() =>
+        TheRegisters.Main.A = TheAlu.RotateRight(TheRegisters.Main.A);
+
+    private void RR_B() =>
+        TheRegisters.Main.B = TheAlu.RotateRight(TheRegisters.Main.B);
+
+    private void RR_C() =>
+        TheRegisters.Main.C = TheAlu.RotateRight(TheRegisters.Main.C);
+
+    private void RR_D() =>
+        TheRegisters.Main.D = TheAlu.RotateRight(TheRegisters.Main.D);
+
+    private void RR_E() =>
+        TheRegisters.Main.E = TheAlu.RotateRight(TheRegisters.Main.E);
+
+    private void RR_H() =>
+        TheRegisters.Main.H = TheAlu.RotateRight(TheRegisters.Main.H);
+
+    private void RR_L() =>
+        TheRegisters.Main.L = TheAlu.RotateRight(TheRegisters.Main.L);
+
+    private void RR_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.RotateRight(MainMemory.Peek(TheRegisters.Main.HL)));
+
+    private void RRA()
+    {
+        var oldCarry = (byte)(TheRegisters.CarryFlag ? 1 : 0);
+        TheRegisters.CarryFlag = (TheRegisters.Main.A & 0x01) != 0x00;
+        TheRegisters.Main.A = (byte)((TheRegisters.Main.A >> 1) + (oldCarry << 7));
+        TheRegisters.HalfCarryFlag = false;
+        TheRegisters.SubtractFlag = false;
+        TheRegisters.SetFlags53From(TheRegisters.Main.A);
+    }
+
+    private void RRC_A() =>
+        TheRegisters.Main.A = TheAlu.RotateRightCircular(TheRegisters.Main.A);
+
+    private void RRC_B() =>
+        TheRegisters.Main.B = TheAlu.RotateRightCircular(TheRegisters.Main.B);
+
+    private void RRC_C() =>
+        TheRegisters.Main.C = TheAlu.RotateRightCircular(TheRegisters.Main.C);
+
+    private void RRC_D() =>
+        TheRegisters.Main.D = TheAlu.RotateRightCircular(TheRegisters.Main.D);
+
+    private void RRC_E() =>
+        TheRegisters.Main.E = TheAlu.RotateRightCircular(TheRegisters.Main.E);
+
+    private void RRC_H() =>
+        TheRegisters.Main.H = TheAlu.RotateRightCircular(TheRegisters.Main.H);
+
+    private void RRC_L() =>
+        TheRegisters.Main.L = TheAlu.RotateRightCircular(TheRegisters.Main.L);
+
+    private void RRC_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.RotateRightCircular(MainMemory.Peek(TheRegisters.Main.HL)));
+
+    private void RRCA()
+    {
+        TheRegisters.CarryFlag = (TheRegisters.Main.A & 0x01) != 0x00;
+        var v = (byte)((TheRegisters.Main.A >> 1) + ((TheRegisters.Main.A & 0x01) << 7));
+        TheRegisters.Main.A = v;
+        TheRegisters.HalfCarryFlag = false;
+        TheRegisters.SubtractFlag = false;
+        TheRegisters.SetFlags53From(v);
+    }
+
+    private void SLA_A() =>
+        TheRegisters.Main.A = TheAlu.ShiftLeft(TheRegisters.Main.A);
+
+    private void SLA_B() =>
+        TheRegisters.Main.B = TheAlu.ShiftLeft(TheRegisters.Main.B);
+
+    private void SLA_C() =>
+        TheRegisters.Main.C = TheAlu.ShiftLeft(TheRegisters.Main.C);
+
+    private void SLA_D() =>
+        TheRegisters.Main.D = TheAlu.ShiftLeft(TheRegisters.Main.D);
+
+    private void SLA_E() =>
+        TheRegisters.Main.E = TheAlu.ShiftLeft(TheRegisters.Main.E);
+
+    private void SLA_H() =>
+        TheRegisters.Main.H = TheAlu.ShiftLeft(TheRegisters.Main.H);
+
+    private void SLA_L() =>
+        TheRegisters.Main.L = TheAlu.ShiftLeft(TheRegisters.Main.L);
+
+    private void SLA_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.ShiftLeft(MainMemory.Peek(TheRegisters.Main.HL)));
+
+    private void SLL_A() =>
+        TheRegisters.Main.A = TheAlu.ShiftLeft(TheRegisters.Main.A, 1);
+
+    private void SLL_B() =>
+        TheRegisters.Main.B = TheAlu.ShiftLeft(TheRegisters.Main.B, 1);
+
+    private void SLL_C() =>
+        TheRegisters.Main.C = TheAlu.ShiftLeft(TheRegisters.Main.C, 1);
+
+    private void SLL_D() =>
+        TheRegisters.Main.D = TheAlu.ShiftLeft(TheRegisters.Main.D, 1);
+
+    private void SLL_E() =>
+        TheRegisters.Main.E = TheAlu.ShiftLeft(TheRegisters.Main.E, 1);
+
+    private void SLL_H() =>
+        TheRegisters.Main.H = TheAlu.ShiftLeft(TheRegisters.Main.H, 1);
+
+    private void SLL_L() =>
+        TheRegisters.Main.L = TheAlu.ShiftLeft(TheRegisters.Main.L, 1);
+
+    private void SLL_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.ShiftLeft(MainMemory.Peek(TheRegisters.Main.HL), 1));
+
+    private void SRA_A() =>
+        TheRegisters.Main.A = TheAlu.ShiftRightArithmetic(TheRegisters.Main.A);
+
+    private void SRA_B() =>
+        TheRegisters.Main.B = TheAlu.ShiftRightArithmetic(TheRegisters.Main.B);
+
+    private void SRA_C() =>
+        TheRegisters.Main.C = TheAlu.ShiftRightArithmetic(TheRegisters.Main.C);
+
+    private void SRA_D() =>
+        TheRegisters.Main.D = TheAlu.ShiftRightArithmetic(TheRegisters.Main.D);
+
+    private void SRA_E() =>
+        TheRegisters.Main.E = TheAlu.ShiftRightArithmetic(TheRegisters.Main.E);
+
+    private void SRA_H() =>
+        TheRegisters.Main.H = TheAlu.ShiftRightArithmetic(TheRegisters.Main.H);
+
+    private void SRA_L() =>
+        TheRegisters.Main.L = TheAlu.ShiftRightArithmetic(TheRegisters.Main.L);
+
+    private void SRA_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.ShiftRightArithmetic(MainMemory.Peek(TheRegisters.Main.HL)));
+
+    private void SRL_A() =>
+        TheRegisters.Main.A = TheAlu.ShiftRightLogical(TheRegisters.Main.A);
+
+    private void SRL_B() =>
+        TheRegisters.Main.B = TheAlu.ShiftRightLogical(TheRegisters.Main.B);
+
+    private void SRL_C() =>
+        TheRegisters.Main.C = TheAlu.ShiftRightLogical(TheRegisters.Main.C);
+
+    private void SRL_D() =>
+        TheRegisters.Main.D = TheAlu.ShiftRightLogical(TheRegisters.Main.D);
+
+    private void SRL_E() =>
+        TheRegisters.Main.E = TheAlu.ShiftRightLogical(TheRegisters.Main.E);
+
+    private void SRL_H() =>
+        TheRegisters.Main.H = TheAlu.ShiftRightLogical(TheRegisters.Main.H);
+
+    private void SRL_L() =>
+        TheRegisters.Main.L = TheAlu.ShiftRightLogical(TheRegisters.Main.L);
+
+    private void SRL_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, TheAlu.ShiftRightLogical(MainMemory.Peek(TheRegisters.Main.HL)));
+
+    private void BIT_0_A() =>
+        doBitTest(TheRegisters.Main.A, 0);
+
+    private void BIT_1_A() =>
+        doBitTest(TheRegisters.Main.A, 1);
+
+    private void BIT_2_A() =>
+        doBitTest(TheRegisters.Main.A, 2);
+
+    private void BIT_3_A() =>
+        doBitTest(TheRegisters.Main.A, 3);
+
+    private void BIT_4_A() =>
+        doBitTest(TheRegisters.Main.A, 4);
+
+    private void BIT_5_A() =>
+        doBitTest(TheRegisters.Main.A, 5);
+
+    private void BIT_6_A() =>
+        doBitTest(TheRegisters.Main.A, 6);
+
+    private void BIT_7_A() =>
+        doBitTest(TheRegisters.Main.A, 7);
+
+    private void BIT_0_B() =>
+        doBitTest(TheRegisters.Main.B, 0);
+
+    private void BIT_1_B() =>
+        doBitTest(TheRegisters.Main.B, 1);
+
+    private void BIT_2_B() =>
+        doBitTest(TheRegisters.Main.B, 2);
+
+    private void BIT_3_B() =>
+        doBitTest(TheRegisters.Main.B, 3);
+
+    private void BIT_4_B() =>
+        doBitTest(TheRegisters.Main.B, 4);
+
+    private void BIT_5_B() =>
+        doBitTest(TheRegisters.Main.B, 5);
+
+    private void BIT_6_B() =>
+        doBitTest(TheRegisters.Main.B, 6);
+
+    private void BIT_7_B() =>
+        doBitTest(TheRegisters.Main.B, 7);
+
+    private void BIT_0_C() =>
+        doBitTest(TheRegisters.Main.C, 0);
+
+    private void BIT_1_C() =>
+        doBitTest(TheRegisters.Main.C, 1);
+
+    private void BIT_2_C() =>
+        doBitTest(TheRegisters.Main.C, 2);
+
+    private void BIT_3_C() =>
+        doBitTest(TheRegisters.Main.C, 3);
+
+    private void BIT_4_C() =>
+        doBitTest(TheRegisters.Main.C, 4);
+
+    private void BIT_5_C() =>
+        doBitTest(TheRegisters.Main.C, 5);
+
+    private void BIT_6_C() =>
+        doBitTest(TheRegisters.Main.C, 6);
+
+    private void BIT_7_C() =>
+        doBitTest(TheRegisters.Main.C, 7);
+
+    private void BIT_0_D() =>
+        doBitTest(TheRegisters.Main.D, 0);
+
+    private void BIT_1_D() =>
+        doBitTest(TheRegisters.Main.D, 1);
+
+    private void BIT_2_D() =>
+        doBitTest(TheRegisters.Main.D, 2);
+
+    private void BIT_3_D() =>
+        doBitTest(TheRegisters.Main.D, 3);
+
+    private void BIT_4_D() =>
+        doBitTest(TheRegisters.Main.D, 4);
+
+    private void BIT_5_D() =>
+        doBitTest(TheRegisters.Main.D, 5);
+
+    private void BIT_6_D() =>
+        doBitTest(TheRegisters.Main.D, 6);
+
+    private void BIT_7_D() =>
+        doBitTest(TheRegisters.Main.D, 7);
+
+    private void BIT_0_E() =>
+        doBitTest(TheRegisters.Main.E, 0);
+
+    private void BIT_1_E() =>
+        doBitTest(TheRegisters.Main.E, 1);
+
+    private void BIT_2_E() =>
+        doBitTest(TheRegisters.Main.E, 2);
+
+    private void BIT_3_E() =>
+        doBitTest(TheRegisters.Main.E, 3);
+
+    private void BIT_4_E() =>
+        doBitTest(TheRegisters.Main.E, 4);
+
+    private void BIT_5_E() =>
+        doBitTest(TheRegisters.Main.E, 5);
+
+    private void BIT_6_E() =>
+        doBitTest(TheRegisters.Main.E, 6);
+
+    private void BIT_7_E() =>
+        doBitTest(TheRegisters.Main.E, 7);
+
+    private void BIT_0_H() =>
+        doBitTest(TheRegisters.Main.H, 0);
+
+    private void BIT_1_H() =>
+        doBitTest(TheRegisters.Main.H, 1);
+
+    private void BIT_2_H() =>
+        doBitTest(TheRegisters.Main.H, 2);
+
+    private void BIT_3_H() =>
+        doBitTest(TheRegisters.Main.H, 3);
+
+    private void BIT_4_H() =>
+        doBitTest(TheRegisters.Main.H, 4);
+
+    private void BIT_5_H() =>
+        doBitTest(TheRegisters.Main.H, 5);
+
+    private void BIT_6_H() =>
+        doBitTest(TheRegisters.Main.H, 6);
+
+    private void BIT_7_H() =>
+        doBitTest(TheRegisters.Main.H, 7);
+
+    private void BIT_0_L() =>
+        doBitTest(TheRegisters.Main.L, 0);
+
+    private void BIT_1_L() =>
+        doBitTest(TheRegisters.Main.L, 1);
+
+    private void BIT_2_L() =>
+        doBitTest(TheRegisters.Main.L, 2);
+
+    private void BIT_3_L() =>
+        doBitTest(TheRegisters.Main.L, 3);
+
+    private void BIT_4_L() =>
+        doBitTest(TheRegisters.Main.L, 4);
+
+    private void BIT_5_L() =>
+        doBitTest(TheRegisters.Main.L, 5);
+
+    private void BIT_6_L() =>
+        doBitTest(TheRegisters.Main.L, 6);
+
+    private void BIT_7_L() =>
+        doBitTest(TheRegisters.Main.L, 7);
+
+    private void BIT_0_addrHL() =>
+        doBitTest(MainMemory.Peek(TheRegisters.Main.HL), 0);
+
+    private void BIT_1_addrHL() =>
+        doBitTest(MainMemory.Peek(TheRegisters.Main.HL), 1);
+
+    private void BIT_2_addrHL() =>
+        doBitTest(MainMemory.Peek(TheRegisters.Main.HL), 2);
+
+    private void BIT_3_addrHL() =>
+        doBitTest(MainMemory.Peek(TheRegisters.Main.HL), 3);
+
+    private void BIT_4_addrHL() =>
+        doBitTest(MainMemory.Peek(TheRegisters.Main.HL), 4);
+
+    private void BIT_5_addrHL() =>
+        doBitTest(MainMemory.Peek(TheRegisters.Main.HL), 5);
+
+    private void BIT_6_addrHL() =>
+        doBitTest(MainMemory.Peek(TheRegisters.Main.HL), 6);
+
+    private void BIT_7_addrHL() =>
+        doBitTest(MainMemory.Peek(TheRegisters.Main.HL), 7);
+
+    private void RES_0_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.ResetBit(0);
+
+    private void RES_1_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.ResetBit(1);
+
+    private void RES_2_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.ResetBit(2);
+
+    private void RES_3_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.ResetBit(3);
+
+    private void RES_4_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.ResetBit(4);
+
+    private void RES_5_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.ResetBit(5);
+
+    private void RES_6_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.ResetBit(6);
+
+    private void RES_7_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.ResetBit(7);
+
+    private void RES_0_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.ResetBit(0);
+
+    private void RES_1_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.ResetBit(1);
+
+    private void RES_2_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.ResetBit(2);
+
+    private void RES_3_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.ResetBit(3);
+
+    private void RES_4_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.ResetBit(4);
+
+    private void RES_5_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.ResetBit(5);
+
+    private void RES_6_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.ResetBit(6);
+
+    private void RES_7_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.ResetBit(7);
+
+    private void RES_0_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.ResetBit(0);
+
+    private void RES_1_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.ResetBit(1);
+
+    private void RES_2_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.ResetBit(2);
+
+    private void RES_3_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.ResetBit(3);
+
+    private void RES_4_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.ResetBit(4);
+
+    private void RES_5_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.ResetBit(5);
+
+    private void RES_6_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.ResetBit(6);
+
+    private void RES_7_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.ResetBit(7);
+
+    private void RES_0_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.ResetBit(0);
+
+    private void RES_1_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.ResetBit(1);
+
+    private void RES_2_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.ResetBit(2);
+
+    private void RES_3_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.ResetBit(3);
+
+    private void RES_4_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.ResetBit(4);
+
+    private void RES_5_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.ResetBit(5);
+
+    private void RES_6_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.ResetBit(6);
+
+    private void RES_7_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.ResetBit(7);
+
+    private void RES_0_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.ResetBit(0);
+
+    private void RES_1_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.ResetBit(1);
+
+    private void RES_2_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.ResetBit(2);
+
+    private void RES_3_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.ResetBit(3);
+
+    private void RES_4_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.ResetBit(4);
+
+    private void RES_5_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.ResetBit(5);
+
+    private void RES_6_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.ResetBit(6);
+
+    private void RES_7_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.ResetBit(7);
+
+    private void RES_0_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.ResetBit(0);
+
+    private void RES_1_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.ResetBit(1);
+
+    private void RES_2_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.ResetBit(2);
+
+    private void RES_3_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.ResetBit(3);
+
+    private void RES_4_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.ResetBit(4);
+
+    private void RES_5_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.ResetBit(5);
+
+    private void RES_6_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.ResetBit(6);
+
+    private void RES_7_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.ResetBit(7);
+
+    private void RES_0_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.ResetBit(0);
+
+    private void RES_1_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.ResetBit(1);
+
+    private void RES_2_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.ResetBit(2);
+
+    private void RES_3_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.ResetBit(3);
+
+    private void RES_4_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.ResetBit(4);
+
+    private void RES_5_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.ResetBit(5);
+
+    private void RES_6_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.ResetBit(6);
+
+    private void RES_7_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.ResetBit(7);
+
+    private void RES_0_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).ResetBit(0));
+
+    private void RES_1_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).ResetBit(1));
+
+    private void RES_2_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).ResetBit(2));
+
+    private void RES_3_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).ResetBit(3));
+
+    private void RES_4_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).ResetBit(4));
+
+    private void RES_5_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).ResetBit(5));
+
+    private void RES_6_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).ResetBit(6));
+
+    private void RES_7_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).ResetBit(7));
+
+    private void SET_0_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.SetBit(0);
+
+    private void SET_1_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.SetBit(1);
+
+    private void SET_2_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.SetBit(2);
+
+    private void SET_3_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.SetBit(3);
+
+    private void SET_4_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.SetBit(4);
+
+    private void SET_5_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.SetBit(5);
+
+    private void SET_6_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.SetBit(6);
+
+    private void SET_7_A() =>
+        TheRegisters.Main.A = TheRegisters.Main.A.SetBit(7);
+
+    private void SET_0_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.SetBit(0);
+
+    private void SET_1_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.SetBit(1);
+
+    private void SET_2_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.SetBit(2);
+
+    private void SET_3_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.SetBit(3);
+
+    private void SET_4_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.SetBit(4);
+
+    private void SET_5_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.SetBit(5);
+
+    private void SET_6_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.SetBit(6);
+
+    private void SET_7_B() =>
+        TheRegisters.Main.B = TheRegisters.Main.B.SetBit(7);
+
+    private void SET_0_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.SetBit(0);
+
+    private void SET_1_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.SetBit(1);
+
+    private void SET_2_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.SetBit(2);
+
+    private void SET_3_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.SetBit(3);
+
+    private void SET_4_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.SetBit(4);
+
+    private void SET_5_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.SetBit(5);
+
+    private void SET_6_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.SetBit(6);
+
+    private void SET_7_C() =>
+        TheRegisters.Main.C = TheRegisters.Main.C.SetBit(7);
+
+    private void SET_0_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.SetBit(0);
+
+    private void SET_1_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.SetBit(1);
+
+    private void SET_2_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.SetBit(2);
+
+    private void SET_3_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.SetBit(3);
+
+    private void SET_4_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.SetBit(4);
+
+    private void SET_5_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.SetBit(5);
+
+    private void SET_6_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.SetBit(6);
+
+    private void SET_7_D() =>
+        TheRegisters.Main.D = TheRegisters.Main.D.SetBit(7);
+
+    private void SET_0_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.SetBit(0);
+
+    private void SET_1_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.SetBit(1);
+
+    private void SET_2_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.SetBit(2);
+
+    private void SET_3_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.SetBit(3);
+
+    private void SET_4_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.SetBit(4);
+
+    private void SET_5_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.SetBit(5);
+
+    private void SET_6_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.SetBit(6);
+
+    private void SET_7_E() =>
+        TheRegisters.Main.E = TheRegisters.Main.E.SetBit(7);
+
+    private void SET_0_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.SetBit(0);
+
+    private void SET_1_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.SetBit(1);
+
+    private void SET_2_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.SetBit(2);
+
+    private void SET_3_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.SetBit(3);
+
+    private void SET_4_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.SetBit(4);
+
+    private void SET_5_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.SetBit(5);
+
+    private void SET_6_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.SetBit(6);
+
+    private void SET_7_H() =>
+        TheRegisters.Main.H = TheRegisters.Main.H.SetBit(7);
+
+    private void SET_0_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.SetBit(0);
+
+    private void SET_1_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.SetBit(1);
+
+    private void SET_2_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.SetBit(2);
+
+    private void SET_3_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.SetBit(3);
+
+    private void SET_4_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.SetBit(4);
+
+    private void SET_5_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.SetBit(5);
+
+    private void SET_6_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.SetBit(6);
+
+    private void SET_7_L() =>
+        TheRegisters.Main.L = TheRegisters.Main.L.SetBit(7);
+
+    private void SET_0_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).SetBit(0));
+
+    private void SET_1_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).SetBit(1));
+
+    private void SET_2_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).SetBit(2));
+
+    private void SET_3_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).SetBit(3));
+
+    private void SET_4_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).SetBit(4));
+
+    private void SET_5_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).SetBit(5));
+
+    private void SET_6_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).SetBit(6));
+
+    private void SET_7_addrHL() =>
+        MainMemory.Poke(TheRegisters.Main.HL, MainMemory.Peek(TheRegisters.Main.HL).SetBit(7));
+
+    private void CALL_nn(ushort nn) =>
+        CallIfTrue(nn, true);
+
+    private int CALL_NZ_nn(ushort nn) =>
+        CallIfTrue(nn, !TheRegisters.ZeroFlag) ? 17 : 10;
+
+    private int CALL_Z_nn(ushort nn) =>
+        CallIfTrue(nn, TheRegisters.ZeroFlag) ? 17 : 10;
+
+    private int CALL_NC_nn(ushort nn) =>
+        CallIfTrue(nn, !TheRegisters.CarryFlag) ? 17 : 10;
+
+    private int CALL_C_nn(ushort nn) =>
+        CallIfTrue(nn, TheRegisters.CarryFlag) ? 17 : 10;
+
+    private int CALL_PO_nn(ushort nn) =>
+        CallIfTrue(nn, !TheRegisters.ParityFlag) ? 17 : 10;
+
+    private int CALL_PE_nn(ushort nn) =>
+        CallIfTrue(nn, TheRegisters.ParityFlag) ? 17 : 10;
+
+    private int CALL_P_nn(ushort nn) =>
+        CallIfTrue(nn, !TheRegisters.SignFlag) ? 17 : 10;
+
+    private int CALL_M_nn(ushort nn) =>
+        CallIfTrue(nn, TheRegisters.SignFlag) ? 17 : 10;
+
+    private int CALL_DJNZ_n(byte n)
+    {
+        TheRegisters.Main.B--;
+        if (TheRegisters.Main.B == 0)
+            return 8;
+        TheRegisters.PC = (ushort)(TheRegisters.PC + Alu.FromTwosCompliment(n));
+        return 13;
+    }
+
+    private void JP_nn(ushort nn) =>
+        JumpIfTrue(nn, true);
+
+    private void JP_NZ_nn(ushort nn) =>
+        JumpIfTrue(nn, !TheRegisters.ZeroFlag);
+
+    private void JP_Z_nn(ushort nn) =>
+        JumpIfTrue(nn, TheRegisters.ZeroFlag);
+
+    private void JP_NC_nn(ushort nn) =>
+        JumpIfTrue(nn, !TheRegisters.CarryFlag);
+
+    private void JP_C_nn(ushort nn) =>
+        JumpIfTrue(nn, TheRegisters.CarryFlag);
+
+    private void JP_PO_nn(ushort nn) =>
+        JumpIfTrue(nn, !TheRegisters.ParityFlag);
+
+    private void JP_PE_nn(ushort nn) =>
+        JumpIfTrue(nn, TheRegisters.ParityFlag);
+
+    private void JP_P_nn(ushort nn) =>
+        JumpIfTrue(nn, !TheRegisters.SignFlag);
+
+    private void JP_M_nn(ushort nn) =>
+        JumpIfTrue(nn, TheRegisters.SignFlag);
+
+    private void JP_addrHL() =>
+        JumpIfTrue(TheRegisters.Main.HL, true);
+
+    private void JP_addr_IX() =>
+        JumpIfTrue(TheRegisters.IX, true);
+
+    private void JP_addr_IY() =>
+        JumpIfTrue(TheRegisters.IY, true);
+
+    private void JR_n(byte d) =>
+        JumpIfTrue((ushort)(TheRegisters.PC + Alu.FromTwosCompliment(d)), true);
+
+    private int JR_NZ_n(byte d) =>
+        JumpIfTrue((ushort)(TheRegisters.PC + Alu.FromTwosCompliment(d)), !TheRegisters.ZeroFlag) ? 12 : 7;
+
+    private int JR_Z_n(byte d) =>
+        JumpIfTrue((ushort)(TheRegisters.PC + Alu.FromTwosCompliment(d)), TheRegisters.ZeroFlag) ? 12 : 7;
+
+    private int JR_NC_n(byte d) =>
+        JumpIfTrue((ushort)(TheRegisters.PC + Alu.FromTwosCompliment(d)), !TheRegisters.CarryFlag) ? 12 : 7;
+
+    private int JR_C_n(byte d) =>
+        JumpIfTrue((ushort)(TheRegisters.PC + Alu.FromTwosCompliment(d)), TheRegisters.CarryFlag) ? 12 : 7;
+
+    private void RET() =>
+        doRet();
+
+    private int RET_NZ()
+    {
+        if (!TheRegisters.ZeroFlag)
+        {
+            doRet();
+            return 11;
+        }
+
+        return 5;
+    }
+
+    private int RET_Z()
+    {
+        if (!TheRegisters.ZeroFlag)
+            return 5;
+        doRet();
+        return 11;
+    }
+
+    private int RET_NC()
+    {
+        if (TheRegisters.CarryFlag)
+            return 5;
+        doRet();
+        return 11;
+    }
+
+    private int RET_C()
+    {
+        if (!TheRegisters.CarryFlag)
+            return 5;
+        doRet();
+        return 11;
+    }
+
+    private int RET_PO()
+    {
+        if (TheRegisters.ParityFlag)
+            return 5;
+        doRet();
+        return 11;
+    }
+
+    private int RET_PE()
+    {
+        if (!TheRegisters.ParityFlag)
+            return 5;
+        doRet();
+        return 11;
+    }
+
+    private int RET_P()
+    {
+        if (TheRegisters.SignFlag)
+            return 5;
+        doRet();
+        return 11;
+    }
+
+    private int RET_M()
+    {
+        if (!TheRegisters.SignFlag)
+            return 5;
+        doRet();
+        return 11;
+    }
+
+    private void RETI()
+    {
+        doRet();
+        TheRegisters.IFF1 = TheRegisters.IFF2;
+    }
+
+    private void RST_00()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.PC);
+        TheRegisters.PC = 0x0000;
+    }
+
+    private void RST_08()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.PC);
+        TheRegisters.PC = 0x0008;
+    }
+
+    private void RST_10()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.PC);
+        TheRegisters.PC = 0x0010;
+    }
+
+    private void RST_18()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.PC);
+        TheRegisters.PC = 0x0018;
+    }
+
+    private void RST_20()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.PC);
+        TheRegisters.PC = 0x0020;
+    }
+
+    private void RST_28()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.PC);
+        TheRegisters.PC = 0x0028;
+    }
+
+    private void RST_30()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.PC);
+        TheRegisters.PC = 0x0030;
+    }
+
+    private void RST_38()
+    {
+        TheRegisters.SP -= 2;
+        MainMemory.Poke(TheRegisters.SP, TheRegisters.PC);
+        TheRegisters.PC = 0x0038;
+    }
+
+    private void RLD()
+    {
+        int valueAtHl = MainMemory.Peek(TheRegisters.Main.HL);
+        var newValueAtHl = ((valueAtHl & 0x0f) << 4) + (TheRegisters.Main.A & 0x0f);
+        var newA = (TheRegisters.Main.A & 0xf0) + ((valueAtHl & 0xf0) >> 4);
+        TheRegisters.Main.A = (byte)newA;
+        MainMemory.Poke(TheRegisters.Main.HL, (byte)newValueAtHl);
+
+        TheRegisters.SignFlag = !Alu.IsBytePositive(TheRegisters.Main.A);
+        TheRegisters.ZeroFlag = TheRegisters.Main.A == 0;
+        TheRegisters.HalfCarryFlag = false;
+        TheRegisters.ParityFlag = Alu.IsEvenParity(TheRegisters.Main.A);
+        TheRegisters.SubtractFlag = false;
+        TheRegisters.SetFlags53FromA();
+    }
+
+    private void RRD()
+    {
+        int valueAtHl = MainMemory.Peek(TheRegisters.Main.HL);
+        var newValueAtHl = ((TheRegisters.Main.A & 0x0f) << 4) + ((valueAtHl & 0xf0) >> 4);
+        var newA = (TheRegisters.Main.A & 0xf0) + (valueAtHl & 0x0f);
+        TheRegisters.Main.A = (byte)newA;
+        MainMemory.Poke(TheRegisters.Main.HL, (byte)newValueAtHl);
+
+        TheRegisters.SignFlag = !Alu.IsBytePositive(TheRegisters.Main.A);
+        TheRegisters.ZeroFlag = TheRegisters.Main.A == 0;
+        TheRegisters.HalfCarryFlag = false;
+        TheRegisters.ParityFlag = Alu.IsEvenParity(TheRegisters.Main.A);
+        TheRegisters.SubtractFlag = false;
+        TheRegisters.SetFlags53FromA();
+    }
+
+    private void OUT_addr_C_0() =>
+        PortOut(TheRegisters.Main.BC, 0);
+
+    private void OUT_addr_n_A(byte n) =>
+        PortOut((ushort)(TheRegisters.Main.A << 8 | n), TheRegisters.Main.A);
+
+    private void OUT_A_addr_C() =>
+        PortOut(TheRegisters.Main.BC, TheRegisters.Main.A);
+
+    private void OUT_B_addr_C() =>
+        PortOut(TheRegisters.Main.BC, TheRegisters.Main.B);
+
+    private void OUT_C_addr_C() =>
+        PortOut(TheRegisters.Main.BC, TheRegisters.Main.C);
+
+    private void OUT_D_addr_C() =>
+        PortOut(TheRegisters.Main.BC, TheRegisters.Main.D);
+
+    private void OUT_E_addr_C() =>
+        PortOut(TheRegisters.Main.BC, TheRegisters.Main.E);
+
+    private void OUT_H_addr_C() =>
+        PortOut(TheRegisters.Main.BC, TheRegisters.Main.H);
+
+    private void OUT_L_addr_C() =>
+        PortOut(TheRegisters.Main.BC, TheRegisters.Main.L);
+
+    private void IN_A_addr_n(byte n)
+    {
+        if (ThePortHandler != null)
+        {
+            var portAddress = (TheRegisters.Main.A << 8) + n;
+            TheRegisters.Main.A = ThePortHandler.In((ushort)portAddress);
+        }
+    }
+
+    private void IN_A_addr_C() =>
+        TheRegisters.Main.A = doIN_addrC();
+
+    private void IN_B_addr_C() =>
+        TheRegisters.Main.B = doIN_addrC();
+
+    private void IN_C_addr_C() =>
+        TheRegisters.Main.C = doIN_addrC();
+
+    private void IN_D_addr_C() =>
+        TheRegisters.Main.D = doIN_addrC();
+
+    private void IN_E_addr_C() =>
+        TheRegisters.Main.E = doIN_addrC();
+
+    private void IN_H_addr_C() =>
+        TheRegisters.Main.H = doIN_addrC();
+
+    private void IN_L_addr_C() =>
+        TheRegisters.Main.L = doIN_addrC();
+
+    private void IN_addr_C() =>
+        doIN_addrC();
+
+    private void ADC_A_IXH() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.IXH, true);
+
+    private void ADC_A_IXL() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.IXL, true);
+
+    private void ADC_A_IYH() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.IYH, true);
+
+    private void ADC_A_IYL() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.IYL, true);
+
+    private void ADD_A_IXH() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.IXH, false);
+
+    private void ADD_A_IXL() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.IXL, false);
+
+    private void ADD_A_IYH() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.IYH, false);
+
+    private void ADD_A_IYL() =>
+        TheRegisters.Main.A = TheAlu.AddAndSetFlags(TheRegisters.Main.A, TheRegisters.IYL, false);
+
+    private void AND_IXH() =>
+        TheAlu.And(TheRegisters.IXH);
+
+    private void AND_IXL() =>
+        TheAlu.And(TheRegisters.IXL);
+
+    private void AND_IYH() =>
+        TheAlu.And(TheRegisters.IYH);
+
+    private void AND_IYL() =>
+        TheAlu.And(TheRegisters.IYL);
+
+    private void CP_IXH() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.IXH);
+
+    private void CP_IXL() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.IXL);
+
+    private void CP_IYH() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.IYH);
+
+    private void CP_IYL() =>
+        TheAlu.Compare(TheRegisters.Main.A, TheRegisters.IYL);
+
+    private void DEC_IXL() =>
+        TheRegisters.IXL = TheAlu.DecAndSetFlags(TheRegisters.IXL);
+
+    private void DEC_IXH() =>
+        TheRegisters.IXH = TheAlu.DecAndSetFlags(TheRegisters.IXH);
+
+    private void DEC_IYL() =>
+        TheRegisters.IYL = TheAlu.DecAndSetFlags(TheRegisters.IYL);
+
+    private void DEC_IYH() =>
+        TheRegisters.IYH = TheAlu.DecAndSetFlags(TheRegisters.IYH);
+
+    private void INC_IXL() =>
+        TheRegisters.IXL = TheAlu.IncAndSetFlags(TheRegisters.IXL);
+
+    private void INC_IYL() =>
+        TheRegisters.IYL = TheAlu.IncAndSetFlags(TheRegisters.IYL);
+
+    private void INC_IXH() =>
+        TheRegisters.IXH = TheAlu.IncAndSetFlags(TheRegisters.IXH);
+
+    private void INC_IYH() =>
+        TheRegisters.IYH = TheAlu.IncAndSetFlags(TheRegisters.IYH);
+
+    private void LD_A_IXH() =>
+        TheRegisters.Main.A = TheRegisters.IXH;
+
+    private void LD_A_IXL() =>
+        TheRegisters.Main.A = TheRegisters.IXL;
+
+    private void LD_A_IYH() =>
+        TheRegisters.Main.A = TheRegisters.IYH;
+
+    private void LD_A_IYL() =>
+        TheRegisters.Main.A = TheRegisters.IYL;
+
+    private void LD_B_IXH() =>
+        TheRegisters.Main.B = TheRegisters.IXH;
+
+    private void LD_B_IXL() =>
+        TheRegisters.Main.B = TheRegisters.IXL;
+
+    private void LD_B_IYH() =>
+        TheRegisters.Main.B = TheRegisters.IYH;
+
+    private void LD_B_IYL() =>
+        TheRegisters.Main.B = TheRegisters.IYL;
+
+    private void LD_C_IXH() =>
+        TheRegisters.Main.C = TheRegisters.IXH;
+
+    private void LD_C_IXL() =>
+        TheRegisters.Main.C = TheRegisters.IXL;
+
+    private void LD_C_IYH() =>
+        TheRegisters.Main.C = TheRegisters.IYH;
+
+    private void LD_C_IYL() =>
+        TheRegisters.Main.C = TheRegisters.IYL;
+
+    private void LD_D_IXH() =>
+        TheRegisters.Main.D = TheRegisters.IXH;
+
+    private void LD_D_IXL() =>
+        TheRegisters.Main.D = TheRegisters.IXL;
+
+    private void LD_D_IYH() =>
+        TheRegisters.Main.D = TheRegisters.IYH;
+
+    private void LD_D_IYL() =>
+        TheRegisters.Main.D = TheRegisters.IYL;
+
+    private void LD_E_IXH() =>
+        TheRegisters.Main.E = TheRegisters.IXH;
+
+    private void LD_E_IXL() =>
+        TheRegisters.Main.E = TheRegisters.IXL;
+
+    private void LD_E_IYH() =>
+        TheRegisters.Main.E = TheRegisters.IYH;
+
+    private void LD_E_IYL() =>
+        TheRegisters.Main.E = TheRegisters.IYL;
+
+    private void LD_IXH_A() =>
+        TheRegisters.IXH = TheRegisters.Main.A;
+
+    private void LD_IXH_B() =>
+        TheRegisters.IXH = TheRegisters.Main.B;
+
+    private void LD_IXH_C() =>
+        TheRegisters.IXH = TheRegisters.Main.C;
+
+    private void LD_IXH_D() =>
+        TheRegisters.IXH = TheRegisters.Main.D;
+
+    private void LD_IXH_E() =>
+        TheRegisters.IXH = TheRegisters.Main.E;
+
+    private void LD_IXH_IXH()
+    {
+    }
+
+    private void LD_IXH_IXL() =>
+        TheRegisters.IXH = TheRegisters.IXL;
+
+    private void LD_IXH_n(byte n) =>
+        TheRegisters.IXH = n;
+
+    private void LD_IXL_A() =>
+        TheRegisters.IXL = TheRegisters.Main.A;
+
+    private void LD_IXL_B() =>
+        TheRegisters.IXL = TheRegisters.Main.B;
+
+    private void LD_IXL_C() =>
+        TheRegisters.IXL = TheRegisters.Main.C;
+
+    private void LD_IXL_D() =>
+        TheRegisters.IXL = TheRegisters.Main.D;
+
+    private void LD_IXL_E() =>
+        TheRegisters.IXL = TheRegisters.Main.E;
+
+    private void LD_IXL_IXH() =>
+        TheRegisters.IXL = TheRegisters.IXH;
+
+    private void LD_IXL_IXL()
+    {
+    }
+
+    private void LD_IXL_n(byte n) =>
+        TheRegisters.IXL = n;
+
+    private void LD_IYH_A() =>
+        TheRegisters.IYH = TheRegisters.Main.A;
+
+    private void LD_IYH_B() =>
+        TheRegisters.IYH = TheRegisters.Main.B;
+
+    private void LD_IYH_C() =>
+        TheRegisters.IYH = TheRegisters.Main.C;
+
+    private void LD_IYH_D() =>
+        TheRegisters.IYH = TheRegisters.Main.D;
+
+    private void LD_IYH_E() =>
+        TheRegisters.IYH = TheRegisters.Main.E;
+
+    private void LD_IYH_IYH()
+    {
+    }
+
+    private void LD_IYH_IYL() =>
+        TheRegisters.IYH = TheRegisters.IYL;
+
+    private void LD_IYH_n(byte n) =>
+        TheRegisters.IYH = n;
+
+    private void LD_IYL_A() =>
+        TheRegisters.IYL = TheRegisters.Main.A;
+
+    private void LD_IYL_B() =>
+        TheRegisters.IYL = TheRegisters.Main.B;
+
+    private void LD_IYL_C() =>
+        TheRegisters.IYL = TheRegisters.Main.C;
+
+    private void LD_IYL_D() =>
+        TheRegisters.IYL = TheRegisters.Main.D;
+
+    private void LD_IYL_E() =>
+        TheRegisters.IYL = TheRegisters.Main.E;
+
+    private void LD_IYL_IYH() =>
+        TheRegisters.IYL = TheRegisters.IYH;
+
+    private void LD_IYL_IYL()
+    {
+    }
+
+    private void LD_IYL_n(byte n) =>
+        TheRegisters.IYL = n;
+
+    private void OR_IXH() =>
+        TheAlu.Or(TheRegisters.IXH);
+
+    private void OR_IXL() =>
+        TheAlu.Or(TheRegisters.IXL);
+
+    private void OR_IYH() =>
+        TheAlu.Or(TheRegisters.IYH);
+
+    private void OR_IYL() =>
+        TheAlu.Or(TheRegisters.IYL);
+
+    private void SBC_A_IXH() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.IXH, true);
+
+    private void SBC_A_IXL() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.IXL, true);
+
+    private void SBC_A_IYH() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.IYH, true);
+
+    private void SBC_A_IYL() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.IYL, true);
+
+    private void SUB_IXH() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.IXH, false);
+
+    private void SUB_IXL() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.IXL, false);
+
+    private void SUB_IYH() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.IYH, false);
+
+    private void SUB_IYL() =>
+        TheRegisters.Main.A = TheAlu.SubtractAndSetFlags(TheRegisters.Main.A, TheRegisters.IYL, false);
+
+    private void XOR_IXH() =>
+        TheAlu.Xor(TheRegisters.IXH);
+
+    private void XOR_IXL() =>
+        TheAlu.Xor(TheRegisters.IXL);
+
+    private void XOR_IYH() =>
+        TheAlu.Xor(TheRegisters.IYH);
+
+    private void XOR_IYL() =>
+        TheAlu.Xor(TheRegisters.IYL);
+
+    private void INI()
+    {
+        var hlMem = MainMemory.Poke(TheRegisters.Main.HL, ThePortHandler.In(TheRegisters.Main.BC));
+        TheRegisters.Main.HL++;
+        TheRegisters.Main.B = TheAlu.DecAndSetFlags(TheRegisters.Main.B);
+
+        // 'Undocumented'.
+        var incC = (TheRegisters.Main.C + 1) & 255;
+        TheRegisters.HalfCarryFlag = hlMem + incC > 255;
+        TheRegisters.CarryFlag = hlMem + incC > 255;
+        TheRegisters.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + incC) & 7) ^ TheRegisters.Main.B));
+        TheRegisters.SubtractFlag = (hlMem & 0x80) != 0;
+    }
+
+    private int INIR()
+    {
+        // Looping version of INI.
+        RunBulkBlockInOut((ushort)(TheRegisters.PC - 2), true, true);
+        var hlMem = MainMemory.Poke(TheRegisters.Main.HL, ThePortHandler.In(TheRegisters.Main.BC));
+        TheRegisters.Main.HL++;
+        TheRegisters.Main.B = TheAlu.DecAndSetFlags(TheRegisters.Main.B);
+        if (TheRegisters.Main.B != 0)
+            TheRegisters.PC -= 2; // Repeat.
+
+        // 'Undocumented'.
+        var incC = (TheRegisters.Main.C + 1) & 255;
+        TheRegisters.HalfCarryFlag = hlMem + incC > 255;
+        TheRegisters.CarryFlag = hlMem + incC > 255;
+        TheRegisters.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + incC) & 7) ^ TheRegisters.Main.B));
+        TheRegisters.SubtractFlag = (hlMem & 0x80) != 0;
+
+        return TheRegisters.Main.B == 0 ? 16 : 21;
+    }
+
+    private void IND()
+    {
+        var hlMem = MainMemory.Poke(TheRegisters.Main.HL, ThePortHandler.In(TheRegisters.Main.BC));
+        TheRegisters.Main.HL--;
+        TheRegisters.Main.B = TheAlu.DecAndSetFlags(TheRegisters.Main.B);
+
+        // 'Undocumented'.
+        var decC = (TheRegisters.Main.C - 1) & 255;
+        TheRegisters.HalfCarryFlag = hlMem + decC > 255;
+        TheRegisters.CarryFlag = hlMem + decC > 255;
+        TheRegisters.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + decC) & 7) ^ TheRegisters.Main.B));
+        TheRegisters.SubtractFlag = (hlMem & 0x80) != 0;
+    }
+
+    private int INDR()
+    {
+        // Looping version if IND.
+        RunBulkBlockInOut((ushort)(TheRegisters.PC - 2), true, false);
+        var hlMem = MainMemory.Poke(TheRegisters.Main.HL, ThePortHandler.In(TheRegisters.Main.BC));
+        TheRegisters.Main.HL--;
+        TheRegisters.Main.B = TheAlu.DecAndSetFlags(TheRegisters.Main.B);
+        if (TheRegisters.Main.B != 0)
+            TheRegisters.PC -= 2; // Repeat.
+
+        // 'Undocumented'.
+        var decC = (TheRegisters.Main.C - 1) & 255;
+        TheRegisters.HalfCarryFlag = hlMem + decC > 255;
+        TheRegisters.CarryFlag = hlMem + decC > 255;
+        TheRegisters.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + decC) & 7) ^ TheRegisters.Main.B));
+        TheRegisters.SubtractFlag = (hlMem & 0x80) != 0;
+
+        return TheRegisters.Main.B == 0 ? 16 : 21;
+    }
+
+    private void OUTI()
+    {
+        TheRegisters.Main.B = TheAlu.DecAndSetFlags(TheRegisters.Main.B);
+        var hlMem = MainMemory.Peek(TheRegisters.Main.HL);
+        PortOut(TheRegisters.Main.BC, hlMem);
+        TheRegisters.Main.HL++;
+
+        // 'Undocumented'.
+        TheRegisters.HalfCarryFlag = hlMem + TheRegisters.Main.L > 255;
+        TheRegisters.CarryFlag = hlMem + TheRegisters.Main.L > 255;
+        TheRegisters.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + TheRegisters.Main.L) & 7) ^ TheRegisters.Main.B));
+        TheRegisters.SubtractFlag = (hlMem & 0x80) != 0;
+    }
+
+    private int OTIR()
+    {
+        // Looping version of OUTI.
+        RunBulkBlockInOut((ushort)(TheRegisters.PC - 2), false, true);
+        var hlMem = MainMemory.Peek(TheRegisters.Main.HL);
+        TheRegisters.Main.B = TheAlu.DecAndSetFlags(TheRegisters.Main.B);
+        PortOut(TheRegisters.Main.BC, hlMem);
+        TheRegisters.Main.HL++;
+        if (TheRegisters.Main.B != 0)
+            TheRegisters.PC -= 2; // Repeat.
+
+        // 'Undocumented'.
+        TheRegisters.HalfCarryFlag = hlMem + TheRegisters.Main.L > 255;
+        TheRegisters.CarryFlag = hlMem + TheRegisters.Main.L > 255;
+        TheRegisters.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + TheRegisters.Main.L) & 7) ^ TheRegisters.Main.B));
+        TheRegisters.SubtractFlag = (hlMem & 0x80) != 0;
+
+        return TheRegisters.Main.B == 0 ? 16 : 21;
+    }
+
+    private void OUTD()
+    {
+        var hlMem = MainMemory.Peek(TheRegisters.Main.HL);
+        TheRegisters.Main.B = TheAlu.DecAndSetFlags(TheRegisters.Main.B);
+        PortOut(TheRegisters.Main.BC, hlMem);
+        TheRegisters.Main.HL--;
+
+        // 'Undocumented'.
+        TheRegisters.HalfCarryFlag = hlMem + TheRegisters.Main.L > 255;
+        TheRegisters.CarryFlag = hlMem + TheRegisters.Main.L > 255;
+        TheRegisters.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + TheRegisters.Main.L) & 7) ^ TheRegisters.Main.B));
+        TheRegisters.SubtractFlag = (hlMem & 0x80) != 0;
+    }
+
+    private int OTDR()
+    {
+        // Looping version of OUTD.
+        RunBulkBlockInOut((ushort)(TheRegisters.PC - 2), false, false);
+        var hlMem = MainMemory.Peek(TheRegisters.Main.HL);
+        TheRegisters.Main.B = TheAlu.DecAndSetFlags(TheRegisters.Main.B);
+        PortOut(TheRegisters.Main.BC, hlMem);
+        TheRegisters.Main.HL--;
+        if (TheRegisters.Main.B != 0)
+            TheRegisters.PC -= 2; // Repeat.
+
+        // 'Undocumented'.
+        TheRegisters.HalfCarryFlag = hlMem + TheRegisters.Main.L > 255;
+        TheRegisters.CarryFlag = hlMem + TheRegisters.Main.L > 255;
+        TheRegisters.ParityFlag = Alu.IsEvenParity((byte)(((hlMem + TheRegisters.Main.L) & 7) ^ TheRegisters.Main.B));
+        TheRegisters.SubtractFlag = (hlMem & 0x80) != 0;
+
+        return TheRegisters.Main.B == 0 ? 16 : 21;
+    }
+
+    // DD CB d op and FD CB d op - The generated opcode tables also copy the result to a register for undocumented opcodes.
+
+    private byte RLC_addrIX_plus_d(byte d)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.RotateLeftCircular(MainMemory.Peek(addr)));
+    }
+
+    private byte RRC_addrIX_plus_d(byte d)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.RotateRightCircular(MainMemory.Peek(addr)));
+    }
+
+    private byte RL_addrIX_plus_d(byte d)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.RotateLeft(MainMemory.Peek(addr)));
+    }
+
+    private byte RR_addrIX_plus_d(byte d)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.RotateRight(MainMemory.Peek(addr)));
+    }
+
+    private byte SLA_addrIX_plus_d(byte d)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.ShiftLeft(MainMemory.Peek(addr)));
+    }
+
+    private byte SRA_addrIX_plus_d(byte d)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.ShiftRightArithmetic(MainMemory.Peek(addr)));
+    }
+
+    private byte SLL_addrIX_plus_d(byte d)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.ShiftLeftLogical(MainMemory.Peek(addr)));
+    }
+
+    private byte SRL_addrIX_plus_d(byte d)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.ShiftRightLogical(MainMemory.Peek(addr)));
+    }
+
+    private void BIT_n_addrIX_plus_d(byte d, byte bit)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        doBitTest(MainMemory.Peek(addr), bit);
+        TheRegisters.SetFlags53From(addr);
+    }
+
+    private byte RES_n_addrIX_plus_d(byte d, byte bit)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, MainMemory.Peek(addr).ResetBit(bit));
+    }
+
+    private byte SET_n_addrIX_plus_d(byte d, byte bit)
+    {
+        var addr = TheRegisters.IXPlusD(d);
+        return MainMemory.Poke(addr, MainMemory.Peek(addr).SetBit(bit));
+    }
+
+    private byte RLC_addrIY_plus_d(byte d)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.RotateLeftCircular(MainMemory.Peek(addr)));
+    }
+
+    private byte RRC_addrIY_plus_d(byte d)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.RotateRightCircular(MainMemory.Peek(addr)));
+    }
+
+    private byte RL_addrIY_plus_d(byte d)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.RotateLeft(MainMemory.Peek(addr)));
+    }
+
+    private byte RR_addrIY_plus_d(byte d)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.RotateRight(MainMemory.Peek(addr)));
+    }
+
+    private byte SLA_addrIY_plus_d(byte d)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.ShiftLeft(MainMemory.Peek(addr)));
+    }
+
+    private byte SRA_addrIY_plus_d(byte d)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.ShiftRightArithmetic(MainMemory.Peek(addr)));
+    }
+
+    private byte SLL_addrIY_plus_d(byte d)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.ShiftLeftLogical(MainMemory.Peek(addr)));
+    }
+
+    private byte SRL_addrIY_plus_d(byte d)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, TheAlu.ShiftRightLogical(MainMemory.Peek(addr)));
+    }
+
+    private void BIT_n_addrIY_plus_d(byte d, byte bit)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        doBitTest(MainMemory.Peek(addr), bit);
+        TheRegisters.SetFlags53From(addr);
+    }
+
+    private byte RES_n_addrIY_plus_d(byte d, byte bit)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, MainMemory.Peek(addr).ResetBit(bit));
+    }
+
+    private byte SET_n_addrIY_plus_d(byte d, byte bit)
+    {
+        var addr = TheRegisters.IYPlusD(d);
+        return MainMemory.Poke(addr, MainMemory.Peek(addr).SetBit(bit));
     }
     
     /// <summary>
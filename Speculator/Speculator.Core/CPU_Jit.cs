@@ -0,0 +1,78 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+namespace Speculator.Core;
+
+/// <summary>
+/// Running compiled code blocks (See <see cref="BlockJit"/>).
+/// </summary>
+public partial class CPU
+{
+    private BlockJit m_blockJit;
+
+    /// <summary>
+    /// Compile straight-line code into .NET methods, used by StepToNextEvent() and StepBlock() (Default: Off).
+    /// </summary>
+    public bool UseJit
+    {
+        get => m_blockJit != null;
+        set
+        {
+            if (value == UseJit)
+                return;
+            
+            if (value)
+            {
+                m_blockJit = new BlockJit(this);
+            }
+            else
+            {
+                MainMemory.BlockJit = null;
+                m_blockJit = null;
+            }
+        }
+    }
+
+    /// <summary>
+    /// The number of code blocks currently compiled.
+    /// </summary>
+    public int CompiledBlockCount => m_blockJit?.CompiledBlockCount ?? 0;
+
+    /// <summary>
+    /// Run the compiled block at the current PC, followed by the instruction ending it,
+    /// handling events exactly as <see cref="Step"/> would.
+    /// </summary>
+    /// <remarks>
+    /// Runs a single instruction if there is no block at the current PC, or it would reach the next event.
+    /// </remarks>
+    public void StepBlock()
+    {
+        TryRunCompiledBlock(GetNextEventTStates());
+        Step();
+    }
+
+    /// <summary>
+    /// Run the compiled block at the current PC, if there is one which completes before the next event.
+    /// </summary>
+    private bool TryRunCompiledBlock(long eventTStates) =>
+        m_blockJit != null && m_profiler == null && !IsHalted && m_blockJit.TryRun(TheRegisters.PC, eventTStates - TStatesSinceCpuStart - 1);
+
+    /// <summary>
+    /// Called by a compiled block to account for the instructions it has run, as StepToNextEvent() would.
+    /// </summary>
+    internal void RetireInstructions(int tStates, int rIncrements)
+    {
+        TStatesSinceCpuStart += tStates;
+        var r = TheRegisters.R;
+        TheRegisters.R = (byte)((r + rIncrements & 0x7F) | (r & 0x80));
+    }
+}
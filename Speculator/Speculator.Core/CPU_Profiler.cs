@@ -0,0 +1,64 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using Speculator.Core.Debugger;
+
+namespace Speculator.Core;
+
+/// <summary>
+/// Feeding the execution profiler (See <see cref="Debugger.Profiler"/>).
+/// </summary>
+public partial class CPU
+{
+    private volatile Profiler m_profiler;
+
+    /// <summary>
+    /// The results of the most recent profiling session.
+    /// </summary>
+    public Profiler Profiler { get; private set; }
+
+    /// <summary>
+    /// Record where execution time is spent, starting a new <see cref="Profiler"/> session (Default: Off).
+    /// </summary>
+    /// <remarks>
+    /// Whilst on, StepToNextEvent() runs one instruction at a time. When off, the only cost is a null check per event.
+    /// Can be switched from any thread - The change is applied between steps.
+    /// </remarks>
+    public bool IsProfiling
+    {
+        get => m_profiler != null;
+        set
+        {
+            lock (CpuStepLock)
+            {
+                if (value == IsProfiling)
+                    return;
+
+                if (value)
+                    Profiler = m_profiler = new Profiler(this);
+                else
+                    m_profiler = null;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Execute the instruction at the current PC, recording it in the profiler.
+    /// </summary>
+    private int TickProfiled(Profiler profiler)
+    {
+        var pc = TheRegisters.PC;
+        var sp = TheRegisters.SP;
+        var tStates = Tick();
+        profiler.OnInstruction(pc, sp, tStates);
+        return tStates;
+    }
+}
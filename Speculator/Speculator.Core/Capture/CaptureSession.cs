@@ -0,0 +1,112 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+namespace Speculator.Core.Capture;
+
+/// <summary>
+/// Records a headless machine's beeper to a WAV file and its screen to a video file, as it runs.
+/// </summary>
+/// <remarks>
+/// The machine isn't paced to real time and has no host devices, so capture runs as fast as the
+/// emulation. Frames and samples are rendered exactly as <see cref="ZxDisplay"/> and
+/// <see cref="SoundHandler"/> would, then handed to background file writers.
+/// Usage: Wrap the calls to <see cref="HeadlessZxSpectrum.RunFrames"/> in a using block.
+/// </remarks>
+public sealed class CaptureSession : IDisposable
+{
+    private const int SampleHz = 44100;
+    private readonly CPU m_cpu;
+    private readonly HeadlessPortHandler m_portHandler;
+    private readonly UlaEventLog m_ulaEvents;
+    private readonly BeeperSynth m_beeper;
+    private readonly WavFileWriter m_audioWriter;
+    private readonly VideoFileWriter m_videoWriter;
+    private readonly byte[] m_screenBuffer = ZxDisplay.CreateScreenBuffer();
+    private byte m_borderAttr;
+    private int m_flashFrameCount;
+    private bool m_isFlashing;
+    private bool m_didPixelsChange;
+
+    /// <summary>
+    /// The number of frames captured so far.
+    /// </summary>
+    public int FrameCount { get; private set; }
+
+    /// <param name="machine">The machine to capture from.</param>
+    /// <param name="audioFile">The WAV file to write, or null for no audio.</param>
+    /// <param name="videoFile">The .y4m (Or raw palette index) file to write, or null for no video.</param>
+    public CaptureSession(HeadlessZxSpectrum machine, FileInfo audioFile, FileInfo videoFile)
+    {
+        m_cpu = machine.TheCpu;
+        m_portHandler = machine.PortHandler;
+        m_borderAttr = m_portHandler.BorderAttr;
+
+        if (audioFile != null)
+        {
+            m_beeper = new BeeperSynth(SampleHz);
+            m_beeper.Restart(m_cpu.TStatesSinceCpuStart);
+            m_audioWriter = new WavFileWriter(audioFile, SampleHz);
+        }
+
+        if (videoFile != null)
+            m_videoWriter = new VideoFileWriter(videoFile);
+
+        // The screen is drawn even without video, as completing it marks the end of each frame.
+        m_ulaEvents = new UlaEventLog(() => m_cpu.TStatesSinceCpuStart, m_borderAttr);
+        m_cpu.MainMemory.UlaEvents = m_ulaEvents;
+        m_cpu.MainMemory.MarkDisplayDirty();
+
+        m_portHandler.UlaWritten += OnUlaWritten;
+        m_cpu.RenderScanline += OnRenderScanline;
+    }
+
+    private void OnUlaWritten(object sender, byte value)
+    {
+        m_beeper?.AddEdge(m_cpu.TStatesSinceCpuStart + CPU.PortWriteTStates, (byte)((value & 0x18) >> 3));
+
+        var borderAttr = (byte)(value & 0x07);
+        if (borderAttr == m_borderAttr)
+            return;
+        m_borderAttr = borderAttr;
+        m_ulaEvents.AddBorderWrite(borderAttr);
+    }
+
+    private void OnRenderScanline(object sender, (Memory memory, int scanline) args)
+    {
+        // Draw the scanline just completed, now all its events are known.
+        if (args.scanline == 0)
+            return;
+        if (!ZxDisplay.RenderScanlineWithEvents(args.memory, args.scanline - 1, m_ulaEvents, m_screenBuffer, m_isFlashing, ref m_didPixelsChange))
+            return;
+
+        if (m_flashFrameCount++ == ZxDisplay.FramesPerFlash)
+        {
+            m_isFlashing = !m_isFlashing;
+            m_flashFrameCount = 0;
+            ZxDisplay.MarkFlashingCellsDirty(args.memory);
+        }
+
+        m_videoWriter?.WriteFrame(m_screenBuffer);
+        if (m_beeper != null)
+            m_audioWriter.Write(m_beeper.EndFrame(m_cpu.TStatesSinceCpuStart));
+        FrameCount++;
+    }
+
+    public void Dispose()
+    {
+        m_cpu.RenderScanline -= OnRenderScanline;
+        m_portHandler.UlaWritten -= OnUlaWritten;
+        m_cpu.MainMemory.UlaEvents = null;
+
+        m_audioWriter?.Dispose();
+        m_videoWriter?.Dispose();
+    }
+}
@@ -0,0 +1,83 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using System.Text;
+using Speculator.Core.Utils;
+
+namespace Speculator.Core.Capture;
+
+/// <summary>
+/// Streams 320x240 palette-index frames into a file, as uncompressed YUV4MPEG2 (.y4m) or raw indices.
+/// </summary>
+/// <remarks>
+/// Y4M frames are full-resolution 4:4:4 (BT.601), so attribute clash survives intact and the file plays
+/// in most video tools. Any other extension stores one palette index (0 - 15) per pixel, with no header.
+/// </remarks>
+internal sealed class VideoFileWriter : IDisposable
+{
+    private const int FrameSize = ZxDisplay.ScreenWidth * ZxDisplay.ScreenHeight;
+    private static readonly byte[] FrameHeader = Encoding.ASCII.GetBytes("FRAME\n");
+    private readonly AsyncFileWriter m_writer;
+    private readonly bool m_isY4m;
+
+    /// <summary>
+    /// The Y, U and V value of each palette index.
+    /// </summary>
+    private readonly byte[][] m_planeLookups;
+
+    /// <summary>
+    /// Reused to hold the YUV planes of each frame.
+    /// </summary>
+    private readonly byte[] m_planes;
+
+    public VideoFileWriter(FileInfo file)
+    {
+        m_isY4m = file.Extension.Equals(".y4m", StringComparison.OrdinalIgnoreCase);
+        m_writer = new AsyncFileWriter(file, 1024 * 1024);
+        if (!m_isY4m)
+            return;
+
+        m_planeLookups = new[] { new byte[16], new byte[16], new byte[16] };
+        for (var i = 0; i < 16; i++)
+        {
+            var rgb = ZxDisplay.Colors[i] / 255.0f;
+            m_planeLookups[0][i] = (byte)Math.Round(16.0 + 65.481 * rgb.X + 128.553 * rgb.Y + 24.966 * rgb.Z);
+            m_planeLookups[1][i] = (byte)Math.Round(128.0 - 37.797 * rgb.X - 74.203 * rgb.Y + 112.0 * rgb.Z);
+            m_planeLookups[2][i] = (byte)Math.Round(128.0 + 112.0 * rgb.X - 93.786 * rgb.Y - 18.214 * rgb.Z);
+        }
+
+        m_planes = new byte[3 * FrameSize];
+        m_writer.Write(Encoding.ASCII.GetBytes($"YUV4MPEG2 W{ZxDisplay.ScreenWidth} H{ZxDisplay.ScreenHeight} F50:1 Ip A1:1 C444\n"));
+    }
+
+    public void WriteFrame(byte[] screenBuffer)
+    {
+        if (!m_isY4m)
+        {
+            m_writer.Write(screenBuffer);
+            return;
+        }
+
+        for (var plane = 0; plane < 3; plane++)
+        {
+            var lookup = m_planeLookups[plane];
+            var output = m_planes.AsSpan(plane * FrameSize, FrameSize);
+            for (var i = 0; i < output.Length; i++)
+                output[i] = lookup[screenBuffer[i]];
+        }
+
+        m_writer.Write(FrameHeader);
+        m_writer.Write(m_planes);
+    }
+
+    public void Dispose() =>
+        m_writer.Dispose();
+}
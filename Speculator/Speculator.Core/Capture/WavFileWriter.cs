@@ -0,0 +1,70 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using System.Runtime.InteropServices;
+using System.Text;
+using Speculator.Core.Utils;
+
+namespace Speculator.Core.Capture;
+
+/// <summary>
+/// Streams 16-bit mono samples into a WAV file.
+/// </summary>
+/// <remarks>
+/// The header's sizes are unknown until the stream ends, so are filled in when disposed.
+/// </remarks>
+internal sealed class WavFileWriter : IDisposable
+{
+    private const int HeaderSize = 44;
+    private readonly FileInfo m_file;
+    private readonly int m_sampleHz;
+    private readonly AsyncFileWriter m_writer;
+
+    public WavFileWriter(FileInfo file, int sampleHz)
+    {
+        m_file = file;
+        m_sampleHz = sampleHz;
+        m_writer = new AsyncFileWriter(file, 64 * 1024);
+        m_writer.Write(CreateHeader(0));
+    }
+
+    public void Write(ReadOnlySpan<short> samples) =>
+        m_writer.Write(MemoryMarshal.AsBytes(samples));
+
+    public void Dispose()
+    {
+        var dataSize = (int)(m_writer.Length - HeaderSize);
+        m_writer.Dispose();
+
+        using var stream = m_file.OpenWrite();
+        stream.Write(CreateHeader(dataSize));
+    }
+
+    private byte[] CreateHeader(int dataSize)
+    {
+        using var stream = new MemoryStream(HeaderSize);
+        using var writer = new BinaryWriter(stream, Encoding.ASCII);
+        writer.Write("RIFF"u8);
+        writer.Write(HeaderSize - 8 + dataSize);
+        writer.Write("WAVE"u8);
+        writer.Write("fmt "u8);
+        writer.Write(16);                   // Format chunk size.
+        writer.Write((short)1);             // PCM.
+        writer.Write((short)1);             // Mono.
+        writer.Write(m_sampleHz);
+        writer.Write(m_sampleHz * sizeof(short));
+        writer.Write((short)sizeof(short)); // Bytes per sample frame.
+        writer.Write((short)16);            // Bits per sample.
+        writer.Write("data"u8);
+        writer.Write(dataSize);
+        return stream.ToArray();
+    }
+}
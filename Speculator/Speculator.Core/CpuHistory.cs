@@ -64,7 +64,7 @@ public class CpuHistory : ViewModelBase
     {
         m_zxFileIo = zxFileIo;
         TheCpu = theCpu;
-        theCpu.Ticked += OnCpuTicked;
+        theCpu.RenderScanline += OnRenderScanline;
         m_ticksToNextSample = TicksPerSample * 2; // Start 2 seconds after machine start.
 
         zxFileIo.RomLoaded += (_, romType) =>
@@ -77,9 +77,11 @@ public class CpuHistory : ViewModelBase
         };
     }
 
-    private void OnCpuTicked(object sender, (int elapsedTicks, ushort prevPC, ushort currentPC) args)
+    private void OnRenderScanline(object sender, (Memory memory, int scanline) args)
     {
-        m_ticksToNextSample -= args.elapsedTicks;
+        if (args.scanline != 0)
+            return; // Only count whole frames.
+        m_ticksToNextSample -= CPU.TStatesPerInterrupt;
         if (m_ticksToNextSample > 0)
             return; // Not yet time for an action to be triggered.
         m_ticksToNextSample += TicksPerSample;
@@ -87,7 +89,7 @@ public class CpuHistory : ViewModelBase
         // Sample CPU state.
         using var snapshot = new MemoryStream(49179);
         m_zxFileIo.WriteSnaToStream(snapshot);
-        m_snapshots.Add(TheCpu.TStatesSinceCpuStart, snapshot.GetBuffer());
+        m_snapshots.Add(TheCpu.TStatesSinceCpuStart, snapshot.ToArray());
         
         // Trim the total number of snapshots.
         while (m_snapshots.Count > MaxSamples)
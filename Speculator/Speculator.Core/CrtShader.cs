@@ -0,0 +1,170 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using System.Numerics;
+using System.Runtime.InteropServices;
+using OpenTK.Mathematics;
+using Vector3 = System.Numerics.Vector3;
+
+namespace Speculator.Core;
+
+/// <summary>
+/// Expands rows of palette indices into the UI bitmap, as 3x4 blocks of RGB phosphor dots and scanlines.
+/// </summary>
+/// <remarks>
+/// Everything depending only on the pixel position (Grain, vignette and brightness) is precomputed
+/// when the settings change, leaving a multiply-add per channel, done for <see cref="Vector{T}.Count"/>
+/// bitmap columns at a time.
+/// </remarks>
+internal sealed class CrtShader
+{
+    private static readonly Vector<uint> AlphaMask = new Vector<uint>(0xFF000000);
+    private static readonly Vector<float> V255 = new Vector<float>(255.0f);
+
+    /// <summary>
+    /// The number of bitmap columns (Phosphor dots) in a row.
+    /// </summary>
+    private readonly int m_columnCount;
+
+    private readonly float[] m_paletteR;
+    private readonly float[] m_paletteG;
+    private readonly float[] m_paletteB;
+
+    /// <summary>
+    /// Per-column vignette × brightness.
+    /// </summary>
+    private readonly float[] m_scales;
+
+    /// <summary>
+    /// Per-column grain, pre-multiplied by the column's scale.
+    /// </summary>
+    private readonly float[] m_offsets;
+
+    /// <summary>
+    /// The saturation × phosphor mask of each lane, for each of the three vectors a repeating R, G, B
+    /// column pattern spans (As <see cref="Vector{T}.Count"/> is never a multiple of three).
+    /// </summary>
+    private readonly Vector<float>[] m_gainsR = new Vector<float>[3];
+    private readonly Vector<float>[] m_gainsG = new Vector<float>[3];
+    private readonly Vector<float>[] m_gainsB = new Vector<float>[3];
+
+    private readonly Vector3 m_scanlineMultiplier;
+
+    /// <param name="palette">RGB color (0-255) for each palette index.</param>
+    /// <param name="grain">Per-pixel grain, in rows of 'width' pixels.</param>
+    /// <param name="isCrt">False for flat pixels, ignoring the grain, brightness and saturation.</param>
+    public CrtShader(Vector3[] palette, float[][] grain, int width, bool isCrt, float brightness, Vector3 saturation, float phosphorShrink, Vector3 scanlineMultiplier)
+    {
+        m_columnCount = width * 3;
+        if (m_columnCount % Vector<float>.Count != 0)
+            throw new ArgumentException("Row width must fill whole vectors.", nameof(width));
+
+        m_paletteR = palette.Select(o => o.X).ToArray();
+        m_paletteG = palette.Select(o => o.Y).ToArray();
+        m_paletteB = palette.Select(o => o.Z).ToArray();
+        m_scanlineMultiplier = scanlineMultiplier;
+
+        var height = grain.Length;
+        m_scales = new float[m_columnCount * height];
+        m_offsets = new float[m_columnCount * height];
+        for (var y = 0; y < height; y++)
+        {
+            var uvY = (double)y / height;
+            for (var x = 0; x < width; x++)
+            {
+                var scale = 1.0f;
+                var offset = 0.0f;
+                if (isCrt)
+                {
+                    var uvX = (double)x / width;
+                    var vignette = (float)MathHelper.Lerp(0.7, 1.0, Math.Sqrt(64.0 * uvX * uvY * (1.0 - uvX) * (1.0 - uvY)));
+                    scale = brightness * vignette;
+                    offset = grain[y][x] * scale;
+                }
+
+                var i = (y * width + x) * 3;
+                m_scales.AsSpan(i, 3).Fill(scale);
+                m_offsets.AsSpan(i, 3).Fill(offset);
+            }
+        }
+
+        var columnSaturation = isCrt ? saturation : Vector3.One;
+        var columnGains = new[]
+        {
+            columnSaturation * new Vector3(1.0f, phosphorShrink, phosphorShrink),
+            columnSaturation * new Vector3(phosphorShrink, 1.0f, phosphorShrink),
+            columnSaturation * new Vector3(phosphorShrink, phosphorShrink, 1.0f)
+        };
+        var n = Vector<float>.Count;
+        for (var phase = 0; phase < 3; phase++)
+        {
+            var gains = Enumerable.Range(phase * n, n).Select(o => columnGains[o % 3]).ToArray();
+            m_gainsR[phase] = new Vector<float>(gains.Select(o => o.X).ToArray());
+            m_gainsG[phase] = new Vector<float>(gains.Select(o => o.Y).ToArray());
+            m_gainsB[phase] = new Vector<float>(gains.Select(o => o.Z).ToArray());
+        }
+    }
+
+    /// <summary>
+    /// Render a row of palette indices into bitmap rows y * 4 to y * 4 + 3.
+    /// </summary>
+    public void RenderRow(ReadOnlySpan<byte> row, int y, Span<byte> frameBuffer, int stride)
+    {
+        var rowBytes = m_columnCount * 4;
+        var litBytes = frameBuffer.Slice(y * 4 * stride, rowBytes);
+        var litRow = MemoryMarshal.Cast<byte, Vector<uint>>(litBytes);
+        var scanlineRow = MemoryMarshal.Cast<byte, Vector<uint>>(frameBuffer.Slice((y * 4 + 3) * stride, rowBytes));
+        var scales = MemoryMarshal.Cast<float, Vector<float>>(m_scales.AsSpan(y * m_columnCount, m_columnCount));
+        var offsets = MemoryMarshal.Cast<float, Vector<float>>(m_offsets.AsSpan(y * m_columnCount, m_columnCount));
+
+        var n = Vector<float>.Count;
+        Span<float> r = stackalloc float[n];
+        Span<float> g = stackalloc float[n];
+        Span<float> b = stackalloc float[n];
+        var phase = 0;
+        for (var v = 0; v < litRow.Length; v++)
+        {
+            // Each pixel's color, repeated across its three columns.
+            var column = v * n;
+            for (var i = 0; i < n; i++)
+            {
+                var index = row[(column + i) / 3];
+                r[i] = m_paletteR[index];
+                g[i] = m_paletteG[index];
+                b[i] = m_paletteB[index];
+            }
+
+            var scale = scales[v];
+            var offset = offsets[v];
+            var litR = Clamp((new Vector<float>(r) * scale + offset) * m_gainsR[phase]);
+            var litG = Clamp((new Vector<float>(g) * scale + offset) * m_gainsG[phase]);
+            var litB = Clamp((new Vector<float>(b) * scale + offset) * m_gainsB[phase]);
+            litRow[v] = Pack(litR, litG, litB);
+            scanlineRow[v] = Pack(Clamp(litR * m_scanlineMultiplier.X), Clamp(litG * m_scanlineMultiplier.Y), Clamp(litB * m_scanlineMultiplier.Z));
+
+            if (++phase == 3)
+                phase = 0;
+        }
+
+        // The first three rows of each pixel are identical.
+        litBytes.CopyTo(frameBuffer.Slice((y * 4 + 1) * stride));
+        litBytes.CopyTo(frameBuffer.Slice((y * 4 + 2) * stride));
+    }
+
+    private static Vector<float> Clamp(Vector<float> v) =>
+        Vector.Min(Vector.Max(v, Vector<float>.Zero), V255);
+
+    /// <summary>
+    /// Pack to 32-bit [A B G R] little-endian pixels, with alpha forced to 0xFF.
+    /// </summary>
+    private static Vector<uint> Pack(Vector<float> r, Vector<float> g, Vector<float> b) =>
+        Vector.AsVectorUInt32(Vector.ConvertToInt32(r) | Vector.ShiftLeft(Vector.ConvertToInt32(g), 8) | Vector.ShiftLeft(Vector.ConvertToInt32(b), 16)) | AlphaMask;
+}
@@ -20,7 +20,7 @@ public class MemoryDumpViewModel
 
     public MemoryDumpViewModel(Memory memory)
     {
-        var lineCount = memory.Data.Length / 8;
+        const int lineCount = 0x10000 / 8;
         Content = new ObservableCollection<SingleItem>(Enumerable.Range(0, lineCount).Select(i => new SingleItem(memory, (ushort)(i * 8))));
 
         memory.DataLoaded += (_, _) => Refresh();
@@ -0,0 +1,259 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using System.Text;
+using Speculator.Core.Extensions;
+
+namespace Speculator.Core.Debugger;
+
+/// <summary>
+/// Records how often each address is executed, and the T-states spent there,
+/// along with a call graph inferred from CALL/RST/RET and interrupts.
+/// </summary>
+/// <remarks>
+/// Created by the CPU when <see cref="CPU.IsProfiling"/> is enabled, and fed from the CPU loop directly.
+/// Results should be read with the <see cref="CPU.CpuStepLock"/> held if the CPU is running.
+/// </remarks>
+public class Profiler
+{
+    /// <summary>
+    /// Deeper calls are counted against the deepest routine, to bound runaway recursion.
+    /// </summary>
+    private const int MaxCallDepth = 256;
+
+    /// <summary>
+    /// Stands in for the routine which was running when profiling started.
+    /// </summary>
+    private const int RootAddr = -1;
+
+    private readonly CPU m_cpu;
+    private readonly long[] m_hitCounts = new long[0x10000];
+    private readonly long[] m_tStates = new long[0x10000];
+    private readonly int[] m_routineAddrs = new int[0x10000];
+    private readonly List<ushort> m_returnSlots = new List<ushort>();
+    private readonly CallNode m_root = new CallNode(RootAddr, null);
+    private CallNode m_current;
+
+    /// <summary>
+    /// The number of times each instruction address was executed.
+    /// </summary>
+    public IReadOnlyList<long> HitCounts => m_hitCounts;
+
+    /// <summary>
+    /// The T-states spent executing the instruction at each address.
+    /// </summary>
+    public IReadOnlyList<long> TStates => m_tStates;
+
+    public long TotalTStates => m_root.TotalTStates;
+
+    public Profiler(CPU cpu)
+    {
+        m_cpu = cpu;
+        Clear();
+    }
+
+    public void Clear()
+    {
+        Array.Clear(m_hitCounts);
+        Array.Clear(m_tStates);
+        Array.Fill(m_routineAddrs, RootAddr);
+        m_returnSlots.Clear();
+        m_root.Clear();
+        m_current = m_root;
+    }
+
+    /// <summary>
+    /// Called after the instruction at the given address has been executed.
+    /// </summary>
+    /// <param name="pc">The address of the instruction.</param>
+    /// <param name="spBefore">The stack pointer before the instruction ran.</param>
+    /// <param name="tStates">The T-states the instruction took.</param>
+    internal void OnInstruction(ushort pc, ushort spBefore, int tStates)
+    {
+        m_hitCounts[pc]++;
+        m_tStates[pc] += tStates;
+        m_routineAddrs[pc] = m_current.Addr;
+        m_current.SelfTStates += tStates;
+
+        // Only taken calls and returns move the stack pointer by a single return address.
+        var sp = m_cpu.TheRegisters.SP;
+        if (sp == (ushort)(spBefore - 2) && IsCall(pc))
+            EnterRoutine(m_cpu.TheRegisters.PC, sp);
+        else if (sp == (ushort)(spBefore + 2) && IsReturn(pc))
+            LeaveRoutines(sp);
+    }
+
+    /// <summary>
+    /// Called after the CPU has pushed PC and jumped to the interrupt handler.
+    /// </summary>
+    internal void OnInterrupt(int tStates)
+    {
+        EnterRoutine(m_cpu.TheRegisters.PC, m_cpu.TheRegisters.SP);
+        m_current.SelfTStates += tStates;
+    }
+
+    private bool IsCall(ushort pc)
+    {
+        var opcode = m_cpu.MainMemory.Peek(pc);
+        return opcode == 0xCD || (opcode & 0xC7) is 0xC4 or 0xC7; // CALL nn, CALL cc,nn, RST n
+    }
+
+    private bool IsReturn(ushort pc)
+    {
+        var opcode = m_cpu.MainMemory.Peek(pc);
+        if (opcode == 0xC9 || (opcode & 0xC7) == 0xC0)
+            return true; // RET, RET cc
+        return opcode == 0xED && (m_cpu.MainMemory.Peek((ushort)(pc + 1)) & 0xC7) == 0x45; // RETI, RETN
+    }
+
+    private void EnterRoutine(ushort addr, ushort returnSlot)
+    {
+        if (m_returnSlots.Count == MaxCallDepth)
+            return;
+        m_returnSlots.Add(returnSlot);
+        m_current = m_current.GetChild(addr);
+        m_current.CallCount++;
+    }
+
+    /// <summary>
+    /// Leave every routine whose return address is now above the stack pointer.
+    /// </summary>
+    /// <remarks>
+    /// Usually just the current routine, but also unwinds routines which discarded
+    /// their return address (E.g. Using POP to return to a caller further up).
+    /// </remarks>
+    private void LeaveRoutines(ushort sp)
+    {
+        while (m_returnSlots.Count > 0 && m_returnSlots[^1] < sp)
+        {
+            m_returnSlots.RemoveAt(m_returnSlots.Count - 1);
+            m_current = m_current.Parent;
+        }
+    }
+
+    /// <summary>
+    /// The call graph as 'folded stacks' (One 'root;caller;callee T-states' line per call path),
+    /// as read by flame graph tools such as flamegraph.pl and speedscope.
+    /// </summary>
+    public void WriteFoldedStacks(TextWriter writer) =>
+        m_root.WriteFoldedStacks(writer, GetRoutineName(RootAddr));
+
+    /// <summary>
+    /// A report of the routines taking the most T-states, each followed by its busiest instructions.
+    /// </summary>
+    /// <remarks>
+    /// Each instruction is listed under the routine which last ran it.
+    /// </remarks>
+    public string GetHotList(int routineCount = 20, int instructionsPerRoutine = 12)
+    {
+        var routines = new Dictionary<int, RoutineStats>();
+        m_root.AddRoutineStats(routines, new Dictionary<int, int>());
+        var total = Math.Max(1, TotalTStates);
+
+        var hottest = routines.OrderByDescending(o => o.Value.SelfTStates).Take(routineCount).ToArray();
+        var sb = new StringBuilder();
+        sb.AppendLine($"{"Routine",-8}{"Calls",9}{"Self T-states",19}{"Self %",8}{"Total %",9}");
+        foreach (var (addr, stats) in hottest)
+            sb.AppendLine($"{GetRoutineName(addr),-8}{stats.CallCount,9}{stats.SelfTStates,19}{100.0 * stats.SelfTStates / total,8:F2}{100.0 * stats.TotalTStates / total,9:F2}");
+
+        foreach (var (addr, _) in hottest)
+        {
+            sb.AppendLine();
+            sb.AppendLine($"{GetRoutineName(addr)}:");
+            var instructionAddrs =
+                Enumerable.Range(0, 0x10000)
+                    .Where(o => m_hitCounts[o] > 0 && m_routineAddrs[o] == addr)
+                    .OrderByDescending(o => m_tStates[o])
+                    .Take(instructionsPerRoutine)
+                    .OrderBy(o => o);
+            foreach (var instructionAddr in instructionAddrs)
+            {
+                var hexBytes = string.Empty;
+                m_cpu.Disassemble((ushort)instructionAddr, ref hexBytes, out var mnemonics);
+                sb.AppendLine($"  {instructionAddr:X04}  {mnemonics,-16}{m_hitCounts[instructionAddr],12} hit(s){m_tStates[instructionAddr],14} T{100.0 * m_tStates[instructionAddr] / total,8:F2}%");
+            }
+        }
+
+        return sb.ToString();
+    }
+
+    private static string GetRoutineName(int addr) =>
+        addr == RootAddr ? "root" : $"{addr:X04}";
+
+    private sealed class RoutineStats
+    {
+        public long CallCount { get; set; }
+        public long SelfTStates { get; set; }
+        public long TotalTStates { get; set; }
+    }
+
+    /// <summary>
+    /// A routine, reached by a particular path through the call graph.
+    /// </summary>
+    private sealed class CallNode
+    {
+        private readonly Dictionary<int, CallNode> m_children = new Dictionary<int, CallNode>();
+
+        public int Addr { get; }
+        public CallNode Parent { get; }
+        public long CallCount { get; set; }
+        public long SelfTStates { get; set; }
+        public long TotalTStates => SelfTStates + m_children.Values.Sum(o => o.TotalTStates);
+
+        public CallNode(int addr, CallNode parent)
+        {
+            Addr = addr;
+            Parent = parent;
+        }
+
+        public CallNode GetChild(int addr)
+        {
+            if (!m_children.TryGetValue(addr, out var child))
+                m_children[addr] = child = new CallNode(addr, this);
+            return child;
+        }
+
+        public void Clear()
+        {
+            m_children.Clear();
+            CallCount = 0;
+            SelfTStates = 0;
+        }
+
+        public void WriteFoldedStacks(TextWriter writer, string stack)
+        {
+            if (SelfTStates > 0)
+                writer.WriteLine($"{stack} {SelfTStates}");
+            foreach (var child in m_children.Values.OrderBy(o => o.Addr))
+                child.WriteFoldedStacks(writer, $"{stack};{GetRoutineName(child.Addr)}");
+        }
+
+        /// <summary>
+        /// Accumulate the stats of this node and its children into 'routines', counting
+        /// recursive calls towards a routine's total T-states only once.
+        /// </summary>
+        public long AddRoutineStats(Dictionary<int, RoutineStats> routines, Dictionary<int, int> activeAddrs)
+        {
+            activeAddrs.TryGetValue(Addr, out var activeCount);
+            activeAddrs[Addr] = activeCount + 1;
+            var totalTStates = SelfTStates + m_children.Values.Sum(o => o.AddRoutineStats(routines, activeAddrs));
+            activeAddrs[Addr] = activeCount;
+
+            if (!routines.TryGetValue(Addr, out var stats))
+                routines[Addr] = stats = new RoutineStats();
+            stats.CallCount += CallCount;
+            stats.SelfTStates += SelfTStates;
+            if (activeCount == 0)
+                stats.TotalTStates += totalTStates;
+            return totalTStates;
+        }
+    }
+}
@@ -0,0 +1,61 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+namespace Speculator.Core;
+
+/// <summary>
+/// An instruction decoded at a specific address, along with its operands.
+/// </summary>
+/// <remarks>
+/// Cached per address by <see cref="InstructionCache"/>, so running it again needs no further memory reads.
+/// </remarks>
+public sealed class DecodedInstruction
+{
+    public unsafe DecodedInstruction(Instruction instruction, Memory memory, ushort addr)
+    {
+        Instruction = instruction;
+        ByteCount = instruction.ByteCount;
+        Handler = instruction.Handler;
+
+        if (instruction.DisplacementOffset != 0)
+            Displacement = memory.Peek((ushort)(addr + instruction.DisplacementOffset));
+
+        var immediateAddr = (ushort)(addr + instruction.ImmediateOffset);
+        Immediate = instruction.ImmediateByteCount switch
+        {
+            1 => memory.Peek(immediateAddr),
+            2 => memory.PeekWord(immediateAddr),
+            _ => 0
+        };
+    }
+
+    public Instruction Instruction { get; }
+
+    public byte ByteCount { get; }
+
+    /// <summary>
+    /// The 'd' in (IX+d) and (IY+d), or the relative jump offset.
+    /// </summary>
+    public byte Displacement { get; }
+
+    /// <summary>
+    /// The immediate 'n' or 'n n' value.
+    /// </summary>
+    public ushort Immediate { get; }
+
+    /// <summary>
+    /// The generated opcode table handler (Copied from the instruction, to save an indirection).
+    /// </summary>
+    internal unsafe delegate*<CPU, DecodedInstruction, int> Handler { get; }
+
+    public override string ToString() => Instruction.ToString();
+}
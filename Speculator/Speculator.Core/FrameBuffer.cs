@@ -29,6 +29,15 @@ public static class FrameBuffer
         framePtr[offset + 3] = 0xFF;
     }
 
+    /// <summary>
+    /// Clamp and pack to a 32-bit [A B G R] little-endian pixel, with alpha forced to 0xFF.
+    /// </summary>
+    public static uint Pack(Vector3 rgb)
+    {
+        var clamped = Vector3.Clamp(rgb, Vector3.Zero, V255);
+        return (uint)((byte)clamped.X | ((byte)clamped.Y << 8) | ((byte)clamped.Z << 16) | (0xFFu << 24));
+    }
+
     /// <summary>
     /// Set a vertical strip of 4 pixels the same RGB color.
     /// </summary>
@@ -0,0 +1,132 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using CSharp.Core.Extensions;
+using Speculator.Core.Tape;
+
+namespace Speculator.Core;
+
+/// <summary>
+/// A port handler with no keyboard hook, display or sound device.
+/// Key presses are scripted, one 'chord' per run of frames.
+/// </summary>
+public class HeadlessPortHandler : IPortHandler
+{
+    private readonly TapeLoader m_tapeLoader;
+    private readonly Memory m_memory;
+    private readonly Queue<(string[] Keys, int FrameCount)> m_keyScript = new Queue<(string[] Keys, int FrameCount)>();
+    private readonly byte[] m_pressedKeyBits = new byte[8];
+    private int m_keyFramesRemaining;
+
+    /// <summary>
+    /// Key names for each half-row of the keyboard matrix, ordered by address line (A8..A15) then bit (D0..D4).
+    /// </summary>
+    private static readonly string[][] KeyboardMatrix =
+    {
+        new[] { "CAPS", "Z", "X", "C", "V" },
+        new[] { "A", "S", "D", "F", "G" },
+        new[] { "Q", "W", "E", "R", "T" },
+        new[] { "1", "2", "3", "4", "5" },
+        new[] { "0", "9", "8", "7", "6" },
+        new[] { "P", "O", "I", "U", "Y" },
+        new[] { "ENTER", "L", "K", "J", "H" },
+        new[] { "SPACE", "SYMBOL", "M", "N", "B" }
+    };
+
+    /// <summary>
+    /// The last border color written to port 0xFE.
+    /// </summary>
+    public byte BorderAttr { get; private set; } = 0x07;
+
+    /// <summary>
+    /// Raised with each value written to port 0xFE (Border and speaker).
+    /// </summary>
+    public event EventHandler<byte> UlaWritten;
+
+    public HeadlessPortHandler(TapeLoader tapeLoader, Memory memory)
+    {
+        m_tapeLoader = tapeLoader;
+        m_memory = memory;
+    }
+
+    /// <summary>
+    /// Hold the specified keys (E.g. "SYMBOL", "P") for a number of frames.
+    /// An empty key list releases all keys.
+    /// </summary>
+    public void QueueKeys(int frameCount, params string[] keys) =>
+        m_keyScript.Enqueue((keys, frameCount));
+
+    /// <summary>
+    /// Called at the start of each emulated frame to advance the key press script.
+    /// </summary>
+    public void AdvanceFrame()
+    {
+        if (m_keyFramesRemaining > 0)
+        {
+            m_keyFramesRemaining--;
+            return;
+        }
+
+        Array.Clear(m_pressedKeyBits);
+        if (!m_keyScript.TryDequeue(out var step))
+            return;
+
+        foreach (var key in step.Keys)
+        {
+            var isKnown = false;
+            for (var row = 0; row < KeyboardMatrix.Length && !isKnown; row++)
+            {
+                var bit = Array.IndexOf(KeyboardMatrix[row], key.ToUpper());
+                if (bit < 0)
+                    continue;
+                m_pressedKeyBits[row] |= (byte)(1 << bit);
+                isKnown = true;
+            }
+
+            if (!isKnown)
+                throw new ArgumentException($"Unknown key: {key}");
+        }
+
+        m_keyFramesRemaining = step.FrameCount - 1;
+    }
+
+    public byte In(ushort portAddress)
+    {
+        var result = (byte)0xFF; // 'floating' bux value.
+        if ((portAddress & 0x00FF) != 0xFE)
+            return result;
+
+        // Any half-row with its address line held low contributes its pressed keys.
+        byte pressed = 0x00;
+        var hi = portAddress >> 8;
+        for (var row = 0; row < 8; row++)
+        {
+            if ((hi & (1 << row)) == 0)
+                pressed |= m_pressedKeyBits[row];
+        }
+
+        result = (byte)~pressed;
+
+        // Read from the tape, if loaded.
+        return m_tapeLoader.GetTapeSignal() == true ? result.SetBit(6) : result.ResetBit(6);
+    }
+
+    public void Out(ushort portAddress, byte b)
+    {
+        if ((portAddress & 0x8002) == 0)
+            m_memory.WritePagingPort(b);
+        if ((portAddress & 0x00FF) != 0xFE)
+            return;
+        BorderAttr = (byte)(b & 0x07);
+        UlaWritten?.Invoke(this, b);
+    }
+}
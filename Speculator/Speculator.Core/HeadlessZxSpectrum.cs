@@ -0,0 +1,93 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using System.Security.Cryptography;
+using Speculator.Core.Tape;
+
+namespace Speculator.Core;
+
+/// <summary>
+/// A ZX Spectrum with no display, sound or keyboard hook, driven one frame at a time by the caller.
+/// </summary>
+/// <remarks>
+/// Runs as fast as the host allows, so many instances can be run side-by-side
+/// (E.g. for regression testing snapshots, or benchmarking the core).
+/// </remarks>
+public class HeadlessZxSpectrum
+{
+    /// <summary>
+    /// Frames to wait for the ROM to initialize before typing LOAD "".
+    /// </summary>
+    private const int BootFrameCount = 100;
+
+    private readonly ZxFileIo m_zxFileIo;
+
+    public CPU TheCpu { get; }
+    public HeadlessPortHandler PortHandler { get; }
+    public TapeLoader TheTapeLoader { get; } = new TapeLoader();
+
+    public HeadlessZxSpectrum(FileInfo systemRom)
+    {
+        var memory = new Memory();
+        PortHandler = new HeadlessPortHandler(TheTapeLoader, memory);
+        TheCpu = new CPU(memory, PortHandler);
+        TheTapeLoader.SetCpu(TheCpu);
+        m_zxFileIo = new ZxFileIo(TheCpu, null, TheTapeLoader);
+
+        m_zxFileIo.LoadSystemRom(systemRom);
+        TheCpu.TheRegisters.Clear();
+    }
+
+    /// <summary>
+    /// Load a snapshot, binary, screen or tape.
+    /// Tapes are played through the ROM loader, with LOAD "" typed automatically after boot.
+    /// </summary>
+    public void LoadFile(FileInfo file)
+    {
+        m_zxFileIo.LoadFile(file);
+        if (!TheTapeLoader.IsLoading)
+            return;
+
+        PortHandler.QueueKeys(BootFrameCount);
+        foreach (var keys in new[] { new[] { "J" }, new[] { "SYMBOL", "P" }, new[] { "SYMBOL", "P" }, new[] { "ENTER" } })
+        {
+            PortHandler.QueueKeys(5, keys);
+            PortHandler.QueueKeys(5);
+        }
+    }
+
+    /// <summary>
+    /// Run the CPU for the specified number of 1/50th second frames.
+    /// </summary>
+    public void RunFrames(int frameCount)
+    {
+        for (var i = 0; i < frameCount; i++)
+        {
+            PortHandler.AdvanceFrame();
+
+            var frameEnd = TheCpu.TStatesSinceCpuStart + CPU.TStatesPerInterrupt;
+            while (TheCpu.TStatesSinceCpuStart < frameEnd)
+                TheCpu.StepToNextEvent(frameEnd);
+        }
+    }
+
+    /// <summary>
+    /// A hash of the display file, attributes and border color.
+    /// </summary>
+    public string GetScreenHash()
+    {
+        var screen = new byte[0x1B00 + 1];
+        TheCpu.MainMemory.ScreenBank[..0x1B00].CopyTo(screen);
+        screen[^1] = PortHandler.BorderAttr;
+        return Convert.ToHexString(SHA1.HashData(screen));
+    }
+}
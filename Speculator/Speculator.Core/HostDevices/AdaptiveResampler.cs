@@ -0,0 +1,90 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+namespace Speculator.Core.HostDevices;
+
+/// <summary>
+/// Linearly resamples audio by a ratio which is nudged to hold the queued audio at a target latency.
+/// </summary>
+/// <remarks>
+/// The emulated and host sound clocks never quite agree, so a fixed ratio would slowly drain or
+/// flood the queue. Limiting the adjustment to ±0.5% keeps the pitch change inaudible.
+/// </remarks>
+internal sealed class AdaptiveResampler
+{
+    private const double MaxRatioDelta = 0.005;
+    private const double FillSmoothing = 0.05;
+    private readonly int m_targetFill;
+    private readonly int m_fillTolerance;
+    private double m_smoothedFill = -1.0;
+    private double m_position = 1.0;
+    private short m_previous;
+    private short m_next;
+
+    /// <summary>
+    /// Input samples consumed per output sample.
+    /// </summary>
+    public double Ratio { get; private set; } = 1.0;
+
+    /// <summary>
+    /// The most recent output sample.
+    /// </summary>
+    public short LastSample { get; private set; }
+
+    /// <param name="targetFill">The number of queued samples to aim for.</param>
+    /// <param name="fillTolerance">The fill error at which the full ratio adjustment is applied.</param>
+    public AdaptiveResampler(int targetFill, int fillTolerance)
+    {
+        m_targetFill = targetFill;
+        m_fillTolerance = fillTolerance;
+    }
+
+    /// <summary>
+    /// Adjust the ratio from the number of samples queued between the producer and the speaker.
+    /// </summary>
+    public void UpdateFill(int queuedSamples)
+    {
+        m_smoothedFill = m_smoothedFill < 0.0 ? queuedSamples : m_smoothedFill + FillSmoothing * (queuedSamples - m_smoothedFill);
+        var error = (m_smoothedFill - m_targetFill) / m_fillTolerance;
+        Ratio = 1.0 + MaxRatioDelta * Math.Clamp(error, -1.0, 1.0);
+    }
+
+    /// <summary>
+    /// The number of input samples needed to produce the given number of output samples.
+    /// </summary>
+    public int GetInputCount(int outputCount) =>
+        (int)(m_position + (outputCount - 1) * Ratio);
+
+    /// <summary>
+    /// Resample the input into the output, stopping early if the input runs out.
+    /// </summary>
+    /// <returns>The number of output samples written.</returns>
+    public int Resample(ReadOnlySpan<short> input, Span<short> output)
+    {
+        var inputIndex = 0;
+        for (var i = 0; i < output.Length; i++)
+        {
+            while (m_position >= 1.0)
+            {
+                if (inputIndex == input.Length)
+                    return i;
+                m_previous = m_next;
+                m_next = input[inputIndex++];
+                m_position -= 1.0;
+            }
+
+            output[i] = LastSample = (short)(m_previous + (m_next - m_previous) * m_position);
+            m_position += Ratio;
+        }
+
+        return output.Length;
+    }
+}
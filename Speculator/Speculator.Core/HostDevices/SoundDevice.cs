@@ -9,8 +9,10 @@
 //
 // THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
 
+using System.Numerics;
 using CSharp.Core;
 using OpenTK.Audio.OpenAL;
+using Speculator.Core.Utils;
 
 namespace Speculator.Core.HostDevices;
 
@@ -23,22 +25,39 @@ public class SoundDevice
     private readonly int[] m_buffers;
     private readonly int m_sampleRate;
     private bool m_isSoundEnabled = true;
-    private byte m_lastWrittenSample;
+    private volatile bool m_isClearRequested;
 
     /// <summary>
     /// Data received from the CPU, copied into m_transferBuffer for transfer to the sound card.
     /// </summary>
-    private readonly List<byte> m_cpuBuffer = new List<byte>(4096);
+    private readonly SpscRingBuffer<short> m_cpuBuffer;
+
+    /// <summary>
+    /// Scratch space for CPU data being resampled into m_transferBuffer.
+    /// </summary>
+    private readonly short[] m_resampleBuffer;
+
+    /// <summary>
+    /// Matches the CPU data rate to the sound card's, holding latency at a fixed target.
+    /// </summary>
+    private readonly AdaptiveResampler m_resampler;
+
+    /// <summary>
+    /// The number of CPU samples to keep buffered, and the backlog at which they're dropped to that level
+    /// (As rate control alone would take too long to recover).
+    /// </summary>
+    private readonly int m_targetCpuSamples;
+    private readonly int m_maxCpuSamples;
 
     /// <summary>
     /// The number of device buffers we can queue.
     /// </summary>
-    private const int BufferCount = 3;
+    private const int BufferCount = 4;
     
     /// <summary>
     /// Fixed buffer for interop with the sound card. Used to fill the device buffers.
     /// </summary>
-    private readonly byte[] m_transferBuffer;
+    private readonly short[] m_transferBuffer;
     
     public SoundDevice(int sampleHz)
     {
@@ -53,11 +72,35 @@ public class SoundDevice
         m_buffers = AL.GenBuffers(BufferCount);
         m_source = AL.GenSource();
 
-        // Enough data for 0.1 seconds of play, split between all buffers.
-        var bufferSize = (int)(m_sampleRate * 0.1 / BufferCount);
-        m_transferBuffer = new byte[bufferSize];
+        // Half a frame's worth of data per buffer.
+        var bufferSize = m_sampleRate / 100;
+        m_transferBuffer = new short[bufferSize];
+
+        // Room for about a second of CPU data.
+        m_cpuBuffer = new SpscRingBuffer<short>((int)BitOperations.RoundUpToPowerOf2((uint)m_sampleRate));
+        m_resampleBuffer = new short[2 * bufferSize];
+
+        // Aim to keep the device buffers full, plus the frame of samples the CPU delivers at a time.
+        m_targetCpuSamples = m_sampleRate / 50;
+        m_maxCpuSamples = 5 * m_targetCpuSamples;
+        m_resampler = new AdaptiveResampler(BufferCount * bufferSize + m_targetCpuSamples, m_targetCpuSamples);
     }
 
+    /// <summary>
+    /// The number of CPU samples dropped because the sound card wasn't keeping up.
+    /// </summary>
+    public long OverrunCount => m_cpuBuffer.OverrunCount;
+
+    /// <summary>
+    /// The number of samples padded because the CPU wasn't keeping up.
+    /// </summary>
+    public long UnderrunCount => m_cpuBuffer.UnderrunCount;
+
+    /// <summary>
+    /// The current resampling ratio (CPU samples per device sample).
+    /// </summary>
+    public double RateRatio => m_resampler.Ratio;
+
     public void SoundLoop(Func<bool> isCancelled)
     {
         // Wait for 'real' sound data to appear.
@@ -94,6 +137,8 @@ public class SoundDevice
                 UpdateBufferData(bufferId);
             }
 
+            UpdateRate();
+
             // Restart playback if it has stopped and there are device buffers queued.
             AL.GetSource(m_source, ALGetSourcei.SourceState, out var state);
             CheckSoundError();
@@ -126,33 +171,38 @@ public class SoundDevice
             Logger.Instance.Error($"Sound device error: {err}");
     }
 
+    /// <summary>
+    /// Feed the number of samples yet to be played (Queued in the device and in the CPU buffer) to the rate control.
+    /// </summary>
+    private void UpdateRate()
+    {
+        AL.GetSource(m_source, ALGetSourcei.BuffersQueued, out var buffersQueued);
+        AL.GetSource(m_source, ALGetSourcei.SampleOffset, out var sampleOffset);
+        CheckSoundError();
+        var deviceSamples = Math.Max(0, buffersQueued * m_transferBuffer.Length - sampleOffset);
+        m_resampler.UpdateFill(deviceSamples + m_cpuBuffer.Count);
+    }
+
     private void UpdateBufferData(int bufferId)
     {
-        var dstIndex = 0;
-        lock (m_cpuBuffer)
-        {
-            // Compensate if sound data is generated faster than we can consume it.
-            var excessBytes = m_cpuBuffer.Count - BufferCount * m_transferBuffer.Length;
-            excessBytes = Math.Max(0, excessBytes);
-            var speedUp = 1.0 + 0.4 * excessBytes / m_transferBuffer.Length;
-
-            // Move the CPU sound buffer data to the device's buffer.
-            var srcIndex = 0.0;
-            while (srcIndex < m_cpuBuffer.Count && dstIndex < m_transferBuffer.Length)
-            {
-                m_transferBuffer[dstIndex++] = m_cpuBuffer[(int)srcIndex];
-                srcIndex += speedUp;
-            }
-            
-            m_cpuBuffer.RemoveRange(0, (int)srcIndex);
-        }
+        if (m_isClearRequested)
+            ClearCpuBuffer();
 
-        // Pad transfer buffer if necessary.
-        for (var i = dstIndex; i < m_transferBuffer.Length; i++)
-            m_transferBuffer[i] = m_lastWrittenSample;
+        // Drop any large backlog (E.g. After a stall, or when emulating faster than real time).
+        var cpuSamples = m_cpuBuffer.Count;
+        if (cpuSamples > m_maxCpuSamples)
+            m_cpuBuffer.Skip(cpuSamples - m_targetCpuSamples);
+
+        // Resample the CPU sound buffer data into the device's buffer.
+        var input = m_resampleBuffer.AsSpan(0, m_resampler.GetInputCount(m_transferBuffer.Length));
+        input = input[..m_cpuBuffer.Read(input)];
+        var dstIndex = m_resampler.Resample(input, m_transferBuffer);
+
+        // Hold the last sample if the CPU hasn't kept up, to avoid a pop.
+        m_transferBuffer.AsSpan(dstIndex).Fill(m_resampler.LastSample);
 
         // Load the device buffer with data.
-        AL.BufferData(bufferId, ALFormat.Mono8, m_transferBuffer, m_sampleRate);
+        AL.BufferData(bufferId, ALFormat.Mono16, m_transferBuffer, m_sampleRate);
         CheckSoundError();
 
         // Queue the device buffer for playback.
@@ -160,11 +210,21 @@ public class SoundDevice
         CheckSoundError();
     }
     
-    public void AddSample(double sampleValue)
+    /// <summary>
+    /// Called from the CPU thread with a batch of samples.
+    /// </summary>
+    public void AddSamples(ReadOnlySpan<short> samples)
     {
-        m_lastWrittenSample = (byte)(m_isSoundEnabled ? sampleValue * byte.MaxValue : 0);
-        lock (m_cpuBuffer)
-            m_cpuBuffer.Add(m_lastWrittenSample);
+        if (samples.IsEmpty)
+            return;
+        if (m_isSoundEnabled)
+        {
+            m_cpuBuffer.Write(samples);
+            return;
+        }
+
+        Span<short> silence = stackalloc short[samples.Length];
+        m_cpuBuffer.Write(silence);
     }
 
     public void SetEnabled(bool isSoundEnabled)
@@ -172,13 +232,14 @@ public class SoundDevice
         if (m_isSoundEnabled == isSoundEnabled)
             return;
         m_isSoundEnabled = isSoundEnabled;
-        ClearCpuBuffer();
+
+        // Only the sound thread may read from the CPU buffer, so let it do the clearing.
+        m_isClearRequested = true;
     }
     
     private void ClearCpuBuffer()
     {
-        lock (m_cpuBuffer)
-            m_cpuBuffer.Clear();
-        m_lastWrittenSample = 0;
+        m_isClearRequested = false;
+        m_cpuBuffer.Clear();
     }
 }
@@ -14,5 +14,5 @@ namespace Speculator.Core;
 public interface IPortHandler
 {
     byte In(ushort portAddress);
-    void Out(byte port, byte b);
+    void Out(ushort portAddress, byte b);
 }
@@ -26,6 +26,11 @@ public class Instruction
         HexTemplate = hexTemplate;
         ByteCount = (byte)HexTemplate.Split(' ').Length;
         TStateCount = tStateCount;
+
+        var hex = HexTemplate.Split(new[] { ' ' }, StringSplitOptions.RemoveEmptyEntries);
+        DisplacementOffset = Math.Max(0, Array.IndexOf(hex, "d"));
+        ImmediateOffset = Math.Max(0, Array.IndexOf(hex, "n"));
+        ImmediateByteCount = hex.Count(o => o == "n");
     }
 
     public string MnemonicTemplate { get; }
@@ -38,33 +43,26 @@ public class Instruction
 
     public byte ByteCount { get; }
 
-    private int m_valueByteOffset = -1;
-    public int ValueByteOffset
-    {
-        get
-        {
-            if (m_valueByteOffset == -1)
-            {
-                m_valueByteOffset = 0;
-                var hex = HexTemplate.Split(new[] { ' ' }, StringSplitOptions.RemoveEmptyEntries);
-                for (var i = 0; i < hex.Length; i++)
-                {
-                    if (hex[i] == "n" || hex[i] == "d")
-                    {
-                        m_valueByteOffset = i;
-                        break;
-                    }
-                }
-            }
+    /// <summary>
+    /// Offset of the displacement byte (or zero if there is none).
+    /// </summary>
+    public int DisplacementOffset { get; }
+
+    /// <summary>
+    /// Offset of the immediate value (or zero if there is none).
+    /// </summary>
+    public int ImmediateOffset { get; }
 
-            return m_valueByteOffset;
-        }
-    }
-    
     /// <summary>
-    /// Callback function allowing the Instruction to handle its own action.
+    /// The size of the immediate value (Zero, one or two bytes).
     /// </summary>
-    public Func<Memory, Registers, Alu, ushort, int> Run { get; internal init; }
+    public int ImmediateByteCount { get; }
+
+    /// <summary>
+    /// The generated opcode table handler, called with the CPU and the decoded instruction.
+    /// </summary>
+    /// <remarks>Set when the opcode pages are built, and returns the T-states used.</remarks>
+    internal unsafe delegate*<CPU, DecodedInstruction, int> Handler { get; set; }
 
     // Optimized matching cache.
     private byte[] m_fixedPrefix;
@@ -75,11 +73,14 @@ public class Instruction
     {
         EnsureOpcodePattern();
 
-        // Fast path: compare against the raw memory span to avoid method-call overhead.
-        var span = mainMemory.Data.AsSpan(addr);
-        if (span.Length < m_totalOpcodeLength)
+        if (addr + m_totalOpcodeLength > 0x10000)
             return false;
 
+        // Gather the opcode bytes (which may span two memory pages) to compare in one go.
+        Span<byte> span = stackalloc byte[m_totalOpcodeLength];
+        for (var i = 0; i < span.Length; i++)
+            span[i] = mainMemory.Peek((ushort)(addr + i));
+
         // Compare contiguous fixed prefix using vectorized SequenceEqual.
         if (m_fixedPrefix.Length != 0 && !span[..m_fixedPrefix.Length].SequenceEqual(m_fixedPrefix))
             return false;
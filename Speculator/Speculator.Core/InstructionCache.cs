@@ -0,0 +1,137 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using System.Runtime.CompilerServices;
+
+namespace Speculator.Core;
+
+/// <summary>
+/// Caches the decoded instruction at each memory address, so hot code skips the opcode lookup entirely.
+/// </summary>
+/// <remarks>
+/// Each entry also holds the instruction's operands, so handlers needn't read them from memory again.
+/// Memory writes to any byte belonging to a cached instruction (including its operands)
+/// evict it, so self-modifying code is handled transparently.
+/// </remarks>
+public class InstructionCache
+{
+    /// <summary>
+    /// The longest Z80 instruction (E.g. DD CB d op).
+    /// </summary>
+    private const int MaxInstructionLength = 4;
+
+    private readonly Z80Instructions m_instructionSet;
+    private readonly Memory m_memory;
+    private readonly DecodedInstruction[] m_instructions = new DecodedInstruction[0x10000];
+    private readonly bool[] m_isCodeByte = new bool[0x10000];
+
+    public long Hits { get; private set; }
+    public long Misses { get; private set; }
+
+    /// <summary>
+    /// Fraction (0.0 - 1.0) of instruction fetches served from the cache.
+    /// </summary>
+    public double HitRate
+    {
+        get
+        {
+            var total = Hits + Misses;
+            return total > 0 ? (double)Hits / total : 0.0;
+        }
+    }
+
+    public InstructionCache(Z80Instructions instructionSet, Memory memory)
+    {
+        m_instructionSet = instructionSet;
+        m_memory = memory;
+        m_memory.InstructionCache = this;
+        m_memory.DataLoaded += (_, _) => Clear();
+    }
+
+    /// <summary>
+    /// Find the instruction at the given address, decoding (and caching) it if required.
+    /// </summary>
+    /// <returns>Null if the opcode bytes are not recognized.</returns>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public DecodedInstruction Find(ushort addr)
+    {
+        var instruction = m_instructions[addr];
+        if (instruction != null)
+        {
+            Hits++;
+            return instruction;
+        }
+
+        return Decode(addr);
+    }
+
+    private DecodedInstruction Decode(ushort addr)
+    {
+        Misses++;
+        var instruction = m_instructionSet.FindInstructionAtMemoryLocation(m_memory, addr);
+        if (instruction == null)
+            return null;
+
+        var decoded = new DecodedInstruction(instruction, m_memory, addr);
+        m_instructions[addr] = decoded;
+        for (var i = 0; i < instruction.ByteCount; i++)
+            m_isCodeByte[(ushort)(addr + i)] = true;
+        m_memory.OnCodeCached(addr, instruction.ByteCount);
+        return decoded;
+    }
+
+    /// <summary>
+    /// Called when a byte of memory changes, evicting any cached instruction which spans it.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void OnMemoryWritten(ushort addr)
+    {
+        if (m_isCodeByte[addr])
+            Evict(addr);
+    }
+
+    /// <summary>
+    /// Called when a range of memory changes.
+    /// </summary>
+    public void OnMemoryWritten(ushort addr, int count)
+    {
+        for (var i = 0; i < count; i++)
+            OnMemoryWritten((ushort)(addr + i));
+    }
+
+    /// <summary>
+    /// Called when a different memory page is mapped into a range of addresses, forgetting everything cached there.
+    /// </summary>
+    public void OnMemoryPaged(ushort addr, int count)
+    {
+        // Include any instruction starting just before the range which spills into it.
+        var start = Math.Max(0, addr - (MaxInstructionLength - 1));
+        Array.Clear(m_instructions, start, addr + count - start);
+        Array.Clear(m_isCodeByte, addr, count);
+    }
+
+    private void Evict(ushort addr)
+    {
+        // Any instruction starting up to three bytes earlier might include this byte.
+        for (var i = 0; i < MaxInstructionLength; i++)
+            m_instructions[(ushort)(addr - i)] = null;
+        m_isCodeByte[addr] = false;
+    }
+
+    public void Clear()
+    {
+        Array.Clear(m_instructions);
+        Array.Clear(m_isCodeByte);
+    }
+
+    public void ResetStats() => Hits = Misses = 0;
+}
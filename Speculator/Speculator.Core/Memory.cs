@@ -17,23 +17,146 @@ using CSharp.Core.Extensions;
 
 namespace Speculator.Core;
 
+/// <summary>
+/// The Z80's 64K address space, made up of four 16K slots into which ROM and RAM pages are mapped.
+/// </summary>
+/// <remarks>
+/// A 48K machine uses a fixed mapping. Loading a 32K (128K) ROM enables paging through port 0x7FFD,
+/// which only changes which page each slot refers to - No memory is copied.
+/// </remarks>
 public class Memory
 {
+    /// <summary>
+    /// The size of each ROM or RAM page (and each slot of the address space).
+    /// </summary>
+    public const int PageSize = 0x4000;
+
+    /// <summary>
+    /// The 48K ROM (and 128K editor ROM) is page 0, followed by RAM banks 5, 2 and 0,
+    /// so the first 64K of <see cref="Data"/> is the power-on mapping.
+    /// </summary>
+    private static readonly int[] RamBankPages = { 3, 4, 2, 5, 6, 1, 7, 8 };
+
+    /// <summary>
+    /// The 48K BASIC ROM, on a 128K machine.
+    /// </summary>
+    private const int Rom1Page = 9;
+
+    private const int PageCount = 10;
+
+    /// <summary>
+    /// The display file (bitmap then attributes), at the start of the screen bank.
+    /// </summary>
+    private const int DisplayFileSize = 0x1B00;
+    private const int AttributeOffset = 0x1800;
+    private const int DisplayLineCount = 192;
+
+    /// <summary>
+    /// The page mapped into each slot, four bits per slot.
+    /// </summary>
+    private const int DefaultSlotPages = 0x3210;
+
     private int m_romSize;
+    private int m_slotPages = DefaultSlotPages;
+
+    /// <summary>
+    /// A bit per slot whose writes need more than storing the byte (ROM, display file, cached code or an aliased bank).
+    /// </summary>
+    private int m_watchedSlots;
+
+    /// <summary>
+    /// A bit per slot holding decoded (or compiled) code.
+    /// </summary>
+    private int m_codeSlots;
+
+    /// <summary>
+    /// The slot sharing its RAM bank with slot 3 (0xC000), or 0 if none.
+    /// </summary>
+    private ushort m_aliasedSlotAddr;
+
+    /// <summary>
+    /// The index into <see cref="Data"/> of the screen bank.
+    /// </summary>
+    private int m_screenOffset = RamBankPages[5] * PageSize;
+
+    /// <summary>
+    /// For each display line, a bit per character column written since the line was last drawn.
+    /// </summary>
+    private readonly uint[] m_dirtyDisplayColumns = Enumerable.Repeat(uint.MaxValue, DisplayLineCount).ToArray();
 
     /// <summary>
     /// Raised when a large chunk of data is loaded from an external source (I.e. Disk).
     /// </summary>
     public event EventHandler DataLoaded;
 
-    public byte[] Data { get; } = new byte[0x10000];
+    /// <summary>
+    /// Every ROM and RAM page, of which the first 64K is also the address space of a 48K machine.
+    /// </summary>
+    public byte[] Data { get; } = GC.AllocateArray<byte>(PageCount * PageSize, pinned: true);
+
+    /// <summary>
+    /// True if a 128K ROM is loaded, enabling memory paging.
+    /// </summary>
+    public bool Is128K { get; private set; }
+
+    /// <summary>
+    /// The last value written to port 0x7FFD (RAM bank at 0xC000, screen bank, ROM and paging lock bits).
+    /// </summary>
+    public byte PagingState { get; private set; }
+
+    /// <summary>
+    /// The RAM bank being displayed (Bank 5, or bank 7 on a 128K machine).
+    /// </summary>
+    public ReadOnlySpan<byte> ScreenBank => Data.AsSpan(m_screenOffset, PageSize);
+
+    public Memory() => UpdateWatchedSlots();
+
+    /// <summary>
+    /// Optional cache of decoded instructions, notified when memory is written.
+    /// </summary>
+    internal InstructionCache InstructionCache { get; set; }
+
+    /// <summary>
+    /// Optional compiled code blocks, notified when memory is written.
+    /// </summary>
+    internal BlockJit BlockJit { get; set; }
+
+    /// <summary>
+    /// Optional log of display file writes, for drawing mid-line changes.
+    /// </summary>
+    internal UlaEventLog UlaEvents { get; set; }
+
+    /// <summary>
+    /// The index into <see cref="Data"/> of the byte currently mapped at the given address.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private int GetOffset(ushort addr) =>
+        (m_slotPages >> ((addr >> 12) & 0x0C) & 0x0F) << 14 | addr & (PageSize - 1);
 
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
     public byte Poke(ushort addr, byte value)
+    {
+        if ((m_watchedSlots >> (addr >> 14) & 1) != 0)
+            return PokeWatched(addr, value);
+        Data[GetOffset(addr)] = value;
+        return value;
+    }
+
+    /// <summary>
+    /// Write to a slot which needs more than the byte storing.
+    /// </summary>
+    private byte PokeWatched(ushort addr, byte value)
     {
         if (IsRomArea(addr))
-            return Data[addr]; // Can't write to ROM.
-        Data[addr] = value;
+            return Peek(addr); // Can't write to ROM.
+        var offset = GetOffset(addr);
+        if ((uint)(offset - m_screenOffset) < DisplayFileSize)
+            OnDisplayWritten(offset - m_screenOffset);
+        Data[offset] = value;
+        InstructionCache?.OnMemoryWritten(addr);
+        BlockJit?.OnMemoryWritten(addr);
+        if (m_aliasedSlotAddr != 0)
+            OnAliasWritten(addr);
         return value;
     }
 
@@ -44,10 +167,71 @@ public class Memory
     }
 
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
-    public byte Peek(ushort addr) => Data[addr];
+    public byte Peek(ushort addr) => Data[GetOffset(addr)];
     
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
     public ushort PeekWord(ushort addr) =>
-        (ushort)(Data[(ushort)(addr + 1)] << 8 | Data[addr]);
+        (ushort)(Data[GetOffset((ushort)(addr + 1))] << 8 | Data[GetOffset(addr)]);
+
+    /// <summary>
+    /// Return (and clear) the character columns of a display line (0 - 191) which have been written to.
+    /// </summary>
+    /// <remarks>
+    /// Bit n is set for column n. Writing an attribute marks its column on all eight lines of the cell.
+    /// </remarks>
+    public uint TakeDirtyDisplayColumns(int line)
+    {
+        var columns = m_dirtyDisplayColumns[line];
+        m_dirtyDisplayColumns[line] = 0;
+        return columns;
+    }
+
+    /// <summary>
+    /// Mark a character cell (0 - 767) as needing to be redrawn.
+    /// </summary>
+    public void MarkDisplayCellDirty(int cell)
+    {
+        var firstLine = cell >> 5 << 3;
+        var column = 1u << (cell & 0x1F);
+        for (var i = 0; i < 8; i++)
+            m_dirtyDisplayColumns[firstLine + i] |= column;
+    }
+
+    /// <summary>
+    /// Mark the entire display as needing to be redrawn.
+    /// </summary>
+    public void MarkDisplayDirty() => Array.Fill(m_dirtyDisplayColumns, uint.MaxValue);
+
+    /// <summary>
+    /// Called before a display file byte is written.
+    /// </summary>
+    /// <param name="offset">The offset into the display file.</param>
+    /// <param name="tStatesOffset">When the write happens, relative to the CPU clock.</param>
+    private void OnDisplayWritten(int offset, long tStatesOffset = 0)
+    {
+        UlaEvents?.AddDisplayWrite(offset, Data[m_screenOffset + offset], tStatesOffset);
+        if (offset >= AttributeOffset)
+        {
+            MarkDisplayCellDirty(offset - AttributeOffset);
+            return;
+        }
+
+        // Bitmap offsets are split into line bits 7-6, 2-0, 5-3, then the column.
+        var line = (offset >> 11 & 0x03) << 6 | (offset >> 8 & 0x07) | (offset >> 5 & 0x07) << 3;
+        m_dirtyDisplayColumns[line] |= 1u << (offset & 0x1F);
+    }
+
+    /// <summary>
+    /// The memory from the given address up to (at most) the end of its slot.
+    /// </summary>
+    internal ReadOnlySpan<byte> GetSlotSpan(ushort addr, int count)
+    {
+        Debug.Assert((addr & (PageSize - 1)) + count <= PageSize, "Span crosses a slot boundary.");
+        return Data.AsSpan(GetOffset(addr), count);
+    }
+
+    public ReadOnlySpan<byte> GetBank(int bank) =>
+        Data.AsSpan(RamBankPages[bank] * PageSize, PageSize);
 
     public string ReadAsHexString(ushort addr, ushort byteCount, bool wantSpaces = false)
     {
@@ -76,18 +260,241 @@ public class Memory
         }
 
         Array.Clear(Data);
+        ResetPaging();
+
+        // A 128K machine has two ROMs (The 128K editor and 48K BASIC), each paged into slot 0.
+        Is128K = romBytes.Length == 2 * PageSize;
+        if (Is128K)
+        {
+            m_romSize = PageSize;
+            UpdateWatchedSlots();
+            romBytes.AsSpan(PageSize).CopyTo(Data.AsSpan(Rom1Page * PageSize));
+            LoadData(romBytes[..PageSize], 0x0000);
+            return;
+        }
+
         m_romSize = romBytes.Length;
+        UpdateWatchedSlots();
         LoadData(romBytes, 0x0000);
     }
     
     public bool IsRomArea(ushort addr) => addr < m_romSize;
+
+    /// <summary>
+    /// Handle a write to the 128K paging port (0x7FFD), if paging is enabled and not locked.
+    /// </summary>
+    public void WritePagingPort(byte value)
+    {
+        if (Is128K && (PagingState & 0x20) == 0)
+            SetPagingState(value);
+    }
+
+    /// <summary>
+    /// Return to the power-on mapping (Also unlocking the paging port).
+    /// </summary>
+    public void ResetPaging() => SetPagingState(0x00);
+
+    /// <summary>
+    /// Apply a 0x7FFD paging value, regardless of the paging lock (E.g. When restoring a snapshot).
+    /// </summary>
+    public void SetPagingState(byte value)
+    {
+        PagingState = value;
+
+        var bank = value & 0x07;
+        var slotPages = RamBankPages[bank] << 12 | RamBankPages[2] << 8 | RamBankPages[5] << 4 | ((value & 0x10) != 0 ? Rom1Page : 0);
+        m_aliasedSlotAddr = bank switch
+        {
+            5 => 0x4000,
+            2 => 0x8000,
+            _ => 0
+        };
+
+        var screenOffset = RamBankPages[(value & 0x08) != 0 ? 7 : 5] * PageSize;
+        if (screenOffset != m_screenOffset)
+        {
+            m_screenOffset = screenOffset;
+            MarkDisplayDirty();
+        }
+
+        var changedSlots = slotPages ^ m_slotPages;
+        m_slotPages = slotPages;
+        for (var slot = 0; slot < 4; slot++)
+        {
+            if ((changedSlots >> (slot * 4) & 0x0F) == 0)
+                continue;
+            var slotAddr = (ushort)(slot * PageSize);
+            InstructionCache?.OnMemoryPaged(slotAddr, PageSize);
+            BlockJit?.OnMemoryPaged(slotAddr, PageSize);
+            m_codeSlots &= ~(1 << slot);
+        }
+
+        UpdateWatchedSlots();
+    }
+
+    /// <summary>
+    /// Called when code at the given address is decoded, so writes to it must evict the cached copy.
+    /// </summary>
+    internal void OnCodeCached(ushort addr, int count)
+    {
+        var slots = 1 << (addr >> 14) | 1 << ((ushort)(addr + count - 1) >> 14);
+        if ((m_codeSlots & slots) == slots)
+            return;
+        m_codeSlots |= slots;
+        UpdateWatchedSlots();
+    }
+
+    /// <summary>
+    /// Find the slots whose writes must take the slow path in <see cref="Poke(ushort, byte)"/>.
+    /// </summary>
+    private void UpdateWatchedSlots()
+    {
+        var watchedSlots = m_codeSlots;
+        for (var slot = 0; slot < 4; slot++)
+        {
+            var slotAddr = slot * PageSize;
+            var slotOffset = GetOffset((ushort)slotAddr);
+            var isWatched = slotAddr < m_romSize ||
+                            slotOffset == m_screenOffset ||
+                            m_aliasedSlotAddr != 0 && (slotAddr == m_aliasedSlotAddr || slotAddr == 0xC000);
+            if (isWatched)
+                watchedSlots |= 1 << slot;
+        }
+
+        m_watchedSlots = watchedSlots;
+    }
+
+    /// <summary>
+    /// The same RAM bank is visible in two slots, so code cached at the other address is stale too.
+    /// </summary>
+    private void OnAliasWritten(ushort addr)
+    {
+        var slotAddr = addr & 0xC000;
+        if (slotAddr == m_aliasedSlotAddr)
+            addr = (ushort)(addr - slotAddr + 0xC000);
+        else if (slotAddr == 0xC000)
+            addr = (ushort)(addr - slotAddr + m_aliasedSlotAddr);
+        else
+            return;
+        InstructionCache?.OnMemoryWritten(addr);
+        BlockJit?.OnMemoryWritten(addr);
+    }
+
+    /// <summary>
+    /// Copy bytes one at a time (as LDIR/LDDR would), moving up or down through memory from the given addresses.
+    /// </summary>
+    /// <remarks>
+    /// Neither range may wrap past the end of memory. Writes to ROM are ignored, and overlapping
+    /// ranges repeat bytes exactly as a sequence of Poke() calls would.
+    /// </remarks>
+    /// <param name="tStatesPerByte">The time between each byte's write, for logging display writes.</param>
+    public void CopyBlock(ushort from, ushort to, int count, bool isIncrementing, int tStatesPerByte = 0)
+    {
+        // Work from the lowest address of each range.
+        var src = isIncrementing ? from : from - count + 1;
+        var dst = isIncrementing ? to : to - count + 1;
+
+        // Skip writes which would land in ROM (Which, when decrementing, are the last to be written).
+        var romByteCount = Math.Clamp(m_romSize - dst, 0, count);
+        src += romByteCount;
+        dst += romByteCount;
+        count -= romByteCount;
+        var firstByteTStates = isIncrementing ? (long)romByteCount * tStatesPerByte : 0;
+        if (count <= 0)
+            return;
+
+        // Copy in runs which stay within a slot, in the order the instruction would copy them.
+        for (var copied = 0; copied < count;)
+        {
+            int runSrc, runDst, runLength;
+            if (isIncrementing)
+            {
+                runSrc = src + copied;
+                runDst = dst + copied;
+                runLength = Math.Min(count - copied, PageSize - Math.Max(runSrc & (PageSize - 1), runDst & (PageSize - 1)));
+            }
+            else
+            {
+                var srcEnd = src + count - 1 - copied;
+                var dstEnd = dst + count - 1 - copied;
+                runLength = Math.Min(count - copied, Math.Min(srcEnd & (PageSize - 1), dstEnd & (PageSize - 1)) + 1);
+                runSrc = srcEnd - runLength + 1;
+                runDst = dstEnd - runLength + 1;
+            }
+
+            // Mark any display bytes about to be overwritten, in the order they are written.
+            var dstOffset = GetOffset((ushort)runDst);
+            var displayStart = Math.Max(dstOffset, m_screenOffset);
+            var displayEnd = Math.Min(dstOffset + runLength, m_screenOffset + DisplayFileSize);
+            for (var i = 0; i < displayEnd - displayStart; i++)
+            {
+                var offset = isIncrementing ? displayStart + i : displayEnd - 1 - i;
+                var byteIndex = copied + (isIncrementing ? offset - dstOffset : dstOffset + runLength - 1 - offset);
+                OnDisplayWritten(offset - m_screenOffset, firstByteTStates + (long)byteIndex * tStatesPerByte);
+            }
+
+            CopyRun(GetOffset((ushort)runSrc), dstOffset, runLength, isIncrementing);
+            copied += runLength;
+        }
+
+        InstructionCache?.OnMemoryWritten((ushort)dst, count);
+        BlockJit?.OnMemoryWritten((ushort)dst, count);
+        if (m_aliasedSlotAddr != 0)
+        {
+            for (var i = 0; i < count; i++)
+                OnAliasWritten((ushort)(dst + i));
+        }
+    }
+
+    /// <summary>
+    /// Copy between offsets into <see cref="Data"/>.
+    /// </summary>
+    private void CopyRun(int src, int dst, int count, bool isIncrementing)
+    {
+        if (isIncrementing && dst > src && dst < src + count)
+        {
+            // Destination trails the source, so earlier writes are re-read.
+            for (var i = 0; i < count; i++)
+                Data[dst + i] = Data[src + i];
+        }
+        else if (!isIncrementing && dst < src && dst + count > src)
+        {
+            for (var i = count - 1; i >= 0; i--)
+                Data[dst + i] = Data[src + i];
+        }
+        else
+        {
+            Data.AsSpan(src, count).CopyTo(Data.AsSpan(dst, count));
+        }
+    }
     
     /// <summary>
     /// Bulk load data into memory (such as from disk).
     /// </summary>
     public void LoadData(IList<byte> data, ushort addr)
     {
-        data.CopyTo(Data, addr);
+        for (var i = 0; i < data.Count; i++)
+            Data[GetOffset((ushort)(addr + i))] = data[i];
+        OnDataLoaded();
+    }
+
+    /// <summary>
+    /// Bulk load data into a RAM bank, whether or not it is paged in.
+    /// </summary>
+    public void LoadBank(int bank, IList<byte> data)
+    {
+        Debug.Assert(data.Count <= PageSize, "Data is larger than a RAM bank.");
+        data.CopyTo(Data, RamBankPages[bank] * PageSize);
+        OnDataLoaded();
+    }
+
+    private void OnDataLoaded()
+    {
+        MarkDisplayDirty();
         DataLoaded?.Invoke(this, EventArgs.Empty);
+
+        // Any cached code has been forgotten.
+        m_codeSlots = 0;
+        UpdateWatchedSlots();
     }
 }
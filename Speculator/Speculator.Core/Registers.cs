@@ -35,8 +35,27 @@ public class Registers
             A = B = C = D = E = F = H = L = 0xFF;
         }
 
+        private byte m_f;
+        private Alu.DeferredOp m_deferredOp;
+        private byte m_deferredA;
+        private byte m_deferredB;
+        private int m_deferredResult;
+        private bool m_deferredCarry;
+
         public byte A { get; set; }
-        public byte F { get; set; }
+
+        /// <summary>
+        /// The flags register, materialised from any deferred ALU operation on first read.
+        /// </summary>
+        public byte F
+        {
+            get => m_deferredOp == Alu.DeferredOp.None ? m_f : MaterialiseFlags();
+            set
+            {
+                m_f = value;
+                m_deferredOp = Alu.DeferredOp.None;
+            }
+        }
         public byte B { get; set; }
         public byte C { get; set; }
         public byte D { get; set; }
@@ -84,6 +103,46 @@ public class Registers
             }
         }
         
+        /// <summary>
+        /// Record the operands of an ALU operation, leaving F to be computed only when read.
+        /// </summary>
+        internal void DeferFlags(Alu.DeferredOp op, byte a, byte b, int result, bool carry)
+        {
+            m_deferredOp = op;
+            m_deferredA = a;
+            m_deferredB = b;
+            m_deferredResult = result;
+            m_deferredCarry = carry;
+        }
+
+        private byte MaterialiseFlags()
+        {
+            m_f = Alu.ComputeDeferredFlags(m_deferredOp, m_deferredA, m_deferredB, m_deferredResult, m_deferredCarry);
+            m_deferredOp = Alu.DeferredOp.None;
+            return m_f;
+        }
+
+        /// <summary>
+        /// The carry flag, without materialising the rest of F.
+        /// </summary>
+        internal bool IsCarrySet =>
+            m_deferredOp switch
+            {
+                Alu.DeferredOp.None => (m_f & 0x01) != 0,
+                Alu.DeferredOp.Add or Alu.DeferredOp.Subtract or Alu.DeferredOp.Compare => (m_deferredResult & 0x100) != 0,
+                Alu.DeferredOp.Inc or Alu.DeferredOp.Dec => m_deferredCarry,
+                _ => false
+            };
+
+        /// <summary>
+        /// The zero flag, without materialising the rest of F.
+        /// </summary>
+        /// <remarks>
+        /// The deferred result is unmasked (SBC A,FFh with A=0 and carry set gives -256), so only its low byte is tested.
+        /// </remarks>
+        internal bool IsZeroSet =>
+            m_deferredOp == Alu.DeferredOp.None ? (m_f & 0x40) != 0 : (byte)m_deferredResult == 0;
+
         /// <summary>
         /// Assigns a byte to the specified register.
         /// </summary>
@@ -211,7 +270,7 @@ public class Registers
     public bool ZeroFlag
     {
         set => Main.F = value ? Main.F.SetBit(6) : Main.F.ResetBit(6);
-        get => Main.F.IsBitSet(6);
+        get => Main.IsZeroSet;
     }
 
     /// <summary>
@@ -265,7 +324,7 @@ public class Registers
     public bool CarryFlag
     {
         set => Main.F = value ? Main.F.SetBit(0) : Main.F.ResetBit(0);
-        get => Main.F.IsBitSet(0);
+        get => Main.IsCarrySet;
     }
     
     public void SetFlags53From(ushort w) => SetFlags53From((byte)((w & 0xff00) >> 8));
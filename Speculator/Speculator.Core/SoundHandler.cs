@@ -19,14 +19,16 @@ namespace Speculator.Core;
 /// Emulated sound support, recording virtual speaker movements.
 /// Uses a SoundDevice to send sound to the host device.
 /// </summary>
+/// <remarks>
+/// Speaker changes are recorded as T-state stamped edges as the CPU writes them, and synthesised
+/// into samples once per frame, so there is no sound work per instruction.
+/// </remarks>
 public class SoundHandler : ViewModelBase, IDisposable
 {
-    private byte m_soundLevel;
-    private const int SampleHz = 11025;
-    private const double TicksPerSample = CPU.TStatesPerSecond / SampleHz;
-    private double m_ticksUntilSample = TicksPerSample;
-    private readonly int[] m_soundLevels = new int[4];
+    private const int SampleHz = 44100;
     private readonly SoundDevice m_soundDevice;
+    private readonly BeeperSynth m_beeper = new BeeperSynth(SampleHz);
+    private Func<long> m_clock;
     private bool m_isDisposed;
     private readonly Thread m_thread;
 
@@ -47,6 +49,12 @@ public class SoundHandler : ViewModelBase, IDisposable
         }
     }
 
+    /// <summary>
+    /// Provide the clock used to time speaker changes.
+    /// </summary>
+    public void SetCpu(CPU cpu) =>
+        m_clock = () => cpu.TStatesSinceCpuStart;
+
     public void SetEnabled(bool value) =>
         m_soundDevice?.SetEnabled(value);
 
@@ -57,46 +65,42 @@ public class SoundHandler : ViewModelBase, IDisposable
     }
 
     /// <summary>
-    /// Called whenever the CPU's speaker state changes.
+    /// Called whenever the CPU writes the speaker state.
     /// </summary>
-    public void SetSpeakerState(byte soundLevel) =>
-        m_soundLevel = soundLevel;
-
-    public void Dispose()
+    public void SetSpeakerState(byte soundLevel)
     {
-        m_soundDevice?.Mute();
-        
-        // Wait for the sound thread to exit.
-        m_isDisposed = true;
-        m_thread?.Join();
+        if (m_soundDevice != null && m_clock != null)
+            m_beeper.AddEdge(m_clock() + CPU.PortWriteTStates, soundLevel);
     }
 
     /// <summary>
-    /// Called every CPU tick to build a collection of speaker samples.
-    /// Passed to the sound device's buffer when enough are collected.
+    /// Called by the CPU at the end of each frame, to pass the frame's samples to the sound device.
     /// </summary>
-    public void SampleSpeakerState(long tStateCount)
+    public void EndFrame()
     {
-        // Update the count of on/off speaker states.
-        m_soundLevels[m_soundLevel]++;
+        if (m_soundDevice != null && m_clock != null)
+            m_soundDevice.AddSamples(m_beeper.EndFrame(m_clock()));
+    }
 
-        m_ticksUntilSample -= tStateCount;
-        if (m_ticksUntilSample > 0)
-            return; // Not enough time elapsed - Keep collecting speaker states.
+    /// <summary>
+    /// The number of samples dropped because the host sound card wasn't keeping up.
+    /// </summary>
+    public long OverrunCount => m_soundDevice?.OverrunCount ?? 0;
 
-        // We've collected enough samples for averaging to occur.
-        m_ticksUntilSample += TicksPerSample;
-        var sampleValue = 0.0;
-        var sampleCount = 0.0;
-        for (var i = 0; i < m_soundLevels.Length; i++)
-        {
-            sampleValue += i * m_soundLevels[i];
-            sampleCount += m_soundLevels[i];
-            m_soundLevels[i] = 0;
-        }
+    /// <summary>
+    /// The number of samples padded because the emulation wasn't keeping up.
+    /// </summary>
+    public long UnderrunCount => m_soundDevice?.UnderrunCount ?? 0;
+
+    public void Dispose()
+    {
+        m_soundDevice?.Mute();
         
-        // Append to the sample buffer.
-        var value = sampleCount > 0.0 ? sampleValue * 0.25 / sampleCount : 0.0;
-        m_soundDevice?.AddSample(value);
+        // Wait for the sound thread to exit.
+        m_isDisposed = true;
+        m_thread?.Join();
+
+        if (m_soundDevice != null)
+            Logger.Instance.Info($"Sound overruns: {OverrunCount}, underruns: {UnderrunCount}.");
     }
 }
@@ -17,105 +17,108 @@ namespace Speculator.Core.Tape;
 /// <summary>
 /// Represents the sound/tone data in a single tape block.
 /// </summary>
+/// <remarks>
+/// The signal level is computed from the position in the block (Pilot, sync, then each bit's two
+/// half-pulses) rather than stored per pulse. Loading reads the tape forwards, so a cursor over the
+/// data bits only ever steps forward, restarting only if asked for an earlier time.
+/// Timing matches the original pulse list lookup: Each level is reported from the T-state after its
+/// pulse boundary, and the block ends as its trailing pause would begin.
+/// </remarks>
 public class TapeBlock
 {
+    private const int TStatesPerPilotPulse = 2168;
+    private const int TStatesPerSync1Pulse = 667;
+    private const int TStatesPerSync2Pulse = 735;
     private const int TStatesPerBitZero = 855;
     private const int TStatesPerBitOne = 1710;
 
     private readonly byte[] m_blockBytes;
-    private SoundBuffer m_soundBuffer;
+    private readonly long m_pilotTStates;
+    private bool m_isStarted;
     private long m_tStatesAtBlockStart;
-    private readonly SoundBuffer.Comparer m_bufferComparer = new SoundBuffer.Comparer();
+
+    /// <summary>
+    /// The data bit at the cursor, and its start time (In T-states from the start of the data).
+    /// </summary>
+    private int m_bitIndex;
+    private long m_bitStartTStates;
 
     public TapeBlock(byte[] tapeBytes, int blockStartIndex, int blockSize)
     {
         m_blockBytes = new byte[blockSize];
         Array.Copy(tapeBytes, blockStartIndex, m_blockBytes, 0, blockSize);
+
+        // Headers have a longer leading tone, each an even number of pulses.
+        var pilotPulses = m_blockBytes.Length == 19 ? 8064 : 3224;
+        m_pilotTStates = (long)pilotPulses * TStatesPerPilotPulse;
     }
-    
-    public TapeBlock PopulateTones(long tStatesFromCpuStart)
+
+    /// <summary>
+    /// The block's flag, data and checksum bytes.
+    /// </summary>
+    public ReadOnlySpan<byte> Bytes => m_blockBytes;
+
+    /// <summary>
+    /// Start playing the block from the specified time, unless already playing.
+    /// </summary>
+    public TapeBlock Start(long tStatesFromCpuStart)
     {
-        if (m_soundBuffer != null)
-            return this; // Already populated.
+        if (m_isStarted)
+            return this; // Already playing.
 
+        m_isStarted = true;
         m_tStatesAtBlockStart = tStatesFromCpuStart;
+        m_bitIndex = 0;
+        m_bitStartTStates = 0;
         Logger.Instance.Info($"Loading tape block: {this}");
-        m_soundBuffer = new SoundBuffer();
-        
-        // Is this header or data?
-        var isHeader = m_blockBytes.Length == 19;
-        
-        // Create leading tones.
-        var signalState = true;
-        int pulses;
-        if (isHeader)
-        {
-            // Header block.
-            pulses = 8063;
-        }
-        else
-        {
-            // Data block.
-            pulses = 3223;
-        }
-
-        for (var i = 0; i < pulses; i++)
-        {
-            m_soundBuffer.Add(signalState, 2168);
-            signalState = !signalState;
-        }
-
-        if (!signalState)
-            m_soundBuffer.Add(false, 2168);
-        m_soundBuffer.Add(true, 667);
-        m_soundBuffer.Add(false, 735);
-
-        // Create tape tones.
-        m_soundBuffer.ReserveExtra(m_blockBytes.Length * 8);
-        foreach (var blockByte in m_blockBytes)
-        {
-            for (var mask = 0x80; mask > 0; mask >>= 1)
-            {
-                var isBitSet = (blockByte & mask) != 0;
-                var pulseLength = isBitSet ? TStatesPerBitOne : TStatesPerBitZero;
-                
-                m_soundBuffer.Add(true, pulseLength);
-                m_soundBuffer.Add(false, pulseLength);
-            }
-        }
-        
-        // Pause.
-        m_soundBuffer.Add(true, 954);
-
         return this;
     }
 
     /// <summary>
     /// Find the low/high signal value at the specified T-state time.
     /// </summary>
+    /// <remarks>
+    /// Each pulse toggles the level, starting low.
+    /// </remarks>
+    /// <returns>Null if the block has ended.</returns>
     public bool? GetSignal(long tStatesFromCpuStart)
     {
-        var tStatesFromBlockStart = tStatesFromCpuStart - m_tStatesAtBlockStart;
+        // Levels change on the T-state after each pulse boundary.
+        var t = tStatesFromCpuStart - m_tStatesAtBlockStart - 1;
+        if (t < 0)
+            return true;
+
+        // Leading tone.
+        if (t < m_pilotTStates)
+            return t / TStatesPerPilotPulse % 2 == 1;
 
-        var searchItem = (false, 0L, tStatesFromBlockStart);
-        var index = m_soundBuffer.Levels.BinarySearch(searchItem, m_bufferComparer);
+        // Sync pulses.
+        t -= m_pilotTStates;
+        if (t < TStatesPerSync1Pulse + TStatesPerSync2Pulse)
+            return t >= TStatesPerSync1Pulse;
 
-        if (index < 0)
+        // Data bits, each a low then high pulse.
+        t -= TStatesPerSync1Pulse + TStatesPerSync2Pulse;
+        if (t < m_bitStartTStates)
         {
-            index = ~index; // Get the index of the first element greater than tStatesFromBlockStart.
-            if (index < m_soundBuffer.Levels.Count)
-            {
-                return m_soundBuffer.Levels[index].level;
-            }
+            m_bitIndex = 0;
+            m_bitStartTStates = 0;
         }
-        else
+
+        while (m_bitIndex < m_blockBytes.Length * 8)
         {
-            // Exact match found, return the level of the current index.
-            return m_soundBuffer.Levels[index].level;
+            var isBitSet = (m_blockBytes[m_bitIndex >> 3] & (0x80 >> (m_bitIndex & 7))) != 0;
+            var pulseLength = isBitSet ? TStatesPerBitOne : TStatesPerBitZero;
+            var tStatesIntoBit = t - m_bitStartTStates;
+            if (tStatesIntoBit < 2 * pulseLength)
+                return tStatesIntoBit >= pulseLength;
+
+            m_bitIndex++;
+            m_bitStartTStates += 2 * pulseLength;
         }
 
         // No more tones in this block.
-        m_soundBuffer = null;
+        m_isStarted = false;
         return null;
     }
 
@@ -9,12 +9,25 @@
 //
 // THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
 
+using CSharp.Core;
 using CSharp.Core.Extensions;
 
 namespace Speculator.Core.Tape;
 
+/// <summary>
+/// Plays a .tap file's blocks through the EAR port in real time, or copies them straight into memory
+/// when <see cref="IsFlashLoadEnabled"/> and the ROM's LD-BYTES routine asks for one.
+/// </summary>
+/// <remarks>
+/// Loaders which don't use the ROM routine never trigger the trap, so still get the tape signal.
+/// </remarks>
 public class TapeLoader
 {
+    /// <summary>
+    /// SA/LD-RET - Where LD-BYTES returns via, restoring the border and re-enabling interrupts.
+    /// </summary>
+    private const ushort LdBytesReturnAddress = 0x053F;
+
     private int m_currentTapeBlockIndex;
     private List<TapeBlock> m_tapeBlocks;
     private FileInfo m_tapeFile;
@@ -22,10 +35,16 @@ public class TapeLoader
 
     public bool IsLoading => m_tapeFile?.Exists == true;
 
+    /// <summary>
+    /// Load blocks requested by the ROM instantly, rather than playing them.
+    /// </summary>
+    public bool IsFlashLoadEnabled { get; set; }
+
     public void SetCpu(CPU cpu)
     {
         m_theCpu = cpu;
         m_theCpu.PoweredOff += (_, _) => Stop();
+        m_theCpu.LdBytesRequested += (_, _) => FlashLoadBlock();
     }
 
     public void Load(FileInfo tapeFile)
@@ -36,54 +55,137 @@ public class TapeLoader
     
     public bool? GetTapeSignal()
     {
-        if (m_tapeFile?.Exists != true)
-        {
-            // No tape.
-            Stop();
+        if (!EnsureTapeBlocks())
             return null;
-        }
-
-        // Load tape data.
-        if (m_tapeBlocks == null)
-        {
-            var tapeBytes = m_tapeFile.ReadAllBytes();
-            m_tapeBlocks = new List<TapeBlock>();
-            var i = 0;
-            while (i < tapeBytes.Length)
-            {
-                var blockSize = tapeBytes[i++] + (tapeBytes[i++] << 8);
-                m_tapeBlocks.Add(new TapeBlock(tapeBytes, i, blockSize));
-
-                i += blockSize;
-            }
-
-            m_currentTapeBlockIndex = 0;
-        }
 
-        // Get current tape block and sure its 'tones' are populated.
+        // Get the current tape block, making sure it's playing.
         bool? signal = null;
         while (!signal.HasValue && m_tapeFile != null)
         {
             signal = m_tapeBlocks[m_currentTapeBlockIndex]
-                .PopulateTones(m_theCpu.TStatesSinceCpuStart)
+                .Start(m_theCpu.TStatesSinceCpuStart)
                 .GetSignal(m_theCpu.TStatesSinceCpuStart);
             
             if (signal != null)
                 continue; // We have a signal.
             
             // End of block reached - Move to the next.
-            m_currentTapeBlockIndex++;
-            if (m_currentTapeBlockIndex < m_tapeBlocks.Count)
+            if (MoveToNextBlock())
                 continue;
             
             // No more tape!
-            Stop();
             return false;
         }
 
         return signal;
     }
 
+    /// <summary>
+    /// Do the work of the ROM's LD-BYTES routine using the current tape block, then return from it.
+    /// </summary>
+    /// <remarks>
+    /// On entry A holds the expected flag byte, carry is set to LOAD (Otherwise VERIFY),
+    /// IX is the destination and DE the length.
+    /// On exit carry is set if the block was read without error.
+    /// </remarks>
+    private void FlashLoadBlock()
+    {
+        if (!IsFlashLoadEnabled || !EnsureTapeBlocks())
+            return; // Let the ROM read the tape signal.
+
+        var block = m_tapeBlocks[m_currentTapeBlockIndex];
+        Logger.Instance.Info($"Flash loading tape block: {block}");
+
+        var registers = m_theCpu.TheRegisters;
+        if (registers.PC == CPU.LdBreakTrapAddress)
+        {
+            // The tape was inserted after LD-BYTES started waiting for a leader tone,
+            // so undo its set-up (Swapping in the entry AF, and pushing SA/LD-RET).
+            (registers.Main.AF, registers.Alt.AF) = (registers.Alt.AF, registers.Main.AF);
+            registers.SP += 2;
+        }
+
+        var memory = m_theCpu.MainMemory;
+        var bytes = block.Bytes;
+        var isLoad = registers.CarryFlag;
+        var isOk = bytes.Length > 0 && bytes[0] == registers.Main.A;
+        var parity = bytes.Length > 0 ? bytes[0] : (byte)0;
+        var i = 1;
+        if (isOk)
+        {
+            // Data bytes.
+            for (; i < bytes.Length && registers.Main.DE > 0; i++)
+            {
+                if (isLoad)
+                    memory.Poke(registers.IX, bytes[i]);
+                else if (memory.Peek(registers.IX) != bytes[i])
+                    break; // Verify failed.
+
+                parity ^= bytes[i];
+                registers.IX++;
+                registers.Main.DE--;
+            }
+
+            // Checksum.
+            isOk = registers.Main.DE == 0 && i < bytes.Length;
+            if (isOk)
+            {
+                parity ^= bytes[i];
+                registers.Main.L = bytes[i];
+            }
+        }
+
+        registers.Main.H = parity;
+        registers.Main.A = parity;
+        registers.CarryFlag = isOk && parity == 0;
+
+        // The rest of the block passes by unread.
+        MoveToNextBlock();
+        registers.PC = LdBytesReturnAddress;
+    }
+
+    /// <summary>
+    /// Read the tape file's blocks, if not already done.
+    /// </summary>
+    /// <returns>False if there is no tape to read.</returns>
+    private bool EnsureTapeBlocks()
+    {
+        if (m_tapeFile?.Exists != true)
+        {
+            // No tape.
+            Stop();
+            return false;
+        }
+
+        if (m_tapeBlocks != null)
+            return true;
+
+        var tapeBytes = m_tapeFile.ReadAllBytes();
+        m_tapeBlocks = new List<TapeBlock>();
+        var i = 0;
+        while (i < tapeBytes.Length)
+        {
+            var blockSize = tapeBytes[i++] + (tapeBytes[i++] << 8);
+            m_tapeBlocks.Add(new TapeBlock(tapeBytes, i, blockSize));
+
+            i += blockSize;
+        }
+
+        m_currentTapeBlockIndex = 0;
+        return true;
+    }
+
+    /// <returns>False if the tape has ended.</returns>
+    private bool MoveToNextBlock()
+    {
+        m_currentTapeBlockIndex++;
+        if (m_currentTapeBlockIndex < m_tapeBlocks.Count)
+            return true;
+
+        Stop();
+        return false;
+    }
+
     private void Stop()
     {
         m_tapeBlocks = null;
@@ -0,0 +1,116 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+namespace Speculator.Core;
+
+/// <summary>
+/// Border and display file writes, each stamped with the T-state it happened at.
+/// </summary>
+/// <remarks>
+/// Lets the display draw mid-line changes (Loader stripes, multicolour attributes) at the pixel the
+/// beam had reached, without a render callback per instruction. Events are discarded once the
+/// display has drawn past them, so the preallocated ring only ever holds a line or two of them.
+/// Written and read on the CPU thread. If the ring fills, the oldest events are dropped.
+/// </remarks>
+public sealed class UlaEventLog
+{
+    /// <summary>
+    /// The offset of border writes, which are otherwise display file offsets (0x0000 - 0x1AFF).
+    /// </summary>
+    public const ushort BorderOffset = 0xFFFF;
+
+    private const int Capacity = 4096;
+    private readonly Func<long> m_clock;
+    private readonly long[] m_tStates = new long[Capacity];
+    private readonly ushort[] m_offsets = new ushort[Capacity];
+    private readonly byte[] m_values = new byte[Capacity];
+    private int m_first;
+
+    public int Count { get; private set; }
+
+    /// <summary>
+    /// The border color in effect before the oldest event.
+    /// </summary>
+    public byte Border { get; private set; }
+
+    /// <summary>
+    /// An event, oldest first. The value is the new border color, or the display byte's previous value.
+    /// </summary>
+    public (long TStates, ushort Offset, byte Value) this[int index]
+    {
+        get
+        {
+            var i = (m_first + index) & (Capacity - 1);
+            return (m_tStates[i], m_offsets[i], m_values[i]);
+        }
+    }
+
+    /// <param name="clock">Returns the T-state count of the running CPU.</param>
+    /// <param name="border">The current border color.</param>
+    public UlaEventLog(Func<long> clock, byte border)
+    {
+        m_clock = clock;
+        Border = border;
+    }
+
+    public void AddBorderWrite(byte border) =>
+        Add(m_clock() + CPU.PortWriteTStates, BorderOffset, border);
+
+    /// <param name="offset">The offset into the display file.</param>
+    /// <param name="oldValue">The value being overwritten.</param>
+    /// <param name="tStatesOffset">When the write happens, relative to the CPU clock (E.g. Each repeat of a bulk LDIR).</param>
+    public void AddDisplayWrite(int offset, byte oldValue, long tStatesOffset = 0) =>
+        Add(m_clock() + tStatesOffset, (ushort)offset, oldValue);
+
+    private void Add(long tStates, ushort offset, byte value)
+    {
+        if (Count == Capacity)
+            RemoveFirst();
+        var i = (m_first + Count) & (Capacity - 1);
+        m_tStates[i] = tStates;
+        m_offsets[i] = offset;
+        m_values[i] = value;
+        Count++;
+    }
+
+    private void RemoveFirst()
+    {
+        if (m_offsets[m_first] == BorderOffset)
+            Border = m_values[m_first];
+        m_first = (m_first + 1) & (Capacity - 1);
+        Count--;
+    }
+
+    /// <summary>
+    /// Drop the events before the given time, applying any border changes.
+    /// </summary>
+    public void DiscardBefore(long tStates)
+    {
+        // Events stamped after the present were made before the CPU clock was reset.
+        if (Count > 0 && this[Count - 1].TStates > m_clock() + CPU.PortWriteTStates)
+            tStates = long.MaxValue;
+
+        while (Count > 0 && m_tStates[m_first] < tStates)
+            RemoveFirst();
+    }
+
+    /// <summary>
+    /// The T-state count at which the most recent occurrence of a scanline (0 - 311) started.
+    /// </summary>
+    public long GetScanlineStartTStates(int scanline)
+    {
+        var now = m_clock();
+        var sinceStart = (now - scanline * CPU.TStatesPerScanline) % CPU.TStatesPerInterrupt;
+        if (sinceStart < 0)
+            sinceStart += CPU.TStatesPerInterrupt;
+        return now - sinceStart;
+    }
+}
@@ -0,0 +1,107 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using System.Threading.Channels;
+
+namespace Speculator.Core.Utils;
+
+/// <summary>
+/// Streams data to a file from a background task, through a fixed pool of preallocated chunks.
+/// </summary>
+/// <remarks>
+/// Writing only copies into the current chunk, so the caller never waits for the disk unless
+/// every chunk is already queued for writing.
+/// </remarks>
+public sealed class AsyncFileWriter : IDisposable
+{
+    private readonly FileStream m_stream;
+    private readonly Channel<byte[]> m_freeChunks = Channel.CreateUnbounded<byte[]>();
+    private readonly Channel<(byte[] Chunk, int Length)> m_filledChunks = Channel.CreateUnbounded<(byte[] Chunk, int Length)>(new UnboundedChannelOptions { SingleReader = true, SingleWriter = true });
+    private readonly Task m_writeTask;
+    private byte[] m_chunk;
+    private int m_chunkLength;
+
+    /// <summary>
+    /// The number of bytes written so far.
+    /// </summary>
+    public long Length { get; private set; }
+
+    public AsyncFileWriter(FileInfo file, int chunkSize, int chunkCount = 4)
+    {
+        m_stream = new FileStream(file.FullName, FileMode.Create, FileAccess.Write, FileShare.Read, 4096, FileOptions.Asynchronous);
+        for (var i = 0; i < chunkCount; i++)
+            m_freeChunks.Writer.TryWrite(new byte[chunkSize]);
+        m_chunk = TakeFreeChunk();
+        m_writeTask = Task.Run(WriteChunksAsync);
+    }
+
+    public void Write(ReadOnlySpan<byte> data)
+    {
+        Length += data.Length;
+        while (!data.IsEmpty)
+        {
+            var count = Math.Min(data.Length, m_chunk.Length - m_chunkLength);
+            data[..count].CopyTo(m_chunk.AsSpan(m_chunkLength));
+            m_chunkLength += count;
+            data = data[count..];
+
+            if (m_chunkLength == m_chunk.Length)
+                QueueChunk();
+        }
+    }
+
+    private void QueueChunk()
+    {
+        m_filledChunks.Writer.TryWrite((m_chunk, m_chunkLength));
+        m_chunk = TakeFreeChunk();
+        m_chunkLength = 0;
+    }
+
+    private byte[] TakeFreeChunk()
+    {
+        if (m_freeChunks.Reader.TryRead(out var chunk))
+            return chunk;
+
+        // All chunks are queued - Wait for one to be written, unless writing has failed.
+        var read = m_freeChunks.Reader.ReadAsync().AsTask();
+        Task.WaitAny(read, m_writeTask);
+        if (!read.IsCompleted)
+            m_writeTask.GetAwaiter().GetResult();
+        return read.Result;
+    }
+
+    private async Task WriteChunksAsync()
+    {
+        await foreach (var (chunk, length) in m_filledChunks.Reader.ReadAllAsync())
+        {
+            await m_stream.WriteAsync(chunk.AsMemory(0, length));
+            m_freeChunks.Writer.TryWrite(chunk);
+        }
+    }
+
+    /// <summary>
+    /// Write any remaining data, and wait for the file to be closed.
+    /// </summary>
+    public void Dispose()
+    {
+        if (m_chunkLength > 0)
+            m_filledChunks.Writer.TryWrite((m_chunk, m_chunkLength));
+        m_filledChunks.Writer.TryComplete();
+        try
+        {
+            m_writeTask.GetAwaiter().GetResult();
+        }
+        finally
+        {
+            m_stream.Dispose();
+        }
+    }
+}
@@ -0,0 +1,116 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+namespace Speculator.Core.Utils;
+
+/// <summary>
+/// Fixed-capacity lock-free FIFO between one producer thread and one consumer thread.
+/// </summary>
+/// <remarks>
+/// Each index is only ever advanced by its owning thread, so neither side waits for the other.
+/// Writes that don't fit are dropped (An overrun), and reads that can't be satisfied in full
+/// return what there is (An underrun).
+/// </remarks>
+public sealed class SpscRingBuffer<T>
+{
+    private readonly T[] m_items;
+    private readonly int m_mask;
+    private long m_writeIndex;
+    private long m_readIndex;
+    private long m_overrunCount;
+    private long m_underrunCount;
+
+    /// <summary>
+    /// The maximum number of items the buffer can hold.
+    /// </summary>
+    public int Capacity => m_items.Length;
+
+    /// <summary>
+    /// The number of items written but not yet read.
+    /// </summary>
+    public int Count => (int)(Volatile.Read(ref m_writeIndex) - Volatile.Read(ref m_readIndex));
+
+    /// <summary>
+    /// The number of items dropped because the buffer was full.
+    /// </summary>
+    public long OverrunCount => Interlocked.Read(ref m_overrunCount);
+
+    /// <summary>
+    /// The number of items requested by the consumer that weren't available.
+    /// </summary>
+    public long UnderrunCount => Interlocked.Read(ref m_underrunCount);
+
+    public SpscRingBuffer(int capacity)
+    {
+        if (capacity <= 0 || (capacity & (capacity - 1)) != 0)
+            throw new ArgumentException("Capacity must be a power of two.", nameof(capacity));
+        m_items = new T[capacity];
+        m_mask = capacity - 1;
+    }
+
+    /// <summary>
+    /// Called by the producer to append as many items as will fit.
+    /// </summary>
+    /// <returns>The number of items written.</returns>
+    public int Write(ReadOnlySpan<T> items)
+    {
+        var writeIndex = m_writeIndex;
+        var free = m_items.Length - (int)(writeIndex - Volatile.Read(ref m_readIndex));
+        var count = Math.Min(items.Length, free);
+        if (count < items.Length)
+            Interlocked.Add(ref m_overrunCount, items.Length - count);
+
+        var start = (int)(writeIndex & m_mask);
+        var firstPart = Math.Min(count, m_items.Length - start);
+        items[..firstPart].CopyTo(m_items.AsSpan(start));
+        items[firstPart..count].CopyTo(m_items);
+
+        Volatile.Write(ref m_writeIndex, writeIndex + count);
+        return count;
+    }
+
+    /// <summary>
+    /// Called by the consumer to remove up to <paramref name="items"/>.Length items.
+    /// </summary>
+    /// <returns>The number of items read.</returns>
+    public int Read(Span<T> items)
+    {
+        var readIndex = m_readIndex;
+        var available = (int)(Volatile.Read(ref m_writeIndex) - readIndex);
+        var count = Math.Min(items.Length, available);
+        if (count < items.Length)
+            Interlocked.Add(ref m_underrunCount, items.Length - count);
+
+        var start = (int)(readIndex & m_mask);
+        var firstPart = Math.Min(count, m_items.Length - start);
+        m_items.AsSpan(start, firstPart).CopyTo(items);
+        m_items.AsSpan(0, count - firstPart).CopyTo(items[firstPart..]);
+
+        Volatile.Write(ref m_readIndex, readIndex + count);
+        return count;
+    }
+
+    /// <summary>
+    /// Called by the consumer to discard up to the given number of the oldest items.
+    /// </summary>
+    public void Skip(int count)
+    {
+        var readIndex = m_readIndex;
+        var available = (int)(Volatile.Read(ref m_writeIndex) - readIndex);
+        Volatile.Write(ref m_readIndex, readIndex + Math.Min(count, available));
+    }
+
+    /// <summary>
+    /// Called by the consumer to discard everything written so far.
+    /// </summary>
+    public void Clear() =>
+        Volatile.Write(ref m_readIndex, Volatile.Read(ref m_writeIndex));
+}
@@ -0,0 +1,77 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+namespace Speculator.Core.Utils;
+
+/// <summary>
+/// Lock-free hand-over of the latest item from one producer thread to one consumer thread.
+/// </summary>
+/// <remarks>
+/// The producer fills <see cref="Back"/> and publishes it, the consumer takes the most recently
+/// published buffer as <see cref="Front"/>. Neither side ever waits for the other, so a published
+/// buffer the consumer hasn't taken yet is replaced (And counted as dropped).
+/// </remarks>
+public sealed class TripleBuffer<T>
+{
+    /// <summary>
+    /// Set on the shared index when it holds a published buffer the consumer hasn't taken.
+    /// </summary>
+    private const int FreshFlag = 0x04;
+
+    private readonly T[] m_buffers;
+    private int m_backIndex;
+    private int m_sharedIndex = 1;
+    private int m_frontIndex = 2;
+    private long m_droppedCount;
+
+    /// <summary>
+    /// The buffer owned by the producer.
+    /// </summary>
+    public T Back => m_buffers[m_backIndex];
+
+    /// <summary>
+    /// The buffer owned by the consumer.
+    /// </summary>
+    public T Front => m_buffers[m_frontIndex];
+
+    /// <summary>
+    /// The number of published buffers replaced before the consumer took them.
+    /// </summary>
+    public long DroppedCount => Interlocked.Read(ref m_droppedCount);
+
+    public TripleBuffer(Func<T> createBuffer)
+    {
+        m_buffers = new[] { createBuffer(), createBuffer(), createBuffer() };
+    }
+
+    /// <summary>
+    /// Called by the producer to hand over <see cref="Back"/>, which then becomes a different buffer.
+    /// </summary>
+    public void Publish()
+    {
+        var previous = Interlocked.Exchange(ref m_sharedIndex, m_backIndex | FreshFlag);
+        m_backIndex = previous & ~FreshFlag;
+        if ((previous & FreshFlag) != 0)
+            Interlocked.Increment(ref m_droppedCount);
+    }
+
+    /// <summary>
+    /// Called by the consumer to move the latest published buffer into <see cref="Front"/>.
+    /// </summary>
+    /// <returns>False if nothing new was published.</returns>
+    public bool TryTakeLatest()
+    {
+        if ((Volatile.Read(ref m_sharedIndex) & FreshFlag) == 0)
+            return false;
+        m_frontIndex = Interlocked.Exchange(ref m_sharedIndex, m_frontIndex) & ~FreshFlag;
+        return true;
+    }
+}
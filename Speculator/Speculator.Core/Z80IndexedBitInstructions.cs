@@ -0,0 +1,45 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+namespace Speculator.Core;
+
+public partial class Z80Instructions
+{
+    /// <summary>
+    /// Create the undocumented DD CB/FD CB variants of each listed (IX+d)/(IY+d) bit instruction.
+    /// </summary>
+    /// <remarks>
+    /// Each also copies its result to a register (Except BIT), but otherwise matches the listed form.
+    /// The generated opcode tables provide their handlers.
+    /// </remarks>
+    private IEnumerable<Instruction> GetIndexedBitInstructions(string prefix)
+    {
+        var regs = new[]
+        {
+            "B", "C", "D", "E", "H", "L", null, "A"
+        };
+
+        var listed = m_instructions.Where(o => o.HexTemplate.StartsWith($"{prefix} CB")).ToArray();
+        foreach (var instruction in listed)
+        {
+            var opcode = Convert.ToByte(instruction.HexTemplate[^2..], 16);
+            for (var i = 0; i < regs.Length; i++)
+            {
+                if (regs[i] == null)
+                    continue; // Listed.
+
+                var regSuffix = instruction.MnemonicTemplate.StartsWith("BIT") ? string.Empty : $",{regs[i]}";
+                yield return new Instruction(instruction.Id, $"{instruction.MnemonicTemplate}{regSuffix}", $"{prefix} CB d {opcode & ~7 | i:X2}", instruction.TStateCount);
+            }
+        }
+    }
+}
@@ -563,6 +563,7 @@ public partial class Z80Instructions
         RES_6_addrHL,
         RES_7_addrHL,
         RES_n_addrIX_plus_d,
+        RES_n_addrIY_plus_d,
         SET_0_A,
         SET_1_A,
         SET_2_A,
@@ -15,10 +15,8 @@ public partial class Z80Instructions
 {
     private void InitList()
     {
-        var placeholder = new Instruction(InstructionID.NOP, "#", "00");
-        
         // Note: Order is important - Only append.
-        m_instructions = new[]
+        m_instructions = new Instruction[]
         {
             new(InstructionID.ADC_A_A, "ADC A,A", "8F", 4),
             new(InstructionID.ADC_A_B, "ADC A,B", "88", 4),
@@ -89,8 +87,8 @@ public partial class Z80Instructions
             new(InstructionID.BIT_0_H, "BIT 0,H", "CB 44", 8),
             new(InstructionID.BIT_0_L, "BIT 0,L", "CB 45", 8),
             new(InstructionID.BIT_0_addrHL, "BIT 0,(HL)", "CB 46", 12),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_0_addrIX_plus_d, "BIT 0,(IX+d)", "DD CB d 46", 20),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_0_addrIY_plus_d, "BIT 0,(IY+d)", "FD CB d 46", 20),
+            new(InstructionID.BIT_n_addrIX_plus_d, "BIT 0,(IX+d)", "DD CB d 46", 20),
+            new(InstructionID.BIT_n_addrIY_plus_d, "BIT 0,(IY+d)", "FD CB d 46", 20),
             new(InstructionID.BIT_1_A, "BIT 1,A", "CB 4F", 8),
             new(InstructionID.BIT_1_B, "BIT 1,B", "CB 48", 8),
             new(InstructionID.BIT_1_C, "BIT 1,C", "CB 49", 8),
@@ -99,8 +97,8 @@ public partial class Z80Instructions
             new(InstructionID.BIT_1_H, "BIT 1,H", "CB 4C", 8),
             new(InstructionID.BIT_1_L, "BIT 1,L", "CB 4D", 8),
             new(InstructionID.BIT_1_addrHL, "BIT 1,(HL)", "CB 4E", 12),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_1_addrIX_plus_d, "BIT 1,(IX+d)", "DD CB d 4E", 20),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_1_addrIY_plus_d, "BIT 1,(IY+d)", "FD CB d 4E", 20),
+            new(InstructionID.BIT_n_addrIX_plus_d, "BIT 1,(IX+d)", "DD CB d 4E", 20),
+            new(InstructionID.BIT_n_addrIY_plus_d, "BIT 1,(IY+d)", "FD CB d 4E", 20),
             new(InstructionID.BIT_2_A, "BIT 2,A", "CB 57", 8),
             new(InstructionID.BIT_2_B, "BIT 2,B", "CB 50", 8),
             new(InstructionID.BIT_2_C, "BIT 2,C", "CB 51", 8),
@@ -109,8 +107,8 @@ public partial class Z80Instructions
             new(InstructionID.BIT_2_H, "BIT 2,H", "CB 54", 8),
             new(InstructionID.BIT_2_L, "BIT 2,L", "CB 55", 8),
             new(InstructionID.BIT_2_addrHL, "BIT 2,(HL)", "CB 56", 12),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_2_addrIX_plus_d, "BIT 2,(IX+d)", "DD CB d 56", 20),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_2_addrIY_plus_d, "BIT 2,(IY+d)", "FD CB d 56", 20),
+            new(InstructionID.BIT_n_addrIX_plus_d, "BIT 2,(IX+d)", "DD CB d 56", 20),
+            new(InstructionID.BIT_n_addrIY_plus_d, "BIT 2,(IY+d)", "FD CB d 56", 20),
             new(InstructionID.BIT_3_A, "BIT 3,A", "CB 5F", 8),
             new(InstructionID.BIT_3_B, "BIT 3,B", "CB 58", 8),
             new(InstructionID.BIT_3_C, "BIT 3,C", "CB 59", 8),
@@ -119,8 +117,8 @@ public partial class Z80Instructions
             new(InstructionID.BIT_3_H, "BIT 3,H", "CB 5C", 8),
             new(InstructionID.BIT_3_L, "BIT 3,L", "CB 5D", 8),
             new(InstructionID.BIT_3_addrHL, "BIT 3,(HL)", "CB 5E", 12),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_3_addrIX_plus_d, "BIT 3,(IX+d)", "DD CB d 5E", 20),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_3_addrIY_plus_d, "BIT 3,(IY+d)", "FD CB d 5E", 20),
+            new(InstructionID.BIT_n_addrIX_plus_d, "BIT 3,(IX+d)", "DD CB d 5E", 20),
+            new(InstructionID.BIT_n_addrIY_plus_d, "BIT 3,(IY+d)", "FD CB d 5E", 20),
             new(InstructionID.BIT_4_A, "BIT 4,A", "CB 67", 8),
             new(InstructionID.BIT_4_B, "BIT 4,B", "CB 60", 8),
             new(InstructionID.BIT_4_C, "BIT 4,C", "CB 61", 8),
@@ -129,8 +127,8 @@ public partial class Z80Instructions
             new(InstructionID.BIT_4_H, "BIT 4,H", "CB 64", 8),
             new(InstructionID.BIT_4_L, "BIT 4,L", "CB 65", 8),
             new(InstructionID.BIT_4_addrHL, "BIT 4,(HL)", "CB 66", 12),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_4_addrIX_plus_d, "BIT 4,(IX+d)", "DD CB d 66", 20),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_4_addrIY_plus_d, "BIT 4,(IY+d)", "FD CB d 66", 20),
+            new(InstructionID.BIT_n_addrIX_plus_d, "BIT 4,(IX+d)", "DD CB d 66", 20),
+            new(InstructionID.BIT_n_addrIY_plus_d, "BIT 4,(IY+d)", "FD CB d 66", 20),
             new(InstructionID.BIT_5_A, "BIT 5,A", "CB 6F", 8),
             new(InstructionID.BIT_5_B, "BIT 5,B", "CB 68", 8),
             new(InstructionID.BIT_5_C, "BIT 5,C", "CB 69", 8),
@@ -139,8 +137,8 @@ public partial class Z80Instructions
             new(InstructionID.BIT_5_H, "BIT 5,H", "CB 6C", 8),
             new(InstructionID.BIT_5_L, "BIT 5,L", "CB 6D", 8),
             new(InstructionID.BIT_5_addrHL, "BIT 5,(HL)", "CB 6E", 12),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_5_addrIX_plus_d, "BIT 5,(IX+d)", "DD CB d 6E", 20),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_5_addrIY_plus_d, "BIT 5,(IY+d)", "FD CB d 6E", 20),
+            new(InstructionID.BIT_n_addrIX_plus_d, "BIT 5,(IX+d)", "DD CB d 6E", 20),
+            new(InstructionID.BIT_n_addrIY_plus_d, "BIT 5,(IY+d)", "FD CB d 6E", 20),
             new(InstructionID.BIT_6_A, "BIT 6,A", "CB 77", 8),
             new(InstructionID.BIT_6_B, "BIT 6,B", "CB 70", 8),
             new(InstructionID.BIT_6_C, "BIT 6,C", "CB 71", 8),
@@ -149,8 +147,8 @@ public partial class Z80Instructions
             new(InstructionID.BIT_6_H, "BIT 6,H", "CB 74", 8),
             new(InstructionID.BIT_6_L, "BIT 6,L", "CB 75", 8),
             new(InstructionID.BIT_6_addrHL, "BIT 6,(HL)", "CB 76", 12),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_6_addrIX_plus_d, "BIT 6,(IX+d)", "DD CB d 76", 20),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_6_addrIY_plus_d, "BIT 6,(IY+d)", "FD CB d 76", 20),
+            new(InstructionID.BIT_n_addrIX_plus_d, "BIT 6,(IX+d)", "DD CB d 76", 20),
+            new(InstructionID.BIT_n_addrIY_plus_d, "BIT 6,(IY+d)", "FD CB d 76", 20),
             new(InstructionID.BIT_7_A, "BIT 7,A", "CB 7F", 8),
             new(InstructionID.BIT_7_B, "BIT 7,B", "CB 78", 8),
             new(InstructionID.BIT_7_C, "BIT 7,C", "CB 79", 8),
@@ -159,8 +157,8 @@ public partial class Z80Instructions
             new(InstructionID.BIT_7_H, "BIT 7,H", "CB 7C", 8),
             new(InstructionID.BIT_7_L, "BIT 7,L", "CB 7D", 8),
             new(InstructionID.BIT_7_addrHL, "BIT 7,(HL)", "CB 7E", 12),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_7_addrIX_plus_d, "BIT 7,(IX+d)", "DD CB d 7E", 20),
-            placeholder, // Handled dynamically: new(InstructionID.BIT_7_addrIY_plus_d, "BIT 7,(IY+d)", "FD CB d 7E", 20),
+            new(InstructionID.BIT_n_addrIX_plus_d, "BIT 7,(IX+d)", "DD CB d 7E", 20),
+            new(InstructionID.BIT_n_addrIY_plus_d, "BIT 7,(IY+d)", "FD CB d 7E", 20),
             new(InstructionID.CALL_C_nn, "CALL C,nn", "DC n n", 17),
             new(InstructionID.CALL_DJNZ_n, "DJNZ n", "10 n", 8),
             new(InstructionID.CALL_M_nn, "CALL M,nn", "FC n n", 17),
@@ -465,7 +463,7 @@ public partial class Z80Instructions
             new(InstructionID.LD_addr_IY, "LD (nn),IY", "FD 22 n n", 20),
             new(InstructionID.LD_addr_SP, "LD (nn),SP", "ED 73 n n", 20),
             new(InstructionID.NEG, "NEG", "ED 44", 8),
-            Nop,
+            new(InstructionID.NOP, "NOP", "00", 4),
             new(InstructionID.NOPNOP, "NOP NOP", "00 00", 8),
             new(InstructionID.OR_A, "OR A", "B7", 4),
             new(InstructionID.OR_B, "OR B", "B0", 4),
@@ -514,8 +512,8 @@ public partial class Z80Instructions
             new(InstructionID.RES_0_H, "RES 0,H", "CB 84", 8),
             new(InstructionID.RES_0_L, "RES 0,L", "CB 85", 8),
             new(InstructionID.RES_0_addrHL, "RES 0,(HL)", "CB 86", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RES_0_addrIX_plus_d, "RES 0,(IX+d)", "DD CB d 86", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RES_0_addrIY_plus_d, "RES 0,(IY+d)", "FD CB d 86", 23),
+            new(InstructionID.RES_n_addrIX_plus_d, "RES 0,(IX+d)", "DD CB d 86", 23),
+            new(InstructionID.RES_n_addrIY_plus_d, "RES 0,(IY+d)", "FD CB d 86", 23),
             new(InstructionID.RES_1_A, "RES 1,A", "CB 8F", 8),
             new(InstructionID.RES_1_B, "RES 1,B", "CB 88", 8),
             new(InstructionID.RES_1_C, "RES 1,C", "CB 89", 8),
@@ -524,8 +522,8 @@ public partial class Z80Instructions
             new(InstructionID.RES_1_H, "RES 1,H", "CB 8C", 8),
             new(InstructionID.RES_1_L, "RES 1,L", "CB 8D", 8),
             new(InstructionID.RES_1_addrHL, "RES 1,(HL)", "CB 8E", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RES_1_addrIX_plus_d, "RES 1,(IX+d)", "DD CB d 8E", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RES_1_addrIY_plus_d, "RES 1,(IY+d)", "FD CB d 8E", 23),
+            new(InstructionID.RES_n_addrIX_plus_d, "RES 1,(IX+d)", "DD CB d 8E", 23),
+            new(InstructionID.RES_n_addrIY_plus_d, "RES 1,(IY+d)", "FD CB d 8E", 23),
             new(InstructionID.RES_2_A, "RES 2,A", "CB 97", 8),
             new(InstructionID.RES_2_B, "RES 2,B", "CB 90", 8),
             new(InstructionID.RES_2_C, "RES 2,C", "CB 91", 8),
@@ -534,8 +532,8 @@ public partial class Z80Instructions
             new(InstructionID.RES_2_H, "RES 2,H", "CB 94", 8),
             new(InstructionID.RES_2_L, "RES 2,L", "CB 95", 8),
             new(InstructionID.RES_2_addrHL, "RES 2,(HL)", "CB 96", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RES_2_addrIX_plus_d, "RES 2,(IX+d)", "DD CB d 96", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RES_2_addrIY_plus_d, "RES 2,(IY+d)", "FD CB d 96", 23),
+            new(InstructionID.RES_n_addrIX_plus_d, "RES 2,(IX+d)", "DD CB d 96", 23),
+            new(InstructionID.RES_n_addrIY_plus_d, "RES 2,(IY+d)", "FD CB d 96", 23),
             new(InstructionID.RES_3_A, "RES 3,A", "CB 9F", 8),
             new(InstructionID.RES_3_B, "RES 3,B", "CB 98", 8),
             new(InstructionID.RES_3_C, "RES 3,C", "CB 99", 8),
@@ -544,8 +542,8 @@ public partial class Z80Instructions
             new(InstructionID.RES_3_H, "RES 3,H", "CB 9C", 8),
             new(InstructionID.RES_3_L, "RES 3,L", "CB 9D", 8),
             new(InstructionID.RES_3_addrHL, "RES 3,(HL)", "CB 9E", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RES_3_addrIX_plus_d, "RES 3,(IX+d)", "DD CB d 9E", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RES_3_addrIY_plus_d, "RES 3,(IY+d)", "FD CB d 9E", 23),
+            new(InstructionID.RES_n_addrIX_plus_d, "RES 3,(IX+d)", "DD CB d 9E", 23),
+            new(InstructionID.RES_n_addrIY_plus_d, "RES 3,(IY+d)", "FD CB d 9E", 23),
             new(InstructionID.RES_4_A, "RES 4,A", "CB A7", 8),
             new(InstructionID.RES_4_B, "RES 4,B", "CB A0", 8),
             new(InstructionID.RES_4_C, "RES 4,C", "CB A1", 8),
@@ -554,8 +552,8 @@ public partial class Z80Instructions
             new(InstructionID.RES_4_H, "RES 4,H", "CB A4", 8),
             new(InstructionID.RES_4_L, "RES 4,L", "CB A5", 8),
             new(InstructionID.RES_4_addrHL, "RES 4,(HL)", "CB A6", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RES_4_addrIX_plus_d, "RES 4,(IX+d)", "DD CB d A6", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RES_4_addrIY_plus_d, "RES 4,(IY+d)", "FD CB d A6", 23),
+            new(InstructionID.RES_n_addrIX_plus_d, "RES 4,(IX+d)", "DD CB d A6", 23),
+            new(InstructionID.RES_n_addrIY_plus_d, "RES 4,(IY+d)", "FD CB d A6", 23),
             new(InstructionID.RES_5_A, "RES 5,A", "CB AF", 8),
             new(InstructionID.RES_5_B, "RES 5,B", "CB A8", 8),
             new(InstructionID.RES_5_C, "RES 5,C", "CB A9", 8),
@@ -564,8 +562,8 @@ public partial class Z80Instructions
             new(InstructionID.RES_5_H, "RES 5,H", "CB AC", 8),
             new(InstructionID.RES_5_L, "RES 5,L", "CB AD", 8),
             new(InstructionID.RES_5_addrHL, "RES 5,(HL)", "CB AE", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RES_5_addrIX_plus_d, "RES 5,(IX+d)", "DD CB d AE", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RES_5_addrIY_plus_d, "RES 5,(IY+d)", "FD CB d AE", 23),
+            new(InstructionID.RES_n_addrIX_plus_d, "RES 5,(IX+d)", "DD CB d AE", 23),
+            new(InstructionID.RES_n_addrIY_plus_d, "RES 5,(IY+d)", "FD CB d AE", 23),
             new(InstructionID.RES_6_A, "RES 6,A", "CB B7", 8),
             new(InstructionID.RES_6_B, "RES 6,B", "CB B0", 8),
             new(InstructionID.RES_6_C, "RES 6,C", "CB B1", 8),
@@ -574,8 +572,8 @@ public partial class Z80Instructions
             new(InstructionID.RES_6_H, "RES 6,H", "CB B4", 8),
             new(InstructionID.RES_6_L, "RES 6,L", "CB B5", 8),
             new(InstructionID.RES_6_addrHL, "RES 6,(HL)", "CB B6", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RES_6_addrIX_plus_d, "RES 6,(IX+d)", "DD CB d B6", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RES_6_addrIY_plus_d, "RES 6,(IY+d)", "FD CB d B6", 23),
+            new(InstructionID.RES_n_addrIX_plus_d, "RES 6,(IX+d)", "DD CB d B6", 23),
+            new(InstructionID.RES_n_addrIY_plus_d, "RES 6,(IY+d)", "FD CB d B6", 23),
             new(InstructionID.RES_7_A, "RES 7,A", "CB BF", 8),
             new(InstructionID.RES_7_B, "RES 7,B", "CB B8", 8),
             new(InstructionID.RES_7_C, "RES 7,C", "CB B9", 8),
@@ -584,8 +582,8 @@ public partial class Z80Instructions
             new(InstructionID.RES_7_H, "RES 7,H", "CB BC", 8),
             new(InstructionID.RES_7_L, "RES 7,L", "CB BD", 8),
             new(InstructionID.RES_7_addrHL, "RES 7,(HL)", "CB BE", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RES_7_addrIX_plus_d, "RES 7,(IX+d)", "DD CB d BE", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RES_7_addrIY_plus_d, "RES 7,(IY+d)", "FD CB d BE", 23),
+            new(InstructionID.RES_n_addrIX_plus_d, "RES 7,(IX+d)", "DD CB d BE", 23),
+            new(InstructionID.RES_n_addrIY_plus_d, "RES 7,(IY+d)", "FD CB d BE", 23),
             new(InstructionID.RET, "RET", "C9", 10),
             new(InstructionID.RETI, "RETI", "ED 4D", 14),
             new(InstructionID.RETN, "RETN", "ED 45", 14),
@@ -607,8 +605,8 @@ public partial class Z80Instructions
             new(InstructionID.RLC_H, "RLC H", "CB 04", 8),
             new(InstructionID.RLC_L, "RLC L", "CB 05", 8),
             new(InstructionID.RLC_addrHL, "RLC (HL)", "CB 06", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RLC_addrIX_plus_d, "RLC (IX+d)", "DD CB d 06", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RLC_addrIY_plus_d, "RLC (IY+d)", "FD CB d 06", 23),
+            new(InstructionID.RLC_addrIX_plus_d, "RLC (IX+d)", "DD CB d 06", 23),
+            new(InstructionID.RLC_addrIY_plus_d, "RLC (IY+d)", "FD CB d 06", 23),
             new(InstructionID.RLD, "RLD", "ED 6F", 18),
             new(InstructionID.RL_A, "RL A", "CB 17", 8),
             new(InstructionID.RL_B, "RL B", "CB 10", 8),
@@ -618,8 +616,8 @@ public partial class Z80Instructions
             new(InstructionID.RL_H, "RL H", "CB 14", 8),
             new(InstructionID.RL_L, "RL L", "CB 15", 8),
             new(InstructionID.RL_addrHL, "RL (HL)", "CB 16", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RL_addrIX_plus_d, "RL (IX+d)", "DD CB d 16", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RL_addrIY_plus_d, "RL (IY+d)", "FD CB d 16", 23),
+            new(InstructionID.RL_addrIX_plus_d, "RL (IX+d)", "DD CB d 16", 23),
+            new(InstructionID.RL_addrIY_plus_d, "RL (IY+d)", "FD CB d 16", 23),
             new(InstructionID.RRA, "RRA", "1F", 4),
             new(InstructionID.RRCA, "RRCA", "0F", 4),
             new(InstructionID.RRC_A, "RRC A", "CB 0F", 8),
@@ -630,8 +628,8 @@ public partial class Z80Instructions
             new(InstructionID.RRC_H, "RRC H", "CB 0C", 8),
             new(InstructionID.RRC_L, "RRC L", "CB 0D", 8),
             new(InstructionID.RRC_addrHL, "RRC (HL)", "CB 0E", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RRC_addrIX_plus_d, "RRC (IX+d)", "DD CB d 0E", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RRC_addrIY_plus_d, "RRC (IY+d)", "FD CB d 0E", 23),
+            new(InstructionID.RRC_addrIX_plus_d, "RRC (IX+d)", "DD CB d 0E", 23),
+            new(InstructionID.RRC_addrIY_plus_d, "RRC (IY+d)", "FD CB d 0E", 23),
             new(InstructionID.RRD, "RRD", "ED 67", 18),
             new(InstructionID.RR_A, "RR A", "CB 1F", 8),
             new(InstructionID.RR_B, "RR B", "CB 18", 8),
@@ -641,8 +639,8 @@ public partial class Z80Instructions
             new(InstructionID.RR_H, "RR H", "CB 1C", 8),
             new(InstructionID.RR_L, "RR L", "CB 1D", 8),
             new(InstructionID.RR_addrHL, "RR (HL)", "CB 1E", 15),
-            placeholder, // Handled dynamically: new(InstructionID.RR_addrIX_plus_d, "RR (IX+d)", "DD CB d 1E", 23),
-            placeholder, // Handled dynamically: new(InstructionID.RR_addrIY_plus_d, "RR (IY+d)", "FD CB d 1E", 23),
+            new(InstructionID.RR_addrIX_plus_d, "RR (IX+d)", "DD CB d 1E", 23),
+            new(InstructionID.RR_addrIY_plus_d, "RR (IY+d)", "FD CB d 1E", 23),
             new(InstructionID.RST_00, "RST 00", "C7", 11),
             new(InstructionID.RST_08, "RST 08", "CF", 11),
             new(InstructionID.RST_10, "RST 10", "D7", 11),
@@ -679,8 +677,8 @@ public partial class Z80Instructions
             new(InstructionID.SET_0_H, "SET 0,H", "CB C4", 8),
             new(InstructionID.SET_0_L, "SET 0,L", "CB C5", 8),
             new(InstructionID.SET_0_addrHL, "SET 0,(HL)", "CB C6", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SET_0_addrIX_plus_d, "SET 0,(IX+d)", "DD CB d C6", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SET_0_addrIY_plus_d, "SET 0,(IY+d)", "FD CB d C6", 23),
+            new(InstructionID.SET_n_addrIX_plus_d, "SET 0,(IX+d)", "DD CB d C6", 23),
+            new(InstructionID.SET_n_addrIY_plus_d, "SET 0,(IY+d)", "FD CB d C6", 23),
             new(InstructionID.SET_1_A, "SET 1,A", "CB CF", 8),
             new(InstructionID.SET_1_B, "SET 1,B", "CB C8", 8),
             new(InstructionID.SET_1_C, "SET 1,C", "CB C9", 8),
@@ -689,8 +687,8 @@ public partial class Z80Instructions
             new(InstructionID.SET_1_H, "SET 1,H", "CB CC", 8),
             new(InstructionID.SET_1_L, "SET 1,L", "CB CD", 8),
             new(InstructionID.SET_1_addrHL, "SET 1,(HL)", "CB CE", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SET_1_addrIX_plus_d, "SET 1,(IX+d)", "DD CB d CE", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SET_1_addrIY_plus_d, "SET 1,(IY+d)", "FD CB d CE", 23),
+            new(InstructionID.SET_n_addrIX_plus_d, "SET 1,(IX+d)", "DD CB d CE", 23),
+            new(InstructionID.SET_n_addrIY_plus_d, "SET 1,(IY+d)", "FD CB d CE", 23),
             new(InstructionID.SET_2_A, "SET 2,A", "CB D7", 8),
             new(InstructionID.SET_2_B, "SET 2,B", "CB D0", 8),
             new(InstructionID.SET_2_C, "SET 2,C", "CB D1", 8),
@@ -699,8 +697,8 @@ public partial class Z80Instructions
             new(InstructionID.SET_2_H, "SET 2,H", "CB D4", 8),
             new(InstructionID.SET_2_L, "SET 2,L", "CB D5", 8),
             new(InstructionID.SET_2_addrHL, "SET 2,(HL)", "CB D6", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SET_2_addrIX_plus_d, "SET 2,(IX+d)", "DD CB d D6", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SET_2_addrIY_plus_d, "SET 2,(IY+d)", "FD CB d D6", 23),
+            new(InstructionID.SET_n_addrIX_plus_d, "SET 2,(IX+d)", "DD CB d D6", 23),
+            new(InstructionID.SET_n_addrIY_plus_d, "SET 2,(IY+d)", "FD CB d D6", 23),
             new(InstructionID.SET_3_A, "SET 3,A", "CB DF", 8),
             new(InstructionID.SET_3_B, "SET 3,B", "CB D8", 8),
             new(InstructionID.SET_3_C, "SET 3,C", "CB D9", 8),
@@ -709,8 +707,8 @@ public partial class Z80Instructions
             new(InstructionID.SET_3_H, "SET 3,H", "CB DC", 8),
             new(InstructionID.SET_3_L, "SET 3,L", "CB DD", 8),
             new(InstructionID.SET_3_addrHL, "SET 3,(HL)", "CB DE", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SET_3_addrIX_plus_d, "SET 3,(IX+d)", "DD CB d DE", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SET_3_addrIY_plus_d, "SET 3,(IY+d)", "FD CB d DE", 23),
+            new(InstructionID.SET_n_addrIX_plus_d, "SET 3,(IX+d)", "DD CB d DE", 23),
+            new(InstructionID.SET_n_addrIY_plus_d, "SET 3,(IY+d)", "FD CB d DE", 23),
             new(InstructionID.SET_4_A, "SET 4,A", "CB E7", 8),
             new(InstructionID.SET_4_B, "SET 4,B", "CB E0", 8),
             new(InstructionID.SET_4_C, "SET 4,C", "CB E1", 8),
@@ -719,8 +717,8 @@ public partial class Z80Instructions
             new(InstructionID.SET_4_H, "SET 4,H", "CB E4", 8),
             new(InstructionID.SET_4_L, "SET 4,L", "CB E5", 8),
             new(InstructionID.SET_4_addrHL, "SET 4,(HL)", "CB E6", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SET_4_addrIX_plus_d, "SET 4,(IX+d)", "DD CB d E6", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SET_4_addrIY_plus_d, "SET 4,(IY+d)", "FD CB d E6", 23),
+            new(InstructionID.SET_n_addrIX_plus_d, "SET 4,(IX+d)", "DD CB d E6", 23),
+            new(InstructionID.SET_n_addrIY_plus_d, "SET 4,(IY+d)", "FD CB d E6", 23),
             new(InstructionID.SET_5_A, "SET 5,A", "CB EF", 8),
             new(InstructionID.SET_5_B, "SET 5,B", "CB E8", 8),
             new(InstructionID.SET_5_C, "SET 5,C", "CB E9", 8),
@@ -729,8 +727,8 @@ public partial class Z80Instructions
             new(InstructionID.SET_5_H, "SET 5,H", "CB EC", 8),
             new(InstructionID.SET_5_L, "SET 5,L", "CB ED", 8),
             new(InstructionID.SET_5_addrHL, "SET 5,(HL)", "CB EE", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SET_5_addrIX_plus_d, "SET 5,(IX+d)", "DD CB d EE", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SET_5_addrIY_plus_d, "SET 5,(IY+d)", "FD CB d EE", 23),
+            new(InstructionID.SET_n_addrIX_plus_d, "SET 5,(IX+d)", "DD CB d EE", 23),
+            new(InstructionID.SET_n_addrIY_plus_d, "SET 5,(IY+d)", "FD CB d EE", 23),
             new(InstructionID.SET_6_A, "SET 6,A", "CB F7", 8),
             new(InstructionID.SET_6_B, "SET 6,B", "CB F0", 8),
             new(InstructionID.SET_6_C, "SET 6,C", "CB F1", 8),
@@ -739,8 +737,8 @@ public partial class Z80Instructions
             new(InstructionID.SET_6_H, "SET 6,H", "CB F4", 8),
             new(InstructionID.SET_6_L, "SET 6,L", "CB F5", 8),
             new(InstructionID.SET_6_addrHL, "SET 6,(HL)", "CB F6", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SET_6_addrIX_plus_d, "SET 6,(IX+d)", "DD CB d F6", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SET_6_addrIY_plus_d, "SET 6,(IY+d)", "FD CB d F6", 23),
+            new(InstructionID.SET_n_addrIX_plus_d, "SET 6,(IX+d)", "DD CB d F6", 23),
+            new(InstructionID.SET_n_addrIY_plus_d, "SET 6,(IY+d)", "FD CB d F6", 23),
             new(InstructionID.SET_7_A, "SET 7,A", "CB FF", 8),
             new(InstructionID.SET_7_B, "SET 7,B", "CB F8", 8),
             new(InstructionID.SET_7_C, "SET 7,C", "CB F9", 8),
@@ -749,8 +747,8 @@ public partial class Z80Instructions
             new(InstructionID.SET_7_H, "SET 7,H", "CB FC", 8),
             new(InstructionID.SET_7_L, "SET 7,L", "CB FD", 8),
             new(InstructionID.SET_7_addrHL, "SET 7,(HL)", "CB FE", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SET_7_addrIX_plus_d, "SET 7,(IX+d)", "DD CB d FE", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SET_7_addrIY_plus_d, "SET 7,(IY+d)", "FD CB d FE", 23),
+            new(InstructionID.SET_n_addrIX_plus_d, "SET 7,(IX+d)", "DD CB d FE", 23),
+            new(InstructionID.SET_n_addrIY_plus_d, "SET 7,(IY+d)", "FD CB d FE", 23),
             new(InstructionID.SLA_A, "SLA A", "CB 27", 8),
             new(InstructionID.SLA_B, "SLA B", "CB 20", 8),
             new(InstructionID.SLA_C, "SLA C", "CB 21", 8),
@@ -759,8 +757,8 @@ public partial class Z80Instructions
             new(InstructionID.SLA_H, "SLA H", "CB 24", 8),
             new(InstructionID.SLA_L, "SLA L", "CB 25", 8),
             new(InstructionID.SLA_addrHL, "SLA (HL)", "CB 26", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SLA_addrIX_plus_d, "SLA (IX+d)", "DD CB d 26", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SLA_addrIY_plus_d, "SLA (IY+d)", "FD CB d 26", 23),
+            new(InstructionID.SLA_addrIX_plus_d, "SLA (IX+d)", "DD CB d 26", 23),
+            new(InstructionID.SLA_addrIY_plus_d, "SLA (IY+d)", "FD CB d 26", 23),
             new(InstructionID.SLL_A, "SLL A", "CB 37", 8),
             new(InstructionID.SLL_B, "SLL B", "CB 30", 8),
             new(InstructionID.SLL_C, "SLL C", "CB 31", 8),
@@ -777,8 +775,8 @@ public partial class Z80Instructions
             new(InstructionID.SRA_H, "SRA H", "CB 2C", 8),
             new(InstructionID.SRA_L, "SRA L", "CB 2D", 8),
             new(InstructionID.SRA_addrHL, "SRA (HL)", "CB 2E", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SRA_addrIX_plus_d, "SRA (IX+d)", "DD CB d 2E", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SRA_addrIY_plus_d, "SRA (IY+d)", "FD CB d 2E", 23),
+            new(InstructionID.SRA_addrIX_plus_d, "SRA (IX+d)", "DD CB d 2E", 23),
+            new(InstructionID.SRA_addrIY_plus_d, "SRA (IY+d)", "FD CB d 2E", 23),
             new(InstructionID.SRL_A, "SRL A", "CB 3F", 8),
             new(InstructionID.SRL_B, "SRL B", "CB 38", 8),
             new(InstructionID.SRL_C, "SRL C", "CB 39", 8),
@@ -787,8 +785,8 @@ public partial class Z80Instructions
             new(InstructionID.SRL_H, "SRL H", "CB 3C", 8),
             new(InstructionID.SRL_L, "SRL L", "CB 3D", 8),
             new(InstructionID.SRL_addrHL, "SRL (HL)", "CB 3E", 15),
-            placeholder, // Handled dynamically: new(InstructionID.SRL_addrIX_plus_d, "SRL (IX+d)", "DD CB d 3E", 23),
-            placeholder, // Handled dynamically: new(InstructionID.SRL_addrIY_plus_d, "SRL (IY+d)", "FD CB d 3E", 23),
+            new(InstructionID.SRL_addrIX_plus_d, "SRL (IX+d)", "DD CB d 3E", 23),
+            new(InstructionID.SRL_addrIY_plus_d, "SRL (IY+d)", "FD CB d 3E", 23),
             new(InstructionID.SUB_A, "SUB A", "97", 4),
             new(InstructionID.SUB_B, "SUB B", "90", 4),
             new(InstructionID.SUB_C, "SUB C", "91", 4),
@@ -839,7 +837,8 @@ public partial class Z80Instructions
             new(InstructionID.IM2, "IM2", "ED 7E", 8),    // Z80 duplicate of ED 5E.
             new(InstructionID.IN_addr_C, "IN (C)", "ED 70", 12), // Undocumented.
             new(InstructionID.OUT_addr_C_0, "OUT (C),0", "ED 71", 12), // Undocumented.
+            new(InstructionID.SLL_addrIX_plus_d, "SLL (IX+d)", "DD CB d 36", 23), // Undocumented.
+            new(InstructionID.SLL_addrIY_plus_d, "SLL (IY+d)", "FD CB d 36", 23), // Undocumented.
         };
-        m_opcodeToInstructionLUT ??= InitPrimaryInstructionLookup();
     }
 }
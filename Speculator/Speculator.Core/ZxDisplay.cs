@@ -10,6 +10,7 @@
 // THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
 
 using System.Collections;
+using System.Runtime.InteropServices;
 using Avalonia;
 using Avalonia.Media.Imaging;
 using Avalonia.Platform;
@@ -17,12 +18,13 @@ using CSharp.Core;
 using CSharp.Core.Extensions;
 using CSharp.Core.ViewModels;
 using OpenTK.Mathematics;
+using Speculator.Core.Utils;
 using Vector = Avalonia.Vector;
 using Vector3 = System.Numerics.Vector3;
 
 namespace Speculator.Core;
 
-public class ZxDisplay : ViewModelBase
+public class ZxDisplay : ViewModelBase, IDisposable
 {
     public const int ScreenBase = 0x4000;
 
@@ -33,7 +35,18 @@ public class ZxDisplay : ViewModelBase
     private const int BottomMargin = 24;
     private const int WriteableWidth = 256;
     private const int WritableHeight = 192;
-    private const int FramesPerFlash = 16;
+    internal const int FramesPerFlash = 16;
+
+    /// <summary>
+    /// The scanline (counted from the frame interrupt) drawing the top row of the display file, at T-state 14336.
+    /// </summary>
+    private const int FirstDisplayScanline = 64;
+
+    /// <summary>
+    /// The size of the screen buffer, in pixels.
+    /// </summary>
+    internal const int ScreenWidth = LeftMargin + WriteableWidth + RightMargin;
+    internal const int ScreenHeight = TopMargin + WritableHeight + BottomMargin;
     private bool m_isCrt = true;
     private Vector3 m_scanlineMultiplier;
     private float m_phosphorShrink;
@@ -45,6 +58,13 @@ public class ZxDisplay : ViewModelBase
     private double m_emulationSpeed;
     private bool m_isPaused;
     private readonly Random m_random = new Random(0);
+    private int m_bandCount = Math.Max(1, Environment.ProcessorCount - 1);
+
+    /// <summary>
+    /// A random number stream for each band, so the pause effects are reproducible whichever
+    /// worker renders the band.
+    /// </summary>
+    private Random[] m_bandRandoms;
     private readonly BitArray m_pauseBitmap = new BitArray(new byte[] { 0x1F, 0x1E, 0x21, 0x1E, 0xFF, 0x87, 0x47, 0x88, 0xC7, 0x1F, 0x12, 0x12, 0x12, 0x10, 0x84, 0x84, 0x84, 0x04, 0x04, 0x21, 0x21, 0x21, 0x1E, 0x5F, 0x48, 0x48, 0x88, 0xC7, 0xF7, 0xF1, 0x13, 0x02, 0x12, 0x7C, 0xFC, 0x84, 0x80, 0x04, 0x01, 0x21, 0x21, 0x21, 0x41, 0x40, 0x48, 0x48, 0x48, 0x10, 0x10, 0xE2, 0xE1, 0xF1, 0x07, 0x84, 0x78, 0x78, 0xFC});
 
     /// <summary>
@@ -55,12 +75,32 @@ public class ZxDisplay : ViewModelBase
     /// <summary>
     /// 'Grain' overlay applied to the CRT screen.
     /// </summary>
-    private readonly Vector3[][] m_grain;
+    private readonly float[][] m_grain;
+
+    /// <summary>
+    /// Renders the screen buffer into the bitmap, rebuilt whenever the CRT settings change.
+    /// </summary>
+    private CrtShader m_crtShader;
 
     /// <summary>
     /// 320x240 Buffer of pixels, each byte a palette index.
     /// </summary>
-    private readonly byte[][] m_screenBuffer = CreateScreenBuffer();
+    /// <remarks>
+    /// Owned by the CPU thread, and only partially redrawn each frame.
+    /// </remarks>
+    private readonly byte[] m_screenBuffer = CreateScreenBuffer();
+
+    /// <summary>
+    /// Completed frames, handed from the CPU thread to the presenter thread.
+    /// </summary>
+    private readonly TripleBuffer<byte[]> m_frames = new TripleBuffer<byte[]>(CreateScreenBuffer);
+
+    /// <summary>
+    /// Renders frames into the bitmap, so the CRT shader never stalls emulation.
+    /// </summary>
+    private readonly Thread m_presenterThread;
+    private readonly AutoResetEvent m_presentRequested = new AutoResetEvent(false);
+    private bool m_isDisposed;
 
     /// <summary>
     /// Bitmap used to contain the RGB pixel data blitted to the screen.
@@ -72,7 +112,7 @@ public class ZxDisplay : ViewModelBase
     /// </summary>
     private bool m_didPixelsChange;
     
-    private static readonly Vector3[] Colors =
+    internal static readonly Vector3[] Colors =
     {
         new Vector3(0x00, 0x00, 0x00), // Black
         new Vector3(0x00, 0x00, 0xCD), // Blue
@@ -91,37 +131,95 @@ public class ZxDisplay : ViewModelBase
         new Vector3(0xFF, 0xFF, 0x00), // Bright Yellow
         new Vector3(0xFF, 0xFF, 0xFF)  // Bright White
     };
+
+    /// <summary>
+    /// Each bitmap byte expanded into 8 pixel bytes, 0xFF where the bit is set (Leftmost pixel first).
+    /// </summary>
+    private static readonly ulong[] PixelMasks = CreatePixelMasks();
+
+    /// <summary>
+    /// The pen and paper palette indices of each attribute, repeated across 8 pixel bytes.
+    /// </summary>
+    /// <remarks>
+    /// Entries 256-511 are the variant with pen and paper swapped for flashing attributes.
+    /// </remarks>
+    private static readonly ulong[] PenPixels = CreateAttributePixels(true);
+    private static readonly ulong[] PaperPixels = CreateAttributePixels(false);
     
-    public byte BorderAttr { get; set; }
+    /// <summary>
+    /// Border and display writes made since the last drawn scanline, if attached to a CPU.
+    /// </summary>
+    private UlaEventLog m_ulaEvents;
+    private byte m_borderAttr;
+
+    public byte BorderAttr
+    {
+        get => m_borderAttr;
+        set
+        {
+            if (m_borderAttr != value)
+                m_ulaEvents?.AddBorderWrite(value);
+            m_borderAttr = value;
+        }
+    }
 
     public bool IsCrt
     {
         get => m_isCrt;
         set
         {
-            m_isCrt = value;
-            m_didPixelsChange = true;
-
-            if (m_isCrt)
+            // The presenter thread shades using these settings.
+            lock (Bitmap)
             {
-                m_scanlineMultiplier = new Vector3(0.7f);
-                m_phosphorShrink = 0.5f;
-            }
-            else
-            {
-                m_scanlineMultiplier = Vector3.One;
-                m_phosphorShrink = 1.0f;
-            }
+                m_isCrt = value;
+
+                if (m_isCrt)
+                {
+                    m_scanlineMultiplier = new Vector3(0.7f);
+                    m_phosphorShrink = 0.5f;
+                }
+                else
+                {
+                    m_scanlineMultiplier = Vector3.One;
+                    m_phosphorShrink = 1.0f;
+                }
 
-            m_brightness = 3.0f / (1.0f + 2.0f * m_phosphorShrink);
+                m_brightness = 3.0f / (1.0f + 2.0f * m_phosphorShrink);
 
-            for (var i = 0; i < m_screenBuffer.Length; i++)
-            {
-                for (var j = 0; j < m_screenBuffer[0].Length; j++)
-                    m_grain[i][j] = m_isCrt ? new Vector3((float)(m_random.NextDouble() * 10.0)) : Vector3.Zero;
+                for (var i = 0; i < ScreenHeight; i++)
+                {
+                    for (var j = 0; j < ScreenWidth; j++)
+                        m_grain[i][j] = m_isCrt ? (float)(m_random.NextDouble() * 10.0) : 0.0f;
+                }
+
+                m_crtShader = CreateCrtShader();
             }
 
             m_didPixelsChange = true;
+            m_presentRequested.Set();
+        }
+    }
+
+    /// <summary>
+    /// The number of horizontal bands the screen is split into, each shaded in parallel.
+    /// </summary>
+    /// <remarks>
+    /// Defaults to leaving one core free for the emulator.
+    /// </remarks>
+    public int BandCount
+    {
+        get => m_bandCount;
+        set
+        {
+            value = Math.Clamp(value, 1, ScreenHeight);
+            if (m_bandCount == value)
+                return;
+
+            lock (Bitmap)
+            {
+                m_bandCount = value;
+                m_bandRandoms = null;
+            }
         }
     }
 
@@ -137,7 +235,7 @@ public class ZxDisplay : ViewModelBase
             if (m_isPaused)
             {
                 // Keep updating the UI whilst paused.
-                m_updateTimer = PeriodicAction.Start(TimeSpan.FromSeconds(1.0 / 30.0), UpdateScreen);
+                m_updateTimer = PeriodicAction.Start(TimeSpan.FromSeconds(1.0 / 30.0), () => m_presentRequested.Set());
 
                 EmulationSpeed = 0.0;
             }
@@ -160,13 +258,54 @@ public class ZxDisplay : ViewModelBase
         private set => SetField(ref m_emulationSpeed, value);
     }
 
+    /// <summary>
+    /// The number of completed frames replaced by a newer one before they were presented.
+    /// </summary>
+    public long DroppedFrameCount => m_frames.DroppedCount;
+
     public event EventHandler Refreshed;
 
     public ZxDisplay()
     {
-        m_grain = new Vector3[m_screenBuffer.Length][];
-        for (var i = 0; i < m_screenBuffer.Length; i++)
-            m_grain[i] = new Vector3[m_screenBuffer[0].Length];
+        m_grain = new float[ScreenHeight][];
+        for (var i = 0; i < ScreenHeight; i++)
+            m_grain[i] = new float[ScreenWidth];
+
+        m_presenterThread = new Thread(PresentLoop) { Name = "Display Presenter", IsBackground = true };
+        m_presenterThread.Start();
+    }
+
+    public void Dispose()
+    {
+        m_isDisposed = true;
+        m_updateTimer?.Dispose();
+        m_presentRequested.Set();
+        m_presenterThread.Join();
+        m_presentRequested.Dispose();
+    }
+
+    private void PresentLoop()
+    {
+        while (true)
+        {
+            m_presentRequested.WaitOne();
+            if (m_isDisposed)
+                return;
+            UpdateScreen();
+        }
+    }
+
+    private CrtShader CreateCrtShader() =>
+        new CrtShader(Colors, m_grain, ScreenWidth, m_isCrt, m_brightness, m_crtSaturation, m_phosphorShrink, m_scanlineMultiplier);
+
+    /// <summary>
+    /// Time-stamp border and display writes made by the CPU, so changes made mid-line are
+    /// drawn at the pixel the beam had reached.
+    /// </summary>
+    public void SetCpu(CPU cpu)
+    {
+        m_ulaEvents = new UlaEventLog(() => cpu.TStatesSinceCpuStart, BorderAttr);
+        cpu.MainMemory.UlaEvents = m_ulaEvents;
     }
 
     private static (byte, byte) GetColorIndices(byte attr, bool invert = false)
@@ -186,7 +325,18 @@ public class ZxDisplay : ViewModelBase
     
     public void OnRenderScanline(object sender, (Memory memory, int scanline) args)
     {
-        var didReachScreenBottom = RenderScanlineIntoBuffer(args.memory, args.scanline, m_screenBuffer, BorderAttr, m_isFlashing, ref m_didPixelsChange);
+        bool didReachScreenBottom;
+        if (m_ulaEvents == null)
+        {
+            didReachScreenBottom = RenderScanlineIntoBuffer(args.memory, args.scanline, m_screenBuffer, BorderAttr, m_isFlashing, true, ref m_didPixelsChange);
+        }
+        else
+        {
+            // Draw the scanline just completed, now all its events are known.
+            if (args.scanline == 0)
+                return;
+            didReachScreenBottom = RenderScanlineWithEvents(args.memory, args.scanline - 1, m_ulaEvents, m_screenBuffer, m_isFlashing, ref m_didPixelsChange);
+        }
 
         // If scanline reached the bottom of the screen, update the UI.
         if (!didReachScreenBottom)
@@ -197,6 +347,7 @@ public class ZxDisplay : ViewModelBase
         {
             m_isFlashing = !m_isFlashing;
             m_flashFrameCount = 0;
+            MarkFlashingCellsDirty(args.memory);
             
             // Also update the EmulationSpeed.
             var now = DateTime.Now;
@@ -214,70 +365,209 @@ public class ZxDisplay : ViewModelBase
         }
 
         if (m_didPixelsChange)
-            UpdateScreen();
+            PublishFrame();
         m_didPixelsChange = false;
     }
 
+    /// <summary>
+    /// Hand a copy of the screen buffer to the presenter thread, without waiting for it.
+    /// </summary>
+    private void PublishFrame()
+    {
+        m_screenBuffer.CopyTo(m_frames.Back, 0);
+        m_frames.Publish();
+        m_presentRequested.Set();
+    }
+
+    internal static void MarkFlashingCellsDirty(Memory memory)
+    {
+        var attributes = memory.ScreenBank.Slice(ColorMapBase - ScreenBase, 768);
+        for (var cell = 0; cell < attributes.Length; cell++)
+        {
+            if ((attributes[cell] & 0x80) != 0)
+                memory.MarkDisplayCellDirty(cell);
+        }
+    }
+
     /// <summary>
     /// Returns true if the scanline has reached the bottom of the screen.
     /// </summary>
-    private static bool RenderScanlineIntoBuffer(Memory memory, int scanlineIndex, byte[][] screenBuffer, byte borderAttr, bool isFlashing, ref bool didPixelsChange)
+    /// <param name="isIncremental">Only draw the character cells which memory reports as changed since last drawn.</param>
+    internal static bool RenderScanlineIntoBuffer(Memory memory, int scanlineIndex, byte[] screenBuffer, byte borderAttr, bool isFlashing, bool isIncremental, ref bool didPixelsChange)
     {
-        var y = scanlineIndex - (48 - TopMargin);
-        if (y < 0 || y >= screenBuffer.Length)
+        var y = scanlineIndex - (FirstDisplayScanline - TopMargin);
+        if (y < 0 || y >= ScreenHeight)
         {
             // Off-screen(/vsync) area.
             return false;
         }
         
-        // Fill entire line with border color.
+        // Fill the border area of the line.
         var border = GetColorIndices(borderAttr).Item1;
-        if (screenBuffer[y][0] != border)
-        {
-            didPixelsChange = true;
-            Array.Fill(screenBuffer[y], border);
-        }
+        var row = screenBuffer.AsSpan(y * ScreenWidth, ScreenWidth);
+        var isBorderLine = y < TopMargin || y >= TopMargin + WritableHeight;
+        FillBorder(row, 0, ScreenWidth, border, isBorderLine, ref didPixelsChange);
 
-        // Set Y to the drawable screen coordinate.
-        y -= TopMargin;
-        if (y < 0 || y >= WritableHeight)
+        if (isBorderLine)
         {
             // In top or bottom border area - No screen content needed.
             return false;
         }
+
+        // Set Y to the drawable screen coordinate.
+        y -= TopMargin;
+        var dirtyColumns = isIncremental ? memory.TakeDirtyDisplayColumns(y) : uint.MaxValue;
+        if (dirtyColumns == 0)
+            return y == WritableHeight - 1;
         
         // Draw screen pixel content.
         var y76 = (byte)(y >> 6);
         var y210 = (byte)(y & 0x07);
         var y543 = (byte)((y >> 3) & 0x07);
-        var srcRowStart = (ushort)(0x4000 | (y76 << 11) | (y210 << 8) | (y543 << 5));
+        var srcRowStart = (y76 << 11) | (y210 << 8) | (y543 << 5);
+        var screen = memory.ScreenBank;
+        var attributeRowStart = ColorMapBase - ScreenBase + y / 8 * 32;
+        var attributeOffset = isFlashing ? 256 : 0;
 
-        var characterRow = y / 8;
+        // Each character cell is 8 pixel bytes, blended from its pen and paper using the bitmap byte.
+        var cells = MemoryMarshal.Cast<byte, ulong>(row.Slice(LeftMargin, WriteableWidth));
         for (var characterColumn = 0; characterColumn < 32; characterColumn++)
         {
-            // Get block of 8 horizontal pixels.
-            var screenByte = memory.Data[srcRowStart + characterColumn]; 
-
-            // Get the pen/paper color for this block.
-            var a = characterRow * 32 + characterColumn;
-            var attr = memory.Data[ColorMapBase + a];
-            var isFlashSet = (attr & 0x80) != 0;
-            var penAndPaper = GetColorIndices(attr, isFlashing && isFlashSet);
-
-            // Write indexed colors for the 8 pixel block.
-            var off = LeftMargin + characterColumn * 8;
-            for (var i = 7; i >= 0; i--, off++)
+            if ((dirtyColumns & 1u << characterColumn) == 0)
+                continue;
+
+            DrawCell(ref cells[characterColumn], screen[srcRowStart + characterColumn], screen[attributeRowStart + characterColumn] + attributeOffset, ref didPixelsChange);
+        }
+
+        return y == WritableHeight - 1;
+    }
+
+    /// <summary>
+    /// Draw a character cell's 8 pixels from its bitmap byte and attribute.
+    /// </summary>
+    /// <param name="attr">The attribute, plus 256 if flashing attributes are inverted.</param>
+    private static void DrawCell(ref ulong cell, byte bitmapByte, int attr, ref bool didPixelsChange)
+    {
+        var mask = PixelMasks[bitmapByte];
+        var pixels = PenPixels[attr] & mask | PaperPixels[attr] & ~mask;
+        if (cell == pixels)
+            return;
+        didPixelsChange = true;
+        cell = pixels;
+    }
+
+    /// <summary>
+    /// Fill the border area of a screen buffer row between two columns.
+    /// </summary>
+    private static void FillBorder(Span<byte> row, int start, int end, byte color, bool isBorderLine, ref bool didPixelsChange)
+    {
+        if (isBorderLine)
+        {
+            FillPixels(row[start..end], color, ref didPixelsChange);
+            return;
+        }
+
+        if (start < LeftMargin)
+            FillPixels(row[start..Math.Min(end, LeftMargin)], color, ref didPixelsChange);
+        if (end > LeftMargin + WriteableWidth)
+            FillPixels(row[Math.Max(start, LeftMargin + WriteableWidth)..end], color, ref didPixelsChange);
+    }
+
+    private static void FillPixels(Span<byte> pixels, byte color, ref bool didPixelsChange)
+    {
+        if (pixels.IndexOfAnyExcept(color) < 0)
+            return;
+        pixels.Fill(color);
+        didPixelsChange = true;
+    }
+
+    /// <summary>
+    /// Draw a scanline which has been completed, placing any border and display changes logged
+    /// during it at the pixel the beam had reached.
+    /// </summary>
+    /// <remarks>
+    /// The beam displays two pixels per T-state, from the left border 16 T-states before the scanline
+    /// starts, with each character cell fetched as the beam reaches it.
+    /// A scanline without events is drawn exactly as <see cref="RenderScanlineIntoBuffer"/> does.
+    /// </remarks>
+    /// <returns>True if the scanline is the bottom of the screen.</returns>
+    internal static bool RenderScanlineWithEvents(Memory memory, int scanlineIndex, UlaEventLog events, byte[] screenBuffer, bool isFlashing, ref bool didPixelsChange)
+    {
+        var lineStart = events.GetScanlineStartTStates(scanlineIndex);
+        events.DiscardBefore(lineStart - LeftMargin / 2);
+
+        var didReachScreenBottom = RenderScanlineIntoBuffer(memory, scanlineIndex, screenBuffer, events.Border, isFlashing, true, ref didPixelsChange);
+        var y = scanlineIndex - (FirstDisplayScanline - TopMargin);
+        if (events.Count == 0 || y < 0 || y >= ScreenHeight)
+            return didReachScreenBottom;
+
+        // Redraw the border, changing color at each border write.
+        var row = screenBuffer.AsSpan(y * ScreenWidth, ScreenWidth);
+        var isBorderLine = y < TopMargin || y >= TopMargin + WritableHeight;
+        var border = GetColorIndices(events.Border).Item1;
+        var x = 0;
+        for (var i = 0; i < events.Count && x < ScreenWidth; i++)
+        {
+            var (tStates, offset, value) = events[i];
+            if (offset != UlaEventLog.BorderOffset)
+                continue;
+            var changeX = (int)Math.Clamp((tStates - lineStart) * 2 + LeftMargin, 0, ScreenWidth);
+            FillBorder(row, x, changeX, border, isBorderLine, ref didPixelsChange);
+            border = GetColorIndices(value).Item1;
+            x = changeX;
+        }
+
+        FillBorder(row, x, ScreenWidth, border, isBorderLine, ref didPixelsChange);
+        if (isBorderLine)
+            return didReachScreenBottom;
+
+        // Cells written after the beam fetched them are shown with their previous value.
+        y -= TopMargin;
+        var srcRowStart = (y >> 6) << 11 | (y & 0x07) << 8 | (y >> 3 & 0x07) << 5;
+        var attributeRowStart = ColorMapBase - ScreenBase + y / 8 * 32;
+        Span<int> fetchedBitmap = stackalloc int[32];
+        Span<int> fetchedAttributes = stackalloc int[32];
+        fetchedBitmap.Fill(-1);
+        fetchedAttributes.Fill(-1);
+        var isRedrawNeeded = false;
+        for (var i = 0; i < events.Count; i++)
+        {
+            var (tStates, offset, value) = events[i];
+            var fetched = fetchedBitmap;
+            var column = offset - srcRowStart;
+            if ((uint)column >= 32)
             {
-                var isSet = (screenByte & (1 << i)) != 0;
-                var index = isSet ? penAndPaper.Item1 : penAndPaper.Item2;
-                if (screenBuffer[y + TopMargin][off] == index)
+                fetched = fetchedAttributes;
+                column = offset - attributeRowStart;
+                if ((uint)column >= 32)
                     continue;
-                didPixelsChange = true;
-                screenBuffer[y + TopMargin][off] = index;
             }
+
+            if (tStates <= lineStart + column * 4 || fetched[column] >= 0)
+                continue;
+            fetched[column] = value;
+            isRedrawNeeded = true;
         }
 
-        return y == WritableHeight - 1;
+        if (!isRedrawNeeded)
+            return didReachScreenBottom;
+
+        var screen = memory.ScreenBank;
+        var attributeOffset = isFlashing ? 256 : 0;
+        var cells = MemoryMarshal.Cast<byte, ulong>(row.Slice(LeftMargin, WriteableWidth));
+        for (var column = 0; column < 32; column++)
+        {
+            if (fetchedBitmap[column] < 0 && fetchedAttributes[column] < 0)
+                continue;
+            var bitmapByte = fetchedBitmap[column] >= 0 ? (byte)fetchedBitmap[column] : screen[srcRowStart + column];
+            var attr = fetchedAttributes[column] >= 0 ? fetchedAttributes[column] : screen[attributeRowStart + column];
+            DrawCell(ref cells[column], bitmapByte, attr + attributeOffset, ref didPixelsChange);
+
+            // Ensure the cell's current content is drawn next frame.
+            memory.MarkDisplayCellDirty(y / 8 * 32 + column);
+        }
+
+        return didReachScreenBottom;
     }
 
     /// <summary>
@@ -291,7 +581,7 @@ public class ZxDisplay : ViewModelBase
         for (var i = 0; i < scanlineCount; i++)
         {
             var unused = false;
-            RenderScanlineIntoBuffer(theMemory, i, screenBuffer, borderAttr, false, ref unused);
+            RenderScanlineIntoBuffer(theMemory, i, screenBuffer, borderAttr, false, false, ref unused);
         }
 
         // Convert buffer to an image.
@@ -301,11 +591,13 @@ public class ZxDisplay : ViewModelBase
         {
             var framePtr = (byte*)frameBuffer.Address;
             var ptr = new Span<byte>(framePtr, frameBuffer.RowBytes * frameBuffer.Size.Height);
-            for (var y = 0; y < screenBuffer.Length; y++)
+            var packedColors = Colors.Select(o => FrameBuffer.Pack(o)).ToArray();
+            for (var y = 0; y < ScreenHeight; y++)
             {
-                var row = screenBuffer[y];
-                for (var x = 0; x < screenBuffer[0].Length; x++)
-                    FrameBuffer.SetPixel(ptr, frameBuffer.RowBytes, x, y, Colors[row[x]]);
+                var row = screenBuffer.AsSpan(y * ScreenWidth, ScreenWidth);
+                var pixels = MemoryMarshal.Cast<byte, uint>(ptr.Slice(y * frameBuffer.RowBytes, ScreenWidth * 4));
+                for (var x = 0; x < ScreenWidth; x++)
+                    pixels[x] = packedColors[row[x]];
             }
         }
 
@@ -313,108 +605,163 @@ public class ZxDisplay : ViewModelBase
     }
 
     /// <summary>
-    /// Render the Speccy screen memory into a bitmap for display.
+    /// Render the most recently published frame into the bitmap for display.
     /// </summary>
-    private unsafe void UpdateScreen()
+    internal unsafe void UpdateScreen()
     {
         lock (Bitmap)
         {
+            m_frames.TryTakeLatest();
+            var screenBuffer = m_frames.Front;
             using (var frameBuffer = Bitmap.Lock())
             {
                 var framerBufferStride = frameBuffer.RowBytes;
-                var w = m_screenBuffer[0].Length;
-                var h = m_screenBuffer.Length;
-                var ptr = new Span<byte>((byte*)frameBuffer.Address, frameBuffer.RowBytes * frameBuffer.Size.Height);
-
-                var phosphorR = new Vector3(1.0f, m_phosphorShrink, m_phosphorShrink);
-                var phosphorG = new Vector3(m_phosphorShrink, 1.0f, m_phosphorShrink);
-                var phosphorB = new Vector3(m_phosphorShrink, m_phosphorShrink, 1.0f);
-
-                // Software pixel shader.
-                var iTime = DateTime.Now.TimeOfDay.TotalSeconds;
-                var dy = 0;
-                if (IsPaused)
+                const int w = ScreenWidth;
+                const int h = ScreenHeight;
+                var address = frameBuffer.Address;
+                var length = frameBuffer.RowBytes * frameBuffer.Size.Height;
+
+                if (!IsPaused || !IsCrt)
                 {
-                    // Vertical screen wobble.
-                    dy = (int)(m_random.NextDouble() * 1.5);
+                    var shader = m_crtShader ??= CreateCrtShader();
+                    ForEachBand(h, (_, firstRow, endRow) =>
+                    {
+                        var ptr = new Span<byte>((byte*)address, length);
+                        for (var y = firstRow; y < endRow; y++)
+                            shader.RenderRow(screenBuffer.AsSpan(y * w, w), y, ptr, framerBufferStride);
+                    });
                 }
+                else
+                {
+                    UpdatePausedScreen(screenBuffer, address, length, framerBufferStride, w, h);
+                }
+            }
+
+            Refreshed?.Invoke(this, EventArgs.Empty);
+        }
+    }
+
+    /// <summary>
+    /// Split the rows into <see cref="BandCount"/> bands, rendering them in parallel.
+    /// </summary>
+    /// <param name="renderBand">Called with the band index, its first row, and the row after its last.</param>
+    private void ForEachBand(int rowCount, Action<int, int, int> renderBand)
+    {
+        var bandCount = Math.Min(m_bandCount, rowCount);
+        if (bandCount == 1)
+        {
+            renderBand(0, 0, rowCount);
+            return;
+        }
+
+        Parallel.For(0, bandCount, band => renderBand(band, band * rowCount / bandCount, (band + 1) * rowCount / bandCount));
+    }
+
+    /// <summary>
+    /// The CRT shader, with the animated pause effects.
+    /// </summary>
+    private unsafe void UpdatePausedScreen(byte[] screenBuffer, nint address, int length, int framerBufferStride, int w, int h)
+    {
+        var phosphorR = new Vector3(1.0f, m_phosphorShrink, m_phosphorShrink);
+        var phosphorG = new Vector3(m_phosphorShrink, 1.0f, m_phosphorShrink);
+        var phosphorB = new Vector3(m_phosphorShrink, m_phosphorShrink, 1.0f);
+
+        // Software pixel shader.
+        var iTime = DateTime.Now.TimeOfDay.TotalSeconds;
+
+        // Vertical screen wobble.
+        var dy = (int)(m_random.NextDouble() * 1.5);
 
-                for (var y = 0; y < h; y++)
+        m_bandRandoms ??= Enumerable.Range(0, m_bandCount).Select(o => new Random(o + 1)).ToArray();
+        var bandRandoms = m_bandRandoms;
+        ForEachBand(h, (band, firstRow, endRow) =>
+        {
+            var ptr = new Span<byte>((byte*)address, length);
+            var random = bandRandoms[band];
+            for (var y = firstRow; y < endRow; y++)
+            {
+                var uvY = (double)y / h;
+
+                // White pulse moving down the screen.
+                var pulseY = ((iTime % 8.0) / 8.0) * h * 2.5;
+                var pulseHeight = 20.0;
+                var distFromPulse = (Math.Abs(y - pulseY) / pulseHeight).Clamp(0.0, 1.0);
+                var dx = (int)(-12.0 * random.NextDouble() * Math.Cos(distFromPulse * Math.PI / 2.0));
+                dx = (int)(dx + (random.NextDouble() * 2.2 - 1.1));
+
+                for (var x = 0; x < w; x++)
                 {
-                    var row = m_screenBuffer[y];
-                    var uvY = (double)y / h;
+                    var uvX = (double)x / w;
+                    var vignette = (float)MathHelper.Lerp(0.7, 1.0, Math.Sqrt(64.0 * uvX * uvY * (1.0 - uvX) * (1.0 - uvY)));
 
-                    var dx = 0;
-                    var distFromPulse = 0.0;
-                    if (IsPaused)
-                    {
-                        // White pulse moving down the screen.
-                        var pulseY = ((iTime % 8.0) / 8.0) * h * 2.5;
-                        var pulseHeight = 20.0;
-                        distFromPulse = (Math.Abs(y - pulseY) / pulseHeight).Clamp(0.0, 1.0);
-                        dx = (int)(-12.0 * m_random.NextDouble() * Math.Cos(distFromPulse * Math.PI / 2.0));
-                        dx = (int)(dx + (m_random.NextDouble() * 2.2 - 1.1));
-                    }
+                    // Screen displacement.
+                    var lx = Math.Max(0, x + dx) % w;
+                    var ly = Math.Max(0, y + dy) % h;
+                    var origColor = Colors[screenBuffer[ly * w + lx]];
 
-                    for (var x = 0; x < w; x++)
+                    // Desaturate color.
+                    var lumin = Vector3.Dot(origColor, new Vector3(0.2f, 0.7f, 0.1f));
+                    origColor = Vector3.Lerp(origColor, new Vector3(lumin), 0.9f);
+
+                    // Add noise.
+                    origColor += new Vector3((float)((random.NextDouble() - 0.5) * 50.0));
+
+                    // Add extra noise to the white pulse.
+                    if (random.NextDouble() * (1.0 - distFromPulse) > 0.4)
+                        origColor += new Vector3((float)(92.0 * random.NextDouble()));
+
+                    // PAUSE.
+                    var px = x - 20;
+                    var py = ly - 20;
+                    if (px >= 0 && px < 38 && py >= 0 && py < 12)
                     {
-                        var origColor = Colors[row[x]];
-
-                        if (IsCrt)
-                        {
-                            var uvX = (double)x / w;
-                            var vignette = (float)MathHelper.Lerp(0.7, 1.0, Math.Sqrt(64.0 * uvX * uvY * (1.0 - uvX) * (1.0 - uvY)));
-
-                            if (IsPaused)
-                            {
-                                // Screen displacement.
-                                var lx = Math.Max(0, x + dx) % w;
-                                var ly = Math.Max(0, y + dy) % h;
-                                origColor = Colors[m_screenBuffer[ly][lx]];
-
-                                // Desaturate color.
-                                var lumin = Vector3.Dot(origColor, new Vector3(0.2f, 0.7f, 0.1f));
-                                origColor = Vector3.Lerp(origColor, new Vector3(lumin), 0.9f);
-
-                                // Add noise.
-                                origColor += new Vector3((float)((m_random.NextDouble() - 0.5) * 50.0));
-
-                                // Add extra noise to the white pulse.
-                                if (m_random.NextDouble() * (1.0 - distFromPulse) > 0.4)
-                                    origColor += new Vector3((float)(92.0 * m_random.NextDouble()));
-
-                                // PAUSE.
-                                var px = x - 20;
-                                var py = ly - 20;
-                                if (px >= 0 && px < 38 && py >= 0 && py < 12)
-                                {
-                                    if (m_pauseBitmap[py * 38 + px])
-                                        origColor += new Vector3(200);
-                                }
-                            }
-
-                            origColor += m_grain[y][x];
-                            origColor *= m_brightness * vignette * m_crtSaturation;
-                        }
-
-                        var xx = x * 3;
-                        var yy = y * 4;
-                        FrameBuffer.SetPixelV4(ptr, framerBufferStride, xx, yy, origColor * phosphorR, m_scanlineMultiplier);
-                        FrameBuffer.SetPixelV4(ptr, framerBufferStride, xx + 1, yy, origColor * phosphorG, m_scanlineMultiplier);
-                        FrameBuffer.SetPixelV4(ptr, framerBufferStride, xx + 2, yy, origColor * phosphorB, m_scanlineMultiplier);
+                        if (m_pauseBitmap[py * 38 + px])
+                            origColor += new Vector3(200);
                     }
+
+                    origColor += new Vector3(m_grain[y][x]);
+                    origColor *= m_brightness * vignette * m_crtSaturation;
+
+                    var xx = x * 3;
+                    var yy = y * 4;
+                    FrameBuffer.SetPixelV4(ptr, framerBufferStride, xx, yy, origColor * phosphorR, m_scanlineMultiplier);
+                    FrameBuffer.SetPixelV4(ptr, framerBufferStride, xx + 1, yy, origColor * phosphorG, m_scanlineMultiplier);
+                    FrameBuffer.SetPixelV4(ptr, framerBufferStride, xx + 2, yy, origColor * phosphorB, m_scanlineMultiplier);
                 }
             }
-
-            Refreshed?.Invoke(this, EventArgs.Empty);
-        }
+        });
     }
 
     /// <summary>
-    /// Buffer of pixels, each byte a palette index.
+    /// Buffer of pixels, each byte a palette index, in rows of <see cref="ScreenWidth"/>.
     /// </summary>
-    private static byte[][] CreateScreenBuffer() =>
-        Enumerable.Range(0, TopMargin + WritableHeight + BottomMargin).Select(_ => new byte[LeftMargin + WriteableWidth + RightMargin]).ToArray();
+    internal static byte[] CreateScreenBuffer() =>
+        new byte[ScreenWidth * ScreenHeight];
+
+    private static ulong[] CreatePixelMasks()
+    {
+        var masks = new ulong[256];
+        for (var b = 0; b < 256; b++)
+        {
+            for (var i = 0; i < 8; i++)
+            {
+                if ((b & 0x80 >> i) != 0)
+                    masks[b] |= 0xFFUL << (i * 8);
+            }
+        }
+
+        return masks;
+    }
+
+    private static ulong[] CreateAttributePixels(bool isPen) =>
+        Enumerable.Range(0, 512)
+            .Select(i =>
+            {
+                var attr = (byte)i;
+                var (pen, paper) = GetColorIndices(attr, i >= 256 && (attr & 0x80) != 0);
+                return (isPen ? pen : paper) * 0x0101010101010101UL;
+            })
+            .ToArray();
 
     /// <summary>
     /// Create a bitmap suitable for use in the UI.
@@ -423,5 +770,5 @@ public class ZxDisplay : ViewModelBase
     /// The expanded bitmap allows for scanlines and RGB phosphor dots to be added.
     /// </remarks>
     private static WriteableBitmap CreateWriteableBitmap(bool expandForFx) =>
-        new WriteableBitmap(new PixelSize((LeftMargin + WriteableWidth + RightMargin) * (expandForFx ? 3 : 1), (TopMargin + WritableHeight + BottomMargin) * (expandForFx ? 4 : 1)), new Vector(96, 96), PixelFormat.Rgba8888);
+        new WriteableBitmap(new PixelSize(ScreenWidth * (expandForFx ? 3 : 1), ScreenHeight * (expandForFx ? 4 : 1)), new Vector(96, 96), PixelFormat.Rgba8888);
 }
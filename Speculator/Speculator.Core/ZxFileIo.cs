@@ -32,11 +32,19 @@ public class ZxFileIo
         Game
     }
 
+    /// <summary>
+    /// The size of a 48K .sna file (A 27 byte header, then 48K of RAM).
+    /// </summary>
+    private const int Sna48KLength = 49179;
+
     public static string[] OpenFilters { get; } = { "*.z80", "*.bin", "*.scr", "*.sna", "*.zip", "*.tap" };
     public static string[] SaveFilters { get; } = { "*.sna" };
 
     public event EventHandler<RomType> RomLoaded;
 
+    /// <param name="cpu">The CPU (and memory) to load into.</param>
+    /// <param name="zxDisplay">Optional display, used to persist the border color. (Null when running headless.)</param>
+    /// <param name="tapeLoader">Receives any .tap files.</param>
     public ZxFileIo(CPU cpu, ZxDisplay zxDisplay, TapeLoader tapeLoader)
     {
         m_cpu = cpu;
@@ -81,7 +89,8 @@ public class ZxFileIo
                 return;
             case ".sna":
                 LoadSna(fileInfo, m_cpu, out var borderAttr);
-                m_zxDisplay.BorderAttr = borderAttr;
+                if (m_zxDisplay != null)
+                    m_zxDisplay.BorderAttr = borderAttr;
                 return;
             case ".scr":
                 LoadScr(fileInfo);
@@ -161,48 +170,86 @@ public class ZxFileIo
             }
 
             Debug.Assert(data.Count <= 48 * 1024);
+            Use48KMemoryMap(m_cpu.MainMemory);
             m_cpu.MainMemory.LoadData(data, 0x4000);
             return;
         }
         
         // Read the length of the extended header (2 bytes)
         int extendedHeaderLength = ReadZxWord(stream);
-        if (extendedHeaderLength != 23) 
+        if (extendedHeaderLength is not (23 or 54 or 55)) 
         {
             Logger.Instance.Warn("Unsupported or invalid Z80 file format.");
             return;
         }
         
-        // Read the extended header for version 2 files.
+        // Read the extended header for version 2 (23 bytes) or version 3 files.
         var extendedHeader = new byte[extendedHeaderLength];
         stream.Read(extendedHeader, 0, extendedHeaderLength);
 
         m_cpu.TheRegisters.PC = (ushort)((extendedHeader[1] << 8) + extendedHeader[0]);
-        if (!ReportHardwareMode(extendedHeader[2]))
+        var is128K = GetIs128K(extendedHeader[2], extendedHeaderLength == 23);
+        if (is128K == null)
             return; // Unsupported Speccy.
+        if (is128K == true && !m_cpu.MainMemory.Is128K)
+        {
+            Logger.Instance.Warn("128K snapshots require a 128K ROM.");
+            return;
+        }
+
+        if (is128K == true)
+            m_cpu.MainMemory.SetPagingState(extendedHeader[3]);
+        else
+            Use48KMemoryMap(m_cpu.MainMemory);
         
-        // Read blocks.
+        // Read blocks, each holding one 16K page.
         while (stream.Position < stream.Length)
         {
             var blockSize = ReadZxWord(stream);
             var pageNumber = stream.ReadByte();
 
-            var data = ReadBytes(stream, blockSize);
-            Decompress(data);
+            List<byte> data;
+            if (blockSize == 0xFFFF)
+            {
+                // Version 3 stores incompressible pages as-is.
+                data = ReadBytes(stream, Memory.PageSize);
+            }
+            else
+            {
+                data = ReadBytes(stream, blockSize);
+                Decompress(data);
+            }
+
+            if (is128K == true)
+            {
+                // Pages 3-10 hold RAM banks 0-7.
+                if (pageNumber is >= 3 and <= 10)
+                    m_cpu.MainMemory.LoadBank(pageNumber - 3, data);
+                continue;
+            }
 
             switch (pageNumber)
             {
                 case 0: m_cpu.MainMemory.LoadData(data, 0x0000);
                     break;
-                case 4: m_cpu.MainMemory.LoadData(data, 0x8000);
+                case 4: m_cpu.MainMemory.LoadBank(2, data);
                     break;
-                case 5: m_cpu.MainMemory.LoadData(data, 0xC000);
+                case 5: m_cpu.MainMemory.LoadBank(0, data);
                     break;
-                case 8: m_cpu.MainMemory.LoadData(data, 0x4000);
+                case 8: m_cpu.MainMemory.LoadBank(5, data);
                     break;
             }
         }
     }
+
+    /// <summary>
+    /// 48K software running on a 128K machine sees the 48K ROM, with paging locked.
+    /// </summary>
+    private static void Use48KMemoryMap(Memory memory)
+    {
+        if (memory.Is128K)
+            memory.SetPagingState(0x30);
+    }
     
     private static List<byte> ReadBytes(Stream stream, int byteCount)
     {
@@ -235,24 +282,29 @@ public class ZxFileIo
         }
     }
 
-    private static bool ReportHardwareMode(int hardwareMode)
+    /// <returns>Whether the .z80 hardware mode is a 128K machine, or null if it is not supported.</returns>
+    private static bool? GetIs128K(int hardwareMode, bool isVersion2)
     {
-        var modeDescription = hardwareMode switch
+        // Version 3 added mode 3 (48K + M.G.T.), moving the 128K modes up one.
+        if (isVersion2 && hardwareMode >= 3)
+            hardwareMode++;
+
+        var (modeDescription, is128K) = hardwareMode switch
         {
-            0 => "48K Spectrum",
-            1 => "48K Spectrum + Interface 1",
-            2 => "SamRam",
-            3 => "128K Spectrum",
-            4 => "128K Spectrum + Interface 1",
-            _ => $"Unknown hardware mode: {hardwareMode}"
+            0 => ("48K Spectrum", false),
+            1 => ("48K Spectrum + Interface 1", false),
+            2 => ("SamRam", (bool?)null),
+            3 => ("48K Spectrum + M.G.T.", false),
+            4 => ("128K Spectrum", true),
+            5 => ("128K Spectrum + Interface 1", true),
+            6 => ("128K Spectrum + M.G.T.", true),
+            12 => ("Spectrum +2", true),
+            _ => ($"Unknown hardware mode: {hardwareMode}", null)
         };
 
-        var isSupported = hardwareMode <= 1;
-        if (isSupported)
-            return true;
-        
-        Logger.Instance.Warn($"Unsupported model: {modeDescription}");
-        return false;
+        if (is128K == null)
+            Logger.Instance.Warn($"Unsupported model: {modeDescription}");
+        return is128K;
     }
 
     private void LoadScr(FileInfo file) =>
@@ -293,13 +345,40 @@ public class ZxFileIo
             cpu.TheRegisters.SP = ReadZxWord(stream);
             cpu.TheRegisters.IM = (byte)stream.ReadByte();
             borderAttr = (byte)stream.ReadByte();
-            for (var i = 16384; i <= 65535; i++)
-                cpu.MainMemory.Poke((ushort)i, (byte)stream.ReadByte());
-        }
 
-        cpu.RETN();
+            // 48K snapshots hold 0x4000-0xFFFF, with PC on the stack.
+            var memory = cpu.MainMemory;
+            if (stream.Length == Sna48KLength)
+            {
+                Use48KMemoryMap(memory);
+                for (var i = 16384; i <= 65535; i++)
+                    memory.Poke((ushort)i, (byte)stream.ReadByte());
+                cpu.RETN();
+                return;
+            }
+
+            // 128K snapshots hold banks 5, 2 and the paged bank, then PC, port 0x7FFD and the remaining banks.
+            var pagedBanks = Enumerable.Range(0, 3).Select(_ => ReadBytes(stream, Memory.PageSize)).ToArray();
+            cpu.TheRegisters.PC = ReadZxWord(stream);
+            var pagingState = (byte)stream.ReadByte();
+            stream.ReadByte(); // TR-DOS ROM paged.
+
+            var pagedBank = pagingState & 0x07;
+            memory.SetPagingState(pagingState);
+            memory.LoadBank(5, pagedBanks[0]);
+            memory.LoadBank(2, pagedBanks[1]);
+            memory.LoadBank(pagedBank, pagedBanks[2]);
+            foreach (var bank in GetUnpagedSnaBanks(pagedBank))
+                memory.LoadBank(bank, ReadBytes(stream, Memory.PageSize));
+        }
     }
 
+    /// <summary>
+    /// The RAM banks stored after the header of a 128K .sna file.
+    /// </summary>
+    private static IEnumerable<int> GetUnpagedSnaBanks(int pagedBank) =>
+        Enumerable.Range(0, 8).Where(o => o is not (5 or 2) && o != pagedBank);
+
     private static ushort ReadZxWord(Stream stream) =>
         (ushort)(stream.ReadByte() + (stream.ReadByte() << 8));
 
@@ -320,10 +399,16 @@ public class ZxFileIo
     
     public void WriteSnaToStream(Stream stream)
     {
+        // 48K snapshots store PC on the stack.
+        var memory = m_cpu.MainMemory;
+        var isPCPushed = !memory.Is128K;
         try
         {
-            m_cpu.TheRegisters.SP -= 2;
-            m_cpu.MainMemory.Poke(m_cpu.TheRegisters.SP, m_cpu.TheRegisters.PC);
+            if (isPCPushed)
+            {
+                m_cpu.TheRegisters.SP -= 2;
+                memory.Poke(m_cpu.TheRegisters.SP, m_cpu.TheRegisters.PC);
+            }
 
             stream.WriteByte(m_cpu.TheRegisters.I);
             WriteSnaWord(stream, m_cpu.TheRegisters.Alt.HL);
@@ -340,13 +425,23 @@ public class ZxFileIo
             WriteSnaWord(stream, m_cpu.TheRegisters.Main.AF);
             WriteSnaWord(stream, m_cpu.TheRegisters.SP);
             stream.WriteByte(m_cpu.TheRegisters.IM);
-            stream.WriteByte(m_zxDisplay.BorderAttr);
+            stream.WriteByte(m_zxDisplay?.BorderAttr ?? 0x07);
             for (var i = 16384; i <= 65535; i++)
-                stream.WriteByte(m_cpu.MainMemory.Peek((ushort)i));
+                stream.WriteByte(memory.Peek((ushort)i));
+
+            if (memory.Is128K)
+            {
+                WriteSnaWord(stream, m_cpu.TheRegisters.PC);
+                stream.WriteByte(memory.PagingState);
+                stream.WriteByte(0x00); // TR-DOS ROM not paged.
+                foreach (var bank in GetUnpagedSnaBanks(memory.PagingState & 0x07))
+                    stream.Write(memory.GetBank(bank));
+            }
         }
         finally
         {
-            m_cpu.TheRegisters.SP += 2;
+            if (isPCPushed)
+                m_cpu.TheRegisters.SP += 2;
         }
     }
 
@@ -25,6 +25,7 @@ public class ZxPortHandler : ViewModelBase, IPortHandler, IDisposable
     private readonly SoundHandler m_soundHandler;
     private readonly ZxDisplay m_theDisplay;
     private readonly TapeLoader m_tapeLoader;
+    private readonly Memory m_memory;
     private readonly List<KeyCode> m_realKeysPressed = new List<KeyCode>();
     private readonly List<(KeyCode[] Pc, KeyCode[] Speccy)> m_pcToSpectrumKeyMap;
     private readonly List<(KeyCode[] Pc, KeyCode[] Speccy)> m_pcToSpectrumKeyMapWithJoystick;
@@ -60,11 +61,12 @@ public class ZxPortHandler : ViewModelBase, IPortHandler, IDisposable
         set => SetField(ref m_emulateCursorJoystick, value);
     }
 
-    public ZxPortHandler(SoundHandler soundHandler, ZxDisplay theDisplay, TapeLoader tapeLoader)
+    public ZxPortHandler(SoundHandler soundHandler, ZxDisplay theDisplay, TapeLoader tapeLoader, Memory memory)
     {
         m_soundHandler = soundHandler;
         m_theDisplay = theDisplay;
         m_tapeLoader = tapeLoader;
+        m_memory = memory;
 
         // Map PC key to a sequence of emulated Speccy keys.
         m_pcToSpectrumKeyMap = new List<(KeyCode[], KeyCode[])>();
@@ -237,10 +239,14 @@ public class ZxPortHandler : ViewModelBase, IPortHandler, IDisposable
         }
     }
 
-    public void Out(byte port, byte b)
+    public void Out(ushort portAddress, byte b)
     {
-        // We only care about writes to port 0xFE.
-        if (port != 0xFE)
+        // 128K memory paging (Decoded from A15 and A1 being low).
+        if ((portAddress & 0x8002) == 0)
+            m_memory.WritePagingPort(b);
+
+        // Otherwise we only care about writes to port 0xFE.
+        if ((portAddress & 0x00FF) != 0xFE)
             return;
         
         // Sounds.
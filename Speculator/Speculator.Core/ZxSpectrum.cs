@@ -46,11 +46,14 @@ public class ZxSpectrum : ViewModelBase, IDisposable
     public ZxSpectrum(ZxDisplay display)
     {
         TheDisplay = display;
-        PortHandler = new ZxPortHandler(SoundHandler, TheDisplay, TheTapeLoader);
-        TheCpu = new CPU(new Memory(), PortHandler, SoundHandler);
+        var memory = new Memory();
+        PortHandler = new ZxPortHandler(SoundHandler, TheDisplay, TheTapeLoader, memory);
+        TheCpu = new CPU(memory, PortHandler, SoundHandler);
         TheTapeLoader.SetCpu(TheCpu);
+        SoundHandler.SetCpu(TheCpu);
         TheDebugger = new Debugger.Debugger(TheCpu);
 
+        TheDisplay.SetCpu(TheCpu);
         TheCpu.RenderScanline += TheDisplay.OnRenderScanline;
 
         TheDebugger.IsSteppingChanged += (_, _) =>
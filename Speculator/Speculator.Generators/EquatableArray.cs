@@ -0,0 +1,48 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Collections.Immutable;
+using System.Linq;
+
+namespace Speculator.Generators;
+
+/// <summary>
+/// An immutable array compared by value, so the incremental generator can tell when its inputs are unchanged.
+/// </summary>
+internal readonly struct EquatableArray<T> : IEquatable<EquatableArray<T>>, IEnumerable<T> where T : IEquatable<T>
+{
+    private readonly ImmutableArray<T> m_items;
+
+    public EquatableArray(ImmutableArray<T> items)
+    {
+        m_items = items;
+    }
+
+    public int Count => m_items.IsDefault ? 0 : m_items.Length;
+
+    public bool Equals(EquatableArray<T> other) =>
+        this.SequenceEqual(other);
+
+    public override bool Equals(object obj) =>
+        obj is EquatableArray<T> other && Equals(other);
+
+    public override int GetHashCode() =>
+        this.Aggregate(Count, (hash, item) => hash * 31 + (item?.GetHashCode() ?? 0));
+
+    public IEnumerator<T> GetEnumerator() =>
+        ((IEnumerable<T>)(m_items.IsDefault ? ImmutableArray<T>.Empty : m_items)).GetEnumerator();
+
+    IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+}
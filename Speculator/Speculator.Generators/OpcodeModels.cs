@@ -0,0 +1,36 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using Microsoft.CodeAnalysis;
+using Microsoft.CodeAnalysis.Text;
+
+namespace Speculator.Generators;
+
+/// <summary>
+/// An entry in the Z80 instruction list, as in <c>new(InstructionID.LD_A_n, "LD A,n", "3E n", 7)</c>.
+/// </summary>
+internal sealed record InstructionEntry(string Id, string Mnemonic, string HexTemplate, int TStates, LocationInfo Location);
+
+/// <summary>
+/// The signature of a CPU method, which might implement an instruction.
+/// </summary>
+internal sealed record HandlerMethod(string Name, string ReturnType, EquatableArray<HandlerParameter> Parameters);
+
+internal sealed record HandlerParameter(string Type, string Name);
+
+/// <summary>
+/// A source location, held without the syntax tree so it can be compared between runs.
+/// </summary>
+internal sealed record LocationInfo(string FilePath, TextSpan Span, LinePositionSpan LineSpan)
+{
+    public Location ToLocation() => Location.Create(FilePath, Span, LineSpan);
+}
@@ -0,0 +1,246 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using System;
+using System.Collections.Generic;
+using System.Collections.Immutable;
+using System.Globalization;
+using System.Linq;
+using System.Text;
+using Microsoft.CodeAnalysis;
+using Microsoft.CodeAnalysis.CSharp;
+using Microsoft.CodeAnalysis.CSharp.Syntax;
+using Microsoft.CodeAnalysis.Text;
+
+namespace Speculator.Generators;
+
+/// <summary>
+/// Generates the CPU's opcode dispatch tables from the instruction list in Z80Instructions.InitList().
+/// </summary>
+/// <remarks>
+/// Each opcode page (Main, CB, ED, DD, FD, DD CB and FD CB) becomes a table of 256 handlers.
+/// A handler takes the instruction's operands from its DecodedInstruction, calls the CPU method
+/// named after the instruction ID, and returns the T-state count.
+/// Method parameters are bound by name:
+///   n   - The immediate byte.
+///   nn  - The immediate word.
+///   d   - The displacement byte.
+///   bit - The bit number encoded in a CB, DD CB or FD CB opcode.
+/// A void method takes the listed T-states, whereas an int method returns its own (For conditional timing).
+/// A byte method returns the value it wrote, which undocumented DD CB/FD CB opcodes also copy to a register.
+/// Where an opcode is listed more than once, the first definition wins (As in Z80Instructions).
+/// </remarks>
+[Generator]
+public sealed class OpcodeTableGenerator : IIncrementalGenerator
+{
+    private static readonly string[] PageNames = { "Main", "Cb", "Ed", "Dd", "Fd", "DdCb", "FdCb" };
+    private static readonly string[] IndexedBitRegisters = { "B", "C", "D", "E", "H", "L", null, "A" };
+
+    private static readonly DiagnosticDescriptor MissingMethod = new DiagnosticDescriptor(
+        "SPG001", "Missing instruction method", "No CPU method '{0}' implements '{1}' ({2})",
+        "Speculator", DiagnosticSeverity.Error, true);
+    private static readonly DiagnosticDescriptor UnboundParameter = new DiagnosticDescriptor(
+        "SPG002", "Unbound instruction method parameter", "CPU method '{0}' parameter '{1} {2}' cannot be bound for '{3}' (Expected byte n, ushort nn, byte d or byte bit)",
+        "Speculator", DiagnosticSeverity.Error, true);
+    private static readonly DiagnosticDescriptor InvalidReturnType = new DiagnosticDescriptor(
+        "SPG003", "Invalid instruction method return type", "CPU method '{0}' must return void, int or byte",
+        "Speculator", DiagnosticSeverity.Error, true);
+
+    public void Initialize(IncrementalGeneratorInitializationContext context)
+    {
+        var entries = context.SyntaxProvider
+            .CreateSyntaxProvider(
+                static (node, _) => node is MethodDeclarationSyntax { Identifier.ValueText: "InitList", Parent: ClassDeclarationSyntax { Identifier.ValueText: "Z80Instructions" } },
+                static (syntaxContext, _) => GetEntries((MethodDeclarationSyntax)syntaxContext.Node))
+            .Collect()
+            .Select(static (lists, _) => new EquatableArray<InstructionEntry>(lists.SelectMany(o => o).ToImmutableArray()));
+
+        var methods = context.SyntaxProvider
+            .CreateSyntaxProvider(
+                static (node, _) => node is MethodDeclarationSyntax { Parent: ClassDeclarationSyntax { Identifier.ValueText: "CPU" } } method &&
+                                    !method.Modifiers.Any(SyntaxKind.StaticKeyword),
+                static (syntaxContext, _) => GetMethod((MethodDeclarationSyntax)syntaxContext.Node))
+            .Collect()
+            .Select(static (list, _) => new EquatableArray<HandlerMethod>(list));
+
+        context.RegisterSourceOutput(entries.Combine(methods), static (sourceContext, input) => Execute(sourceContext, input.Left, input.Right));
+    }
+
+    private static EquatableArray<InstructionEntry> GetEntries(MethodDeclarationSyntax initList)
+    {
+        var entries = ImmutableArray.CreateBuilder<InstructionEntry>();
+        foreach (var creation in initList.DescendantNodes().OfType<BaseObjectCreationExpressionSyntax>())
+        {
+            var args = creation.ArgumentList?.Arguments ?? default;
+            if (args.Count < 3 ||
+                args[0].Expression is not MemberAccessExpressionSyntax id ||
+                args[1].Expression is not LiteralExpressionSyntax mnemonic ||
+                args[2].Expression is not LiteralExpressionSyntax hexTemplate)
+            {
+                continue;
+            }
+
+            var tStates = args.Count > 3 && args[3].Expression is LiteralExpressionSyntax t ? (int)t.Token.Value : 0;
+            var location = new LocationInfo(creation.SyntaxTree.FilePath, creation.Span, creation.GetLocation().GetLineSpan().Span);
+            entries.Add(new InstructionEntry(id.Name.Identifier.ValueText, mnemonic.Token.ValueText, hexTemplate.Token.ValueText, tStates, location));
+        }
+
+        return new EquatableArray<InstructionEntry>(entries.ToImmutable());
+    }
+
+    private static HandlerMethod GetMethod(MethodDeclarationSyntax method)
+    {
+        var parameters = method.ParameterList.Parameters.Select(o => new HandlerParameter(o.Type?.ToString(), o.Identifier.ValueText));
+        return new HandlerMethod(method.Identifier.ValueText, method.ReturnType.ToString(), new EquatableArray<HandlerParameter>(parameters.ToImmutableArray()));
+    }
+
+    private static void Execute(SourceProductionContext context, EquatableArray<InstructionEntry> entries, EquatableArray<HandlerMethod> methods)
+    {
+        if (entries.Count == 0)
+            return;
+
+        var methodsByName = new Dictionary<string, HandlerMethod>();
+        foreach (var method in methods)
+        {
+            if (!methodsByName.ContainsKey(method.Name))
+                methodsByName.Add(method.Name, method);
+        }
+
+        var pages = PageNames.ToDictionary(o => o, _ => new InstructionEntry[256]);
+        foreach (var entry in entries)
+        {
+            var tokens = entry.HexTemplate.Split(' ');
+            var (page, opcodeIndex) = GetPage(tokens);
+            var opcode = byte.Parse(tokens[opcodeIndex], NumberStyles.HexNumber, CultureInfo.InvariantCulture);
+            pages[page][opcode] ??= entry;
+        }
+
+        var tables = new StringBuilder();
+        var handlers = new StringBuilder();
+        foreach (var page in PageNames)
+        {
+            var handlerNames = new string[256];
+            for (var opcode = 0; opcode < 256; opcode++)
+            {
+                var entry = pages[page][opcode];
+                string register = null;
+                if (entry == null && page is "DdCb" or "FdCb")
+                {
+                    // Undocumented - Runs the listed (IX+d)/(IY+d) form, also copying the result to a register.
+                    entry = pages[page][opcode & ~7 | 6];
+                    register = IndexedBitRegisters[opcode & 7];
+                }
+
+                if (entry != null)
+                    handlerNames[opcode] = EmitHandler(context, handlers, page, (byte)opcode, entry, register, methodsByName);
+            }
+
+            tables.AppendLine($"    internal static readonly delegate*<CPU, DecodedInstruction, int>[] {page}Opcodes =");
+            tables.AppendLine("    {");
+            for (var i = 0; i < 256; i += 8)
+                tables.AppendLine("        " + string.Join(", ", handlerNames.Skip(i).Take(8).Select(o => o == null ? "null" : $"&{o}")) + ",");
+            tables.AppendLine("    };");
+            tables.AppendLine();
+        }
+
+        var source = new StringBuilder();
+        source.AppendLine("// <auto-generated/>");
+        source.AppendLine("namespace Speculator.Core;");
+        source.AppendLine();
+        source.AppendLine("unsafe partial class CPU");
+        source.AppendLine("{");
+        source.Append(tables);
+        source.Append(handlers);
+        source.AppendLine("}");
+        context.AddSource("CPU.Opcodes.g.cs", SourceText.From(source.ToString(), Encoding.UTF8));
+    }
+
+    private static (string Page, int OpcodeIndex) GetPage(string[] tokens) =>
+        (tokens[0], tokens.Length > 1 ? tokens[1] : null) switch
+        {
+            ("CB", _) => ("Cb", 1),
+            ("ED", _) => ("Ed", 1),
+            ("DD", "CB") => ("DdCb", 3),
+            ("FD", "CB") => ("FdCb", 3),
+            ("DD", _) => ("Dd", 1),
+            ("FD", _) => ("Fd", 1),
+            _ => ("Main", 0)
+        };
+
+    /// <summary>
+    /// Emit the handler for an opcode, returning its name (or null if the CPU method is unusable).
+    /// </summary>
+    private static string EmitHandler(SourceProductionContext context, StringBuilder handlers, string page, byte opcode, InstructionEntry entry, string register, Dictionary<string, HandlerMethod> methodsByName)
+    {
+        var location = entry.Location.ToLocation();
+        if (!methodsByName.TryGetValue(entry.Id, out var method))
+        {
+            context.ReportDiagnostic(Diagnostic.Create(MissingMethod, location, entry.Id, entry.Mnemonic, entry.HexTemplate));
+            return null;
+        }
+
+        var tokens = entry.HexTemplate.Split(' ');
+        var nIndex = Array.IndexOf(tokens, "n");
+        var isWord = nIndex >= 0 && nIndex + 1 < tokens.Length && tokens[nIndex + 1] == "n";
+        var dIndex = Array.IndexOf(tokens, "d");
+        var hasBit = page is "Cb" or "DdCb" or "FdCb";
+
+        var args = new List<string>();
+        foreach (var parameter in method.Parameters)
+        {
+            var arg = (parameter.Type, parameter.Name) switch
+            {
+                ("byte", "n") when nIndex >= 0 && !isWord => "(byte)op.Immediate",
+                ("ushort", "nn") when isWord => "op.Immediate",
+                ("byte", "d") when dIndex >= 0 => "op.Displacement",
+                ("byte", "bit") when hasBit => $"{(opcode >> 3) & 7}",
+                _ => null
+            };
+
+            if (arg == null)
+            {
+                context.ReportDiagnostic(Diagnostic.Create(UnboundParameter, location, method.Name, parameter.Type, parameter.Name, entry.Mnemonic));
+                return null;
+            }
+
+            args.Add(arg);
+        }
+
+        var call = $"cpu.{method.Name}({string.Join(", ", args)})";
+        string body;
+        switch (method.ReturnType)
+        {
+            case "void":
+                body = $"{call};\n        return {entry.TStates};";
+                break;
+            case "int":
+                body = $"return {call};";
+                break;
+            case "byte":
+                body = register == null ? $"{call};\n        return {entry.TStates};" : $"cpu.TheRegisters.Main.{register} = {call};\n        return {entry.TStates};";
+                break;
+            default:
+                context.ReportDiagnostic(Diagnostic.Create(InvalidReturnType, location, method.Name));
+                return null;
+        }
+
+        var name = $"{page}_{opcode:X2}";
+        var mnemonic = register != null && method.ReturnType == "byte" ? $"{entry.Mnemonic},{register}" : entry.Mnemonic;
+        handlers.AppendLine($"    // {mnemonic}");
+        handlers.AppendLine($"    private static int {name}(CPU cpu, DecodedInstruction op)");
+        handlers.AppendLine("    {");
+        handlers.AppendLine($"        {body}");
+        handlers.AppendLine("    }");
+        handlers.AppendLine();
+        return name;
+    }
+}
@@ -0,0 +1,174 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using System.Collections.Concurrent;
+using System.Diagnostics;
+using System.Reflection;
+using CSharp.Core.Extensions;
+using Speculator.Core;
+using Speculator.Core.Capture;
+using Speculator.Core.Debugger;
+
+namespace Speculator.Runner;
+
+/// <summary>
+/// Runs a batch of snapshots/tapes on headless machines in parallel, at maximum speed,
+/// reporting the final screen and CPU state of each.
+/// Optionally captures the sound (.wav) and screen (.y4m) of each run.
+/// Tapes can be flash loaded through the ROM's LD-BYTES routine, rather than played in real time.
+/// </summary>
+/// <remarks>
+/// Usage: Speculator.Runner [--frames n] [--threads n] [--rom file] [--jit] [--flash] [--profile dir] [--capture dir] file|directory...
+/// </remarks>
+internal static class Program
+{
+    private static int Main(string[] args)
+    {
+        var frameCount = 500;
+        var threadCount = Environment.ProcessorCount;
+        var romFile = Assembly.GetExecutingAssembly().GetDirectory().GetDir("ROMs").GetFile("Standard Spectrum 48K BASIC.rom");
+        var files = new List<FileInfo>();
+        var useJit = false;
+        var isFlashLoad = false;
+        DirectoryInfo profileDir = null;
+        DirectoryInfo captureDir = null;
+
+        for (var i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "--frames" when i + 1 < args.Length:
+                    frameCount = int.Parse(args[++i]);
+                    break;
+                case "--threads" when i + 1 < args.Length:
+                    threadCount = int.Parse(args[++i]);
+                    break;
+                case "--rom" when i + 1 < args.Length:
+                    romFile = new FileInfo(args[++i]);
+                    break;
+                case "--jit":
+                    useJit = true;
+                    break;
+                case "--flash":
+                    isFlashLoad = true;
+                    break;
+                case "--profile" when i + 1 < args.Length:
+                    profileDir = new DirectoryInfo(args[++i]);
+                    break;
+                case "--capture" when i + 1 < args.Length:
+                    captureDir = new DirectoryInfo(args[++i]);
+                    break;
+                default:
+                    if (Directory.Exists(args[i]))
+                    {
+                        files.AddRange(
+                            new DirectoryInfo(args[i])
+                                .EnumerateFiles()
+                                .Where(o => ZxFileIo.OpenFilters.Any(filter => filter.EndsWith(o.Extension.ToLower())))
+                                .OrderBy(o => o.Name));
+                    }
+                    else
+                    {
+                        files.Add(new FileInfo(args[i]));
+                    }
+                    break;
+            }
+        }
+
+        if (files.Count == 0 || frameCount <= 0 || threadCount <= 0)
+        {
+            Console.WriteLine("Usage: Speculator.Runner [--frames n] [--threads n] [--rom file] [--jit] [--flash] [--profile dir] [--capture dir] file|directory...");
+            return 1;
+        }
+
+        if (!romFile.Exists())
+        {
+            Console.WriteLine($"ROM not found: {romFile.FullName}");
+            return 1;
+        }
+
+        profileDir?.Create();
+        captureDir?.Create();
+
+        var results = new ConcurrentDictionary<int, string>();
+        var totalTStates = 0L;
+        var stopwatch = Stopwatch.StartNew();
+        Parallel.For(
+            0,
+            files.Count,
+            new ParallelOptions { MaxDegreeOfParallelism = threadCount },
+            i =>
+            {
+                var result = Run(files[i], romFile, frameCount, useJit, isFlashLoad, profileDir, captureDir, out var tStates);
+                Interlocked.Add(ref totalTStates, tStates);
+                results[i] = result;
+            });
+        stopwatch.Stop();
+
+        Console.WriteLine("File\tScreenHash\tMHz\tCacheHits\tRegisters");
+        for (var i = 0; i < files.Count; i++)
+            Console.WriteLine(results[i]);
+        Console.WriteLine($"Total: {files.Count} image(s), {frameCount} frame(s) each, {threadCount} thread(s), {stopwatch.Elapsed.TotalSeconds:F2}s, {GetMHz(totalTStates, stopwatch.Elapsed):F1} emulated MHz");
+        
+        return results.Values.Any(o => o.Contains("\tERROR\t")) ? 2 : 0;
+    }
+
+    private static string Run(FileInfo file, FileInfo romFile, int frameCount, bool useJit, bool isFlashLoad, DirectoryInfo profileDir, DirectoryInfo captureDir, out long tStates)
+    {
+        tStates = 0;
+        try
+        {
+            var machine = new HeadlessZxSpectrum(romFile)
+            {
+                TheCpu = { UseJit = useJit, IsProfiling = profileDir != null },
+                TheTapeLoader = { IsFlashLoadEnabled = isFlashLoad }
+            };
+            machine.LoadFile(file);
+
+            var startTStates = machine.TheCpu.TStatesSinceCpuStart;
+            var stopwatch = Stopwatch.StartNew();
+            using (captureDir != null ? new CaptureSession(machine, captureDir.GetFile($"{file.Name}.wav"), captureDir.GetFile($"{file.Name}.y4m")) : null)
+                machine.RunFrames(frameCount);
+            stopwatch.Stop();
+            tStates = machine.TheCpu.TStatesSinceCpuStart - startTStates;
+
+            if (profileDir != null)
+                WriteProfile(machine.TheCpu.Profiler, profileDir, file);
+
+            return $"{file.Name}\t{machine.GetScreenHash()}\t{GetMHz(tStates, stopwatch.Elapsed):F1}\t{machine.TheCpu.InstructionCache.HitRate:P1}\t{GetRegisterSummary(machine.TheCpu.TheRegisters)}";
+        }
+        catch (Exception e)
+        {
+            return $"{file.Name}\tERROR\t\t\t{e.Message}";
+        }
+    }
+
+    /// <summary>
+    /// Write the folded call stacks (For flame graph tools) and hot routine report.
+    /// </summary>
+    private static void WriteProfile(Profiler profiler, DirectoryInfo profileDir, FileInfo file)
+    {
+        using (var writer = profileDir.GetFile($"{file.Name}.folded").CreateText())
+            profiler.WriteFoldedStacks(writer);
+        profileDir.GetFile($"{file.Name}.hotlist.txt").WriteAllText(profiler.GetHotList());
+    }
+
+    private static double GetMHz(long tStates, TimeSpan elapsed) =>
+        elapsed.TotalSeconds > 0.0 ? tStates / elapsed.TotalSeconds / 1.0e6 : 0.0;
+
+    private static string GetRegisterSummary(Registers registers) =>
+        $"PC={registers.PC:X4} SP={registers.SP:X4} " +
+        $"AF={registers.Main.AF:X4} BC={registers.Main.BC:X4} DE={registers.Main.DE:X4} HL={registers.Main.HL:X4} " +
+        $"AF'={registers.Alt.AF:X4} BC'={registers.Alt.BC:X4} DE'={registers.Alt.DE:X4} HL'={registers.Alt.HL:X4} " +
+        $"IX={registers.IX:X4} IY={registers.IY:X4} I={registers.I:X2} R={registers.R:X2} " +
+        $"IM={registers.IM} IFF1={(registers.IFF1 ? 1 : 0)} IFF2={(registers.IFF2 ? 1 : 0)}";
+}
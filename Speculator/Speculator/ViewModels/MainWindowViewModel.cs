@@ -72,6 +72,7 @@ public class MainWindowViewModel : ViewModelBase, IDisposable
             Display.IsCrt = Settings.IsCrt;
             Speccy.PortHandler.EmulateCursorJoystick = Settings.EmulateCursorJoystick;
             Speccy.SoundHandler.SetEnabled(Settings.IsSoundEnabled);
+            Speccy.TheTapeLoader.IsFlashLoadEnabled = Settings.IsFlashLoadEnabled;
 
             if (allowMessages)
                 ShowCrtMessage();
@@ -170,6 +171,9 @@ public class MainWindowViewModel : ViewModelBase, IDisposable
     public void ToggleAmbientBlur() =>
         Settings.IsAmbientBlurred = !Settings.IsAmbientBlurred;
 
+    public void ToggleFlashLoad() =>
+        Settings.IsFlashLoadEnabled = !Settings.IsFlashLoadEnabled;
+
     public void OpenProjectPage() =>
         new Uri("https://github.com/deanthecoder/ZXSpeculator").Open();
 
@@ -200,9 +204,46 @@ public class MainWindowViewModel : ViewModelBase, IDisposable
         command.Execute(null);
     }
     
+    public bool IsProfiling => Speccy.TheCpu.IsProfiling;
+
+    public void StartProfiling()
+    {
+        Speccy.TheCpu.IsProfiling = true;
+        OnPropertyChanged(nameof(IsProfiling));
+    }
+
+    /// <summary>
+    /// Stop profiling, and offer to save the folded call stacks (For flame graph tools) and hot routine report.
+    /// </summary>
+    public void StopProfiling()
+    {
+        Speccy.TheCpu.IsProfiling = false;
+        OnPropertyChanged(nameof(IsProfiling));
+
+        var profiler = Speccy.TheCpu.Profiler;
+        var keyBlocker = Speccy.PortHandler.CreateKeyBlocker();
+        var command = new FileSaveCommand("Save Profile", "Folded Stacks", new[] { "*.folded" });
+        command.FileSelected += (_, info) =>
+        {
+            try
+            {
+                using (var writer = info.CreateText())
+                    profiler.WriteFoldedStacks(writer);
+                File.WriteAllText(Path.ChangeExtension(info.FullName, ".hotlist.txt"), profiler.GetHotList());
+            }
+            finally
+            {
+                keyBlocker.Dispose();
+            }
+        };
+        command.Cancelled += (_, _) => keyBlocker.Dispose();
+        command.Execute(null);
+    }
+
     public void Dispose()
     {
         Speccy.Dispose();
+        Display.Dispose();
         Settings.MruFiles = Mru.AsString();
     }
 }
@@ -61,6 +61,12 @@ public class Settings : UserSettingsBase
         set => Set(value);
     }
 
+    public bool IsFlashLoadEnabled
+    {
+        get => Get<bool>();
+        set => Set(value);
+    }
+
     public string MruFiles
     {
         get => Get<string>();
@@ -0,0 +1,61 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core.HostDevices;
+
+namespace UnitTests;
+
+[TestFixture]
+public class AdaptiveResamplerTests : TestsBase
+{
+    [Test]
+    public void CheckRatioIsNudgedTowardsTargetFill()
+    {
+        var resampler = new AdaptiveResampler(1000, 500);
+        resampler.UpdateFill(1000);
+        Assert.That(resampler.Ratio, Is.EqualTo(1.0));
+
+        // A full queue consumes faster, an empty one slower, but never by more than 0.5%.
+        for (var i = 0; i < 200; i++)
+            resampler.UpdateFill(100000);
+        Assert.That(resampler.Ratio, Is.EqualTo(1.005).Within(1e-9));
+        for (var i = 0; i < 200; i++)
+            resampler.UpdateFill(0);
+        Assert.That(resampler.Ratio, Is.EqualTo(0.995).Within(1e-9));
+    }
+
+    [Test]
+    public void CheckResamplingInterpolatesAndConsumesWhatItAsksFor()
+    {
+        var resampler = new AdaptiveResampler(1000, 500);
+        for (var i = 0; i < 200; i++)
+            resampler.UpdateFill(0);
+
+        // A steady ramp stays a ramp, stretched by the ratio.
+        var next = 0;
+        var output = new short[100];
+        for (var block = 0; block < 10; block++)
+        {
+            var input = Enumerable.Range(next, resampler.GetInputCount(output.Length)).Select(o => (short)(o * 10)).ToArray();
+            next += input.Length;
+            Assert.That(resampler.Resample(input, output), Is.EqualTo(output.Length));
+        }
+
+        var steps = output.Zip(output.Skip(1), (a, b) => b - a).ToArray();
+        Assert.That(steps.Min(), Is.GreaterThanOrEqualTo(9));
+        Assert.That(steps.Max(), Is.LessThanOrEqualTo(10));
+
+        // Running out of input stops early.
+        Assert.That(resampler.Resample(new short[10], output), Is.LessThan(output.Length));
+    }
+}
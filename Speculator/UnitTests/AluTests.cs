@@ -0,0 +1,259 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using System.Diagnostics;
+using System.Numerics;
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+
+namespace UnitTests;
+
+[TestFixture]
+public class AluTests : TestsBase
+{
+    private static readonly Alu.DeferredOp[] FlagOps =
+    {
+        Alu.DeferredOp.Add, Alu.DeferredOp.Subtract, Alu.DeferredOp.Compare, Alu.DeferredOp.Inc, Alu.DeferredOp.Dec, Alu.DeferredOp.And, Alu.DeferredOp.Or, Alu.DeferredOp.Xor
+    };
+
+    /// <summary>
+    /// Arithmetic and logic ops, as issued by the Z80.
+    /// </summary>
+    public enum AluOp { Add, Adc, Sub, Sbc, Cp, Inc, Dec, And, Or, Xor }
+
+    [Test]
+    public void CheckFlagsMatchReferenceModel([Values(false, true)] bool lazyFlags)
+    {
+        var registers = new Registers();
+        var alu = new Alu(registers) { LazyFlags = lazyFlags };
+        foreach (var op in Enum.GetValues<AluOp>())
+        {
+            for (var n = 0; n < 0x20000; n++)
+            {
+                var a = (byte)(n >> 8);
+                var b = (byte)n;
+                var carry = n >= 0x10000;
+                var f = Execute(alu, op, a, b, carry);
+                Assert.That(f, Is.EqualTo(GetReferenceFlags(op, a, b, carry)), $"{op} a={a:X2} b={b:X2} carry={carry}");
+            }
+        }
+    }
+
+    /// <summary>
+    /// Conditional jumps read Z and C without materialising F, so they must agree with it.
+    /// </summary>
+    [Test]
+    public void CheckDeferredZeroAndCarryMatchFlags([Values(false, true)] bool useJit)
+    {
+        // op A,B, NOP
+        var ops = new[] { (AluOp.Add, 0x80), (AluOp.Adc, 0x88), (AluOp.Sub, 0x90), (AluOp.Sbc, 0x98), (AluOp.Cp, 0xB8) };
+        foreach (var (op, opcode) in ops)
+        {
+            var cpu = new CPU(new Memory());
+            cpu.MainMemory.LoadData(new byte[] { (byte)opcode, 0x00 }, 0x8000);
+            var jit = useJit ? new BlockJit(cpu) : null;
+            var main = cpu.TheRegisters.Main;
+            for (var n = 0; n < 0x20000; n++)
+            {
+                main.A = (byte)(n >> 8);
+                main.B = (byte)n;
+                main.F = (byte)(n >= 0x10000 ? 0x01 : 0x00);
+                cpu.TheRegisters.PC = 0x8000;
+                if (jit != null)
+                    Assert.That(jit.TryRun(0x8000, long.MaxValue), Is.True);
+                else
+                    cpu.Step();
+
+                var isZero = cpu.TheRegisters.ZeroFlag;
+                var isCarry = cpu.TheRegisters.CarryFlag;
+                var f = main.F;
+                if (isZero != ((f & 0x40) != 0) || isCarry != ((f & 0x01) != 0))
+                    Assert.Fail($"{op} a={n >> 8 & 0xFF:X2} b={n & 0xFF:X2} carry={n >= 0x10000}: Z={isZero} C={isCarry}, F={f:X2}");
+            }
+        }
+    }
+
+    /// <summary>
+    /// Known results from the Z80 documentation.
+    /// </summary>
+    [Test]
+    [TestCase(AluOp.Add, 0x7F, 0x01, false, 0x94)]
+    [TestCase(AluOp.Add, 0xFF, 0x01, false, 0x51)]
+    [TestCase(AluOp.Adc, 0x0E, 0x01, true, 0x10)]
+    [TestCase(AluOp.Sub, 0x80, 0x01, false, 0x3E)]
+    [TestCase(AluOp.Sbc, 0x00, 0xFF, true, 0x53)]
+    [TestCase(AluOp.Cp, 0x00, 0x01, false, 0x93)]
+    [TestCase(AluOp.Cp, 0x28, 0x28, false, 0x6A)]
+    [TestCase(AluOp.Inc, 0x7F, 0x00, false, 0x94)]
+    [TestCase(AluOp.Dec, 0x80, 0x00, true, 0x3F)]
+    [TestCase(AluOp.And, 0x0F, 0xF0, false, 0x54)]
+    [TestCase(AluOp.Xor, 0xFF, 0x00, false, 0xAC)]
+    public void CheckKnownFlagResults(AluOp op, int a, int b, bool carry, int expectedF)
+    {
+        foreach (var lazyFlags in new[] { false, true })
+        {
+            var alu = new Alu(new Registers()) { LazyFlags = lazyFlags };
+            Assert.That(Execute(alu, op, (byte)a, (byte)b, carry), Is.EqualTo((byte)expectedF));
+            Assert.That(GetReferenceFlags(op, (byte)a, (byte)b, carry), Is.EqualTo((byte)expectedF));
+        }
+    }
+
+    [Test]
+    public void CheckBitTestFlags()
+    {
+        Assert.That(Alu.GetBitTestFlags(0x00, 0), Is.EqualTo(0x54));
+        Assert.That(Alu.GetBitTestFlags(0x01, 0), Is.EqualTo(0x10));
+        Assert.That(Alu.GetBitTestFlags(0x80, 7), Is.EqualTo(0x90));
+        Assert.That(Alu.GetBitTestFlags(0x28, 0), Is.EqualTo(0x7C));
+    }
+
+    /// <summary>
+    /// Compare the throughput of the bit-by-bit flag derivation against the lookup tables.
+    /// </summary>
+    [Test, Explicit]
+    public void BenchmarkFlagTables()
+    {
+        const int Iterations = 50;
+        var calculated = TimeFlagOps(Iterations, Alu.CalculateFlags);
+        var tabled = TimeFlagOps(Iterations, Alu.ComputeDeferredFlags);
+
+        var opCount = Iterations * FlagOps.Length * 0x20000;
+        TestContext.Out.WriteLine($"Calculated: {opCount / calculated.TotalSeconds / 1e6:F1} M ops/sec");
+        TestContext.Out.WriteLine($"Tables:     {opCount / tabled.TotalSeconds / 1e6:F1} M ops/sec");
+        Assert.That(tabled, Is.LessThan(calculated));
+    }
+
+    private static TimeSpan TimeFlagOps(int iterations, Func<Alu.DeferredOp, byte, byte, int, bool, byte> getFlags)
+    {
+        var checksum = 0;
+        var stopwatch = Stopwatch.StartNew();
+        for (var i = 0; i < iterations; i++)
+        {
+            foreach (var op in FlagOps)
+            {
+                for (var n = 0; n < 0x20000; n++)
+                {
+                    var (a, b, v, carry) = GetOperands(op, n);
+                    checksum += getFlags(op, a, b, v, carry);
+                }
+            }
+        }
+
+        stopwatch.Stop();
+        Assert.That(checksum, Is.Not.Zero);
+        return stopwatch.Elapsed;
+    }
+
+    /// <summary>
+    /// Run an op with A=a and the given carry-in, returning the resulting F register.
+    /// </summary>
+    private static byte Execute(Alu alu, AluOp op, byte a, byte b, bool carry)
+    {
+        var main = alu.TheRegisters.Main;
+        main.A = a;
+        main.F = (byte)(carry ? 0x01 : 0x00);
+        switch (op)
+        {
+            case AluOp.Add: main.A = alu.AddAndSetFlags(a, b, false); break;
+            case AluOp.Adc: main.A = alu.AddAndSetFlags(a, b, true); break;
+            case AluOp.Sub: main.A = alu.SubtractAndSetFlags(a, b, false); break;
+            case AluOp.Sbc: main.A = alu.SubtractAndSetFlags(a, b, true); break;
+            case AluOp.Cp: alu.Compare(a, b); break;
+            case AluOp.Inc: main.A = alu.IncAndSetFlags(a); break;
+            case AluOp.Dec: main.A = alu.DecAndSetFlags(a); break;
+            case AluOp.And: alu.And(b); break;
+            case AluOp.Or: alu.Or(b); break;
+            case AluOp.Xor: alu.Xor(b); break;
+        }
+
+        return main.F;
+    }
+
+    /// <summary>
+    /// The F register from first principles, independent of the ALU's tables and their builder.
+    /// </summary>
+    private static byte GetReferenceFlags(AluOp op, byte a, byte b, bool carry)
+    {
+        var c = carry ? 1 : 0;
+        int r;
+        int f;
+        switch (op)
+        {
+            case AluOp.Add:
+            case AluOp.Adc:
+                c = op == AluOp.Adc ? c : 0;
+                r = a + b + c;
+                f = GetSz53((byte)r);
+                if ((a & 0x0F) + (b & 0x0F) + c > 0x0F) f |= 0x10;
+                if (((a ^ ~b) & (a ^ r) & 0x80) != 0) f |= 0x04;
+                if (r > 0xFF) f |= 0x01;
+                return (byte)f;
+
+            case AluOp.Sub:
+            case AluOp.Sbc:
+            case AluOp.Cp:
+                c = op == AluOp.Sbc ? c : 0;
+                r = a - b - c;
+                f = GetSz53((byte)r) | 0x02;
+                if ((a & 0x0F) - (b & 0x0F) - c < 0) f |= 0x10;
+                if (((a ^ b) & (a ^ r) & 0x80) != 0) f |= 0x04;
+                if (r < 0) f |= 0x01;
+                if (op == AluOp.Cp)
+                    f = (f & ~0x28) | (b & 0x28); // 5 and 3 come from the operand.
+                return (byte)f;
+
+            case AluOp.Inc:
+                f = GetSz53((byte)(a + 1)) | c;
+                if ((a & 0x0F) == 0x0F) f |= 0x10;
+                if (a == 0x7F) f |= 0x04;
+                return (byte)f;
+
+            case AluOp.Dec:
+                f = GetSz53((byte)(a - 1)) | 0x02 | c;
+                if ((a & 0x0F) == 0x00) f |= 0x10;
+                if (a == 0x80) f |= 0x04;
+                return (byte)f;
+
+            default:
+                r = op switch { AluOp.And => a & b, AluOp.Or => a | b, _ => a ^ b };
+                f = GetSz53((byte)r) | (op == AluOp.And ? 0x10 : 0x00);
+                if (BitOperations.PopCount((uint)r) % 2 == 0) f |= 0x04;
+                return (byte)f;
+        }
+    }
+
+    private static int GetSz53(byte r) =>
+        (r & 0xA8) | (r == 0 ? 0x40 : 0x00);
+
+    /// <summary>
+    /// Decode an index of carry (bit 16), a (bits 8-15) and b (bits 0-7) into operands as the ALU would record them.
+    /// </summary>
+    private static (byte a, byte b, int v, bool carry) GetOperands(Alu.DeferredOp op, int n)
+    {
+        var a = (byte)(n >> 8);
+        var b = (byte)n;
+        var carry = n >= 0x10000;
+        var c = carry ? 1 : 0;
+        return op switch
+        {
+            Alu.DeferredOp.Add => (a, b, a + b + c, carry),
+            Alu.DeferredOp.Subtract => (a, b, a - b - c, carry),
+            Alu.DeferredOp.Compare => (a, b, a - b, false),
+            Alu.DeferredOp.Inc => (a, 0x01, a + 1, carry),
+            Alu.DeferredOp.Dec => (a, 0x01, a - 1, carry),
+            Alu.DeferredOp.And => (a, b, a & b, false),
+            Alu.DeferredOp.Or => (a, b, a | b, false),
+            _ => (a, b, a ^ b, false)
+        };
+    }
+}
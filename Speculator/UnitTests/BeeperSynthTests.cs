@@ -0,0 +1,48 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+
+namespace UnitTests;
+
+[TestFixture]
+public class BeeperSynthTests : TestsBase
+{
+    private const int SampleHz = 44100;
+
+    [Test]
+    public void CheckEachFrameProducesItsSamples()
+    {
+        var beeper = new BeeperSynth(SampleHz);
+        for (var frame = 1; frame <= 3; frame++)
+            Assert.That(beeper.EndFrame(frame * CPU.TStatesPerInterrupt).Length, Is.EqualTo(SampleHz / 50));
+    }
+
+    [Test]
+    public void CheckEdgeIsABandLimitedStep()
+    {
+        var beeper = new BeeperSynth(SampleHz);
+        beeper.AddEdge(CPU.TStatesPerInterrupt / 2, 3);
+        var samples = beeper.EndFrame(CPU.TStatesPerInterrupt).ToArray();
+
+        // Silent until just before the step, which then ramps through intermediate values.
+        const int stepIndex = SampleHz / 100;
+        Assert.That(samples.Take(stepIndex - 8), Is.All.EqualTo(0));
+        var peak = samples.Max(o => (int)o);
+        Assert.That(samples.Count(o => o > 0 && o < peak / 2), Is.GreaterThan(0));
+        Assert.That(samples[stepIndex + 16], Is.GreaterThan(peak * 0.9));
+
+        // Ringing stays well clear of clipping.
+        Assert.That(peak, Is.LessThan(short.MaxValue * 0.85));
+    }
+}
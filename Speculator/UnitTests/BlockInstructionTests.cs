@@ -0,0 +1,106 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using CSharp.Core;
+using CSharp.Core.Extensions;
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+
+namespace UnitTests;
+
+[TestFixture]
+public class BlockInstructionTests : TestsBase
+{
+    private const ushort ProgramAddr = 0x8000;
+
+    /// <summary>
+    /// Opcode (following the ED prefix), HL, DE, BC and A.
+    /// </summary>
+    private static readonly object[] TestCases =
+    {
+        new object[] { "LDIR", (byte)0xB0, (ushort)0x9000, (ushort)0xA000, (ushort)0x1800, (byte)0x00 },
+        new object[] { "LDIR overlap", (byte)0xB0, (ushort)0x9000, (ushort)0x9001, (ushort)0x1800, (byte)0x00 },
+        new object[] { "LDIR wrap", (byte)0xB0, (ushort)0xFF00, (ushort)0x4000, (ushort)0x0400, (byte)0x00 },
+        new object[] { "LDIR self", (byte)0xB0, (ushort)0x9000, (ushort)0x7F00, (ushort)0x0400, (byte)0x00 },
+        new object[] { "LDDR", (byte)0xB8, (ushort)0x9FFF, (ushort)0xBFFF, (ushort)0x1800, (byte)0x00 },
+        new object[] { "LDDR overlap", (byte)0xB8, (ushort)0x9FFF, (ushort)0x9FFE, (ushort)0x1800, (byte)0x00 },
+        new object[] { "LDDR self", (byte)0xB8, (ushort)0x9FFF, (ushort)0x8100, (ushort)0x0400, (byte)0x00 },
+        new object[] { "LDIR into ROM", (byte)0xB0, (ushort)0x9000, (ushort)0x3F00, (ushort)0x0400, (byte)0x00 },
+        new object[] { "LDDR into ROM", (byte)0xB8, (ushort)0x9FFF, (ushort)0x40FF, (ushort)0x0400, (byte)0x00 },
+        new object[] { "CPIR", (byte)0xB1, (ushort)0x9000, (ushort)0x0000, (ushort)0x4000, (byte)0xE5 },
+        new object[] { "CPDR", (byte)0xB9, (ushort)0x9FFF, (ushort)0x0000, (ushort)0x4000, (byte)0xE5 },
+        new object[] { "INIR", (byte)0xB2, (ushort)0x9000, (ushort)0x0000, (ushort)0x00FE, (byte)0x00 },
+        new object[] { "INDR", (byte)0xBA, (ushort)0x9000, (ushort)0x0000, (ushort)0x00FE, (byte)0x00 },
+        new object[] { "OTIR", (byte)0xB3, (ushort)0x9000, (ushort)0x0000, (ushort)0x00FE, (byte)0x00 },
+        new object[] { "OTDR", (byte)0xBB, (ushort)0x9000, (ushort)0x0000, (ushort)0x00FE, (byte)0x00 }
+    };
+
+    [Test, TestCaseSource(nameof(TestCases))]
+    public void CheckBulkRepeatsMatchSingleStepping(string name, byte opcode, ushort hl, ushort de, ushort bc, byte a)
+    {
+        var stepped = CreateCpu(opcode, hl, de, bc, a, out var steppedPorts);
+        var batched = CreateCpu(opcode, hl, de, bc, a, out var batchedPorts);
+
+        // Run for a few frames, so the block instruction repeats across many scanline events.
+        const long endTStates = CPU.TStatesPerInterrupt * 3;
+        while (stepped.TStatesSinceCpuStart < endTStates)
+            stepped.Step();
+        while (batched.TStatesSinceCpuStart < endTStates)
+            batched.StepToNextEvent(endTStates);
+
+        Assert.That(batched.TStatesSinceCpuStart, Is.EqualTo(stepped.TStatesSinceCpuStart), "T-states");
+        Assert.That(batched.TheRegisters.PC, Is.EqualTo(stepped.TheRegisters.PC), "PC");
+        Assert.That(batched.TheRegisters.R, Is.EqualTo(stepped.TheRegisters.R), "R");
+        Assert.That(batched.TheRegisters.Main.AF, Is.EqualTo(stepped.TheRegisters.Main.AF), "AF");
+        Assert.That(batched.TheRegisters.Main.BC, Is.EqualTo(stepped.TheRegisters.Main.BC), "BC");
+        Assert.That(batched.TheRegisters.Main.DE, Is.EqualTo(stepped.TheRegisters.Main.DE), "DE");
+        Assert.That(batched.TheRegisters.Main.HL, Is.EqualTo(stepped.TheRegisters.Main.HL), "HL");
+        Assert.That(batched.MainMemory.Data, Is.EqualTo(stepped.MainMemory.Data), "Memory");
+        Assert.That(batchedPorts.Log, Is.EqualTo(steppedPorts.Log), "Port activity");
+    }
+
+    private static CPU CreateCpu(byte opcode, ushort hl, ushort de, ushort bc, byte a, out RecordingPortHandler portHandler)
+    {
+        portHandler = new RecordingPortHandler();
+        var cpu = new CPU(new Memory(), portHandler);
+        portHandler.TheCpu = cpu;
+        using (var rom = new TempFile(".rom").WriteAllBytes(new byte[0x4000]))
+            cpu.MainMemory.LoadRom(rom);
+
+        // Repeatable memory contents, with the block instruction looping forever.
+        new Random(1234).NextBytes(cpu.MainMemory.Data);
+        cpu.MainMemory.LoadData(new byte[] { 0xED, opcode, 0x18, 0xFC }, ProgramAddr); // ED xx, JR -4
+
+        var regs = cpu.TheRegisters;
+        regs.PC = ProgramAddr;
+        regs.Main.HL = hl;
+        regs.Main.DE = de;
+        regs.Main.BC = bc;
+        regs.Main.A = a;
+        return cpu;
+    }
+
+    /// <summary>
+    /// Returns the T-state count from port reads, and logs port writes with their timing.
+    /// </summary>
+    private class RecordingPortHandler : IPortHandler
+    {
+        public CPU TheCpu { get; set; }
+        public List<string> Log { get; } = new List<string>();
+
+        public byte In(ushort portAddress) => (byte)(TheCpu.TStatesSinceCpuStart ^ portAddress);
+
+        public void Out(ushort portAddress, byte b) =>
+            Log.Add($"{TheCpu.TStatesSinceCpuStart}:{portAddress:X4}={b:X2}");
+    }
+}
@@ -0,0 +1,84 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+
+namespace UnitTests;
+
+[TestFixture]
+public class BlockJitTests : TestsBase
+{
+    private const ushort ProgramAddr = 0x8000;
+
+    [Test]
+    public void CheckInlinedInstructionsMatchTheInterpreter([Values(false, true)] bool lazyFlags)
+    {
+        var stepped = CreateCpu(lazyFlags, useJit: false);
+        while (!stepped.IsHalted)
+            stepped.Step();
+
+        var compiled = CreateCpu(lazyFlags, useJit: true);
+        while (!compiled.IsHalted)
+            compiled.StepBlock();
+        Assert.That(compiled.CompiledBlockCount, Is.EqualTo(1));
+
+        Assert.That(compiled.TheRegisters.Main.AF, Is.EqualTo(stepped.TheRegisters.Main.AF), "AF");
+        Assert.That(compiled.TheRegisters.Main.BC, Is.EqualTo(stepped.TheRegisters.Main.BC), "BC");
+        Assert.That(compiled.TheRegisters.Main.DE, Is.EqualTo(stepped.TheRegisters.Main.DE), "DE");
+        Assert.That(compiled.TheRegisters.Main.HL, Is.EqualTo(stepped.TheRegisters.Main.HL), "HL");
+        Assert.That(compiled.TheRegisters.R, Is.EqualTo(stepped.TheRegisters.R), "R");
+        Assert.That(compiled.TStatesSinceCpuStart, Is.EqualTo(stepped.TStatesSinceCpuStart), "T-states");
+        Assert.That(compiled.MainMemory.GetSlotSpan(0x9000, 0x40).ToArray(), Is.EqualTo(stepped.MainMemory.GetSlotSpan(0x9000, 0x40).ToArray()), "Data");
+        Assert.That(compiled.MainMemory.GetSlotSpan(0xBEF0, 0x10).ToArray(), Is.EqualTo(stepped.MainMemory.GetSlotSpan(0xBEF0, 0x10).ToArray()), "Stack");
+    }
+
+    private static CPU CreateCpu(bool lazyFlags, bool useJit)
+    {
+        var cpu = new CPU(new Memory()) { LazyFlags = lazyFlags, UseJit = useJit };
+
+        // A mix of loads, stores and ALU ops (some of whose flags are overwritten before being read),
+        // pushing the flags part way through and at the end.
+        cpu.MainMemory.LoadData(new byte[]
+        {
+            0x3E, 0x7F,       // LD A,7Fh
+            0xC6, 0x01,       // ADD A,1
+            0x47,             // LD B,A
+            0x88,             // ADC A,B
+            0xDD, 0x77, 0x05, // LD (IX+5),A
+            0xDD, 0xAE, 0x05, // XOR (IX+5)
+            0x3C,             // INC A
+            0x0D,             // DEC C
+            0xF6, 0x81,       // OR 81h
+            0x21, 0x10, 0x90, // LD HL,9010h
+            0x77,             // LD (HL),A
+            0x9E,             // SBC A,(HL)
+            0xFE, 0x40,       // CP 40h
+            0xF5,             // PUSH AF
+            0xA1,             // AND C
+            0x87,             // ADD A,A
+            0x32, 0x20, 0x90, // LD (9020h),A
+            0xDD, 0x56, 0x05, // LD D,(IX+5)
+            0x35,             // DEC (HL)
+            0x1C,             // INC E
+            0xF5,             // PUSH AF
+            0x76              // HALT
+        }, ProgramAddr);
+        cpu.TheRegisters.PC = ProgramAddr;
+        cpu.TheRegisters.SP = 0xBF00;
+        cpu.TheRegisters.IX = 0x9000;
+        cpu.TheRegisters.Main.C = 0x33;
+        cpu.TheRegisters.Main.E = 0xFF;
+        return cpu;
+    }
+}
@@ -0,0 +1,62 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using CSharp.Core;
+using CSharp.Core.Extensions;
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+using Speculator.Core.Capture;
+
+namespace UnitTests;
+
+[TestFixture]
+public class CaptureSessionTests : TestsBase
+{
+    [Test]
+    public void CheckFramesAndSamplesAreCaptured()
+    {
+        // Toggle the speaker every ~3300 T-states, with a white border.
+        var romData = new byte[0x4000];
+        new byte[]
+        {
+            0x3E, 0x17, // LD A,$17
+            0xD3, 0xFE, // OUT ($FE),A
+            0x06, 0x00, // LD B,0
+            0x10, 0xFE, // DJNZ $
+            0xEE, 0x10, // XOR $10
+            0x18, 0xF6  // JR $-8
+        }.CopyTo(romData, 0);
+
+        const int frameCount = 50;
+        using var rom = new TempFile(".rom").WriteAllBytes(romData);
+        using var audioFile = new TempFile(".wav");
+        using var videoFile = new TempFile(".raw");
+        var machine = new HeadlessZxSpectrum(rom);
+        using (var capture = new CaptureSession(machine, audioFile, videoFile))
+        {
+            machine.RunFrames(frameCount);
+            Assert.That(capture.FrameCount, Is.EqualTo(frameCount));
+        }
+
+        var frames = videoFile.ReadAllBytes();
+        Assert.That(frames.Length, Is.EqualTo(frameCount * ZxDisplay.ScreenWidth * ZxDisplay.ScreenHeight));
+        Assert.That(frames[^1], Is.EqualTo(7));
+
+        var wav = audioFile.ReadAllBytes();
+        Assert.That(BitConverter.ToInt32(wav, 40), Is.EqualTo(wav.Length - 44));
+        var samples = new short[(wav.Length - 44) / 2];
+        Buffer.BlockCopy(wav, 44, samples, 0, samples.Length * 2);
+        Assert.That(samples.Length, Is.GreaterThan((frameCount - 1) * 882));
+        Assert.That(samples.Min(), Is.LessThan(-1000));
+        Assert.That(samples.Max(), Is.GreaterThan(1000));
+    }
+}
@@ -0,0 +1,228 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using System.Numerics;
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+
+namespace UnitTests;
+
+[TestFixture]
+public class DisplayTests : TestsBase
+{
+    private const int ScanlineCount = 312;
+
+    [Test]
+    public void CheckIncrementalRenderingMatchesFullRendering()
+    {
+        var memory = new Memory();
+        var random = new Random(1234);
+        var incrementalBuffer = ZxDisplay.CreateScreenBuffer();
+        for (var frame = 0; frame < 20; frame++)
+        {
+            // Scatter writes over the bitmap and attributes, with the occasional block copy.
+            for (var i = 0; i < 200; i++)
+                memory.Poke((ushort)(ZxDisplay.ScreenBase + random.Next(0x1B00)), (byte)random.Next(256));
+            if (frame % 5 == 0)
+                memory.CopyBlock(0x0000, (ushort)(ZxDisplay.ScreenBase + random.Next(0x1A00)), 0x100, true);
+
+            var borderAttr = (byte)(frame / 4);
+            var unused = false;
+            for (var i = 0; i < ScanlineCount; i++)
+                ZxDisplay.RenderScanlineIntoBuffer(memory, i, incrementalBuffer, borderAttr, false, true, ref unused);
+
+            var fullBuffer = ZxDisplay.CreateScreenBuffer();
+            for (var i = 0; i < ScanlineCount; i++)
+                ZxDisplay.RenderScanlineIntoBuffer(memory, i, fullBuffer, borderAttr, false, false, ref unused);
+            Assert.That(incrementalBuffer, Is.EqualTo(fullBuffer), $"Frame {frame}");
+        }
+    }
+
+    [Test]
+    public void CheckCellsAreDecodedPixelByPixel([Values(false, true)] bool isFlashing)
+    {
+        var memory = new Memory();
+        var random = new Random(1234);
+        for (var i = 0; i < 0x1B00; i++)
+            memory.Poke((ushort)(ZxDisplay.ScreenBase + i), (byte)random.Next(256));
+
+        var screenBuffer = ZxDisplay.CreateScreenBuffer();
+        var unused = false;
+        for (var i = 0; i < ScanlineCount; i++)
+            ZxDisplay.RenderScanlineIntoBuffer(memory, i, screenBuffer, 0x02, isFlashing, false, ref unused);
+
+        for (var y = 0; y < 192; y++)
+        {
+            var bitmapAddr = ZxDisplay.ScreenBase | (y & 0xC0) << 5 | (y & 0x07) << 8 | (y & 0x38) << 2;
+            for (var x = 0; x < 256; x++)
+            {
+                var isSet = (memory.Peek((ushort)(bitmapAddr + x / 8)) & 0x80 >> (x % 8)) != 0;
+                var attr = memory.Peek((ushort)(0x5800 + y / 8 * 32 + x / 8));
+                if (isFlashing && (attr & 0x80) != 0)
+                    isSet = !isSet;
+                var expected = (isSet ? attr & 0x07 : attr >> 3 & 0x07) + ((attr & 0x40) != 0 ? 8 : 0);
+                Assert.That(screenBuffer[(y + 24) * ZxDisplay.ScreenWidth + x + 32], Is.EqualTo(expected), $"({x}, {y})");
+            }
+        }
+    }
+
+    [Test]
+    public void CheckStaticScreenIsNotRedrawn()
+    {
+        var memory = new Memory();
+        memory.Poke(0x5800, 0x38); // Black ink on white paper.
+        var screenBuffer = ZxDisplay.CreateScreenBuffer();
+
+        var didPixelsChange = false;
+        for (var i = 0; i < ScanlineCount; i++)
+            ZxDisplay.RenderScanlineIntoBuffer(memory, i, screenBuffer, 0x00, false, true, ref didPixelsChange);
+        Assert.That(didPixelsChange, Is.True);
+
+        // Writing the same value marks the cell, but leaves the pixels alone.
+        memory.Poke(0x5800, 0x38);
+        didPixelsChange = false;
+        for (var i = 0; i < ScanlineCount; i++)
+            ZxDisplay.RenderScanlineIntoBuffer(memory, i, screenBuffer, 0x00, false, true, ref didPixelsChange);
+        Assert.That(didPixelsChange, Is.False);
+
+        for (var line = 0; line < 192; line++)
+            Assert.That(memory.TakeDirtyDisplayColumns(line), Is.Zero);
+    }
+
+    [Test]
+    public void CheckDisplayWritesMarkTheirCells()
+    {
+        var memory = new Memory();
+        for (var line = 0; line < 192; line++)
+            memory.TakeDirtyDisplayColumns(line);
+
+        // Line 65 (0x4000 + 01 001 000 00011), column 3.
+        memory.Poke(0x4903, 0x01);
+        Assert.That(memory.TakeDirtyDisplayColumns(65), Is.EqualTo(1u << 3));
+
+        // An attribute covers all eight lines of its cell.
+        memory.Poke(0x5800 + 32 + 31, 0x38);
+        for (var line = 8; line < 16; line++)
+            Assert.That(memory.TakeDirtyDisplayColumns(line), Is.EqualTo(1u << 31));
+        Assert.That(memory.TakeDirtyDisplayColumns(16), Is.Zero);
+    }
+
+    [Test]
+    public void CheckCrtShaderMatchesPerPixelShading()
+    {
+        const int width = 64;
+        const int height = 3;
+        const int stride = width * 3 * 4 + 16;
+        var random = new Random(1234);
+        var palette = Enumerable.Range(0, 16).Select(_ => new Vector3(random.Next(256), random.Next(256), random.Next(256))).ToArray();
+        var grain = Enumerable.Range(0, height).Select(_ => Enumerable.Range(0, width).Select(_ => (float)random.NextDouble() * 10.0f).ToArray()).ToArray();
+        var rows = Enumerable.Range(0, height).Select(_ => Enumerable.Range(0, width).Select(_ => (byte)random.Next(16)).ToArray()).ToArray();
+        var saturation = new Vector3(1.1f, 1.0f, 1.1f);
+        var scanline = new Vector3(0.7f);
+
+        var shader = new CrtShader(palette, grain, width, true, 1.5f, saturation, 0.5f, scanline);
+        var actual = new byte[stride * height * 4];
+        for (var y = 0; y < height; y++)
+            shader.RenderRow(rows[y], y, actual, stride);
+
+        var expected = new byte[actual.Length];
+        for (var y = 0; y < height; y++)
+        {
+            for (var x = 0; x < width; x++)
+            {
+                var uvX = (double)x / width;
+                var uvY = (double)y / height;
+                var vignette = (float)(0.7 + 0.3 * Math.Sqrt(64.0 * uvX * uvY * (1.0 - uvX) * (1.0 - uvY)));
+                var color = (palette[rows[y][x]] + new Vector3(grain[y][x])) * (1.5f * vignette * saturation);
+                FrameBuffer.SetPixelV4(expected, stride, x * 3, y * 4, color * new Vector3(1.0f, 0.5f, 0.5f), scanline);
+                FrameBuffer.SetPixelV4(expected, stride, x * 3 + 1, y * 4, color * new Vector3(0.5f, 1.0f, 0.5f), scanline);
+                FrameBuffer.SetPixelV4(expected, stride, x * 3 + 2, y * 4, color * new Vector3(0.5f, 0.5f, 1.0f), scanline);
+            }
+        }
+
+        Assert.That(actual, Is.EqualTo(expected));
+    }
+
+    [Test]
+    public void CheckBorderWritesAreDrawnWhereTheBeamWas()
+    {
+        var now = 0L;
+        var events = new UlaEventLog(() => now, 0x01);
+        var screenBuffer = ZxDisplay.CreateScreenBuffer();
+
+        // Change the border 20 T-states into a top border scanline.
+        const int scanline = 46;
+        now = scanline * 224 + 20 - 8; // OUT writes its port 8 T-states in.
+        events.AddBorderWrite(0x02);
+
+        now = (scanline + 1) * 224;
+        var unused = false;
+        ZxDisplay.RenderScanlineWithEvents(new Memory(), scanline, events, screenBuffer, false, ref unused);
+
+        var row = screenBuffer.AsSpan((scanline - 40) * ZxDisplay.ScreenWidth, ZxDisplay.ScreenWidth).ToArray();
+        Assert.That(row.Take(32 + 20 * 2), Is.All.EqualTo(1));
+        Assert.That(row.Skip(32 + 20 * 2), Is.All.EqualTo(2));
+    }
+
+    [Test]
+    public void CheckAttributesWrittenAfterTheBeamAreDrawnNextFrame()
+    {
+        var now = 0L;
+        var events = new UlaEventLog(() => now, 0x00);
+        var memory = new Memory { UlaEvents = events };
+        memory.Poke(0x5800, 0x38); // White paper.
+        memory.Poke(0x5805, 0x38);
+        var screenBuffer = ZxDisplay.CreateScreenBuffer();
+
+        // Make both cells red, after the beam has passed column 0 but before it reaches column 5.
+        const int scanline = 64; // The top line of the display.
+        now = scanline * 224 + 10;
+        memory.Poke(0x5800, 0x10);
+        memory.Poke(0x5805, 0x10);
+
+        now = (scanline + 1) * 224;
+        var unused = false;
+        ZxDisplay.RenderScanlineWithEvents(memory, scanline, events, screenBuffer, false, ref unused);
+        var rowStart = 24 * ZxDisplay.ScreenWidth + 32;
+        Assert.That(screenBuffer[rowStart], Is.EqualTo(7));
+        Assert.That(screenBuffer[rowStart + 5 * 8], Is.EqualTo(2));
+
+        now += CPU.TStatesPerInterrupt;
+        ZxDisplay.RenderScanlineWithEvents(memory, scanline, events, screenBuffer, false, ref unused);
+        Assert.That(screenBuffer[rowStart], Is.EqualTo(2));
+    }
+
+    [Test]
+    public void CheckDisplayWritesAreLoggedWhenTheyHappen()
+    {
+        var expected = GetDisplayWriteTimes(cpu => cpu.Step(), false);
+        Assert.That(expected.Count, Is.EqualTo(19));
+        Assert.That(GetDisplayWriteTimes(cpu => cpu.StepToNextEvent(), false), Is.EqualTo(expected), "Bulk LDIR");
+        Assert.That(GetDisplayWriteTimes(cpu => cpu.StepToNextEvent(), true), Is.EqualTo(expected), "JIT");
+    }
+
+    private static List<(long TStates, ushort Offset)> GetDisplayWriteTimes(Action<CPU> step, bool useJit)
+    {
+        var cpu = new CPU(new Memory()) { UseJit = useJit };
+        var events = new UlaEventLog(() => cpu.TStatesSinceCpuStart, 0x00);
+        cpu.MainMemory.UlaEvents = events;
+
+        // LD HL,4000h, LD A,FFh, LD (HL),A, INC HL, LD (HL),A, INC HL, LD (HL),A,
+        // LD HL,5000h, LD DE,4100h, LD BC,0010h, LDIR, HALT
+        cpu.MainMemory.LoadData(new byte[] { 0x21, 0x00, 0x40, 0x3E, 0xFF, 0x77, 0x23, 0x77, 0x23, 0x77, 0x21, 0x00, 0x50, 0x11, 0x00, 0x41, 0x01, 0x10, 0x00, 0xED, 0xB0, 0x76 }, 0x8000);
+        cpu.TheRegisters.PC = 0x8000;
+        while (!cpu.IsHalted)
+            step(cpu);
+
+        return Enumerable.Range(0, events.Count).Select(i => (events[i].TStates, events[i].Offset)).ToList();
+    }
+}
@@ -35,13 +35,25 @@ public class FuseTests : TestsBase
     }
 
     [Test, Sequential, Parallelizable(ParallelScope.All)]
-    public void TestRunner([ValueSource(nameof(TheTests))] FuseTest fuseTest)
+    public void TestRunner([ValueSource(nameof(TheTests))] FuseTest fuseTest) =>
+        RunTest(fuseTest, lazyFlags: true);
+
+    [Test, Sequential, Parallelizable(ParallelScope.All)]
+    public void TestRunnerWithEagerFlags([ValueSource(nameof(TheTests))] FuseTest fuseTest) =>
+        RunTest(fuseTest, lazyFlags: false);
+
+    [Test, Sequential, Parallelizable(ParallelScope.All)]
+    public void TestRunnerWithJit([ValueSource(nameof(TheTests))] FuseTest fuseTest) =>
+        RunTest(fuseTest, lazyFlags: true, useJit: true);
+
+    private void RunTest(FuseTest fuseTest, bool lazyFlags, bool useJit = false)
     {
         var fuseResult = TheResults.First(o => o.TestId == fuseTest.TestId);
 
-        var cpu = new CPU(new Memory(), m_portHandler);
+        var cpu = new CPU(new Memory(), m_portHandler) { LazyFlags = lazyFlags, UseJit = useJit };
         fuseTest.InitCpu(cpu);
-        Assert.That(fuseTest.Run(cpu, fuseResult.ExpectedPC), Is.True, "Test timed-out.");
+        var didComplete = useJit ? fuseTest.RunToTStates(cpu, fuseResult.ExpectedTStates) : fuseTest.Run(cpu, fuseResult.ExpectedPC);
+        Assert.That(didComplete, Is.True, "Test timed-out.");
 
         fuseResult.Verify(cpu);
     }
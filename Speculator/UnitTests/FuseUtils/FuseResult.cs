@@ -28,6 +28,8 @@ public class FuseResult
 
     public ushort ExpectedPC => m_registers[11];
 
+    public ushort ExpectedTStates => m_tStates;
+
     public FuseResult(string testId, string registers, string state, string memory)
     {
         m_registers = registers.Split(' ', StringSplitOptions.RemoveEmptyEntries).Select(o => Convert.ToUInt16(o, 16)).ToArray();
@@ -84,4 +84,16 @@ public class FuseTest
 
         return ticks < 65536;
     }
+
+    /// <summary>
+    /// Run the test until the given T-state is reached, allowing compiled blocks to run.
+    /// </summary>
+    public bool RunToTStates(CPU cpu, long tStates)
+    {
+        var steps = 0;
+        while (cpu.TStatesSinceCpuStart < tStates && steps++ < 65536)
+            cpu.StepToNextEvent(tStates);
+
+        return steps < 65536;
+    }
 }
\ No newline at end of file
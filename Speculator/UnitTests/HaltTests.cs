@@ -0,0 +1,69 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+
+
+using CSharp.Core;
+using CSharp.Core.Extensions;
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+
+namespace UnitTests;
+
+[TestFixture]
+public class HaltTests : TestsBase
+{
+    private const ushort ProgramAddr = 0x8000;
+
+    [Test]
+    public void CheckHaltFastForwardMatchesSingleStepping([Values(true, false)] bool interruptsEnabled)
+    {
+        var stepped = CreateCpu(interruptsEnabled, out var steppedScanlines);
+        var batched = CreateCpu(interruptsEnabled, out var batchedScanlines);
+
+        // Stop part way through a frame, to check an external stop is honoured while halted.
+        const long endTStates = CPU.TStatesPerInterrupt * 3 + 1000;
+        while (stepped.TStatesSinceCpuStart < endTStates)
+            stepped.Step();
+        while (batched.TStatesSinceCpuStart < endTStates)
+            batched.StepToNextEvent(endTStates);
+
+        Assert.That(batched.TStatesSinceCpuStart, Is.EqualTo(stepped.TStatesSinceCpuStart), "T-states");
+        Assert.That(batched.TheRegisters.PC, Is.EqualTo(stepped.TheRegisters.PC), "PC");
+        Assert.That(batched.TheRegisters.R, Is.EqualTo(stepped.TheRegisters.R), "R");
+        Assert.That(batched.TheRegisters.SP, Is.EqualTo(stepped.TheRegisters.SP), "SP");
+        Assert.That(batched.IsHalted, Is.EqualTo(stepped.IsHalted), "Halted");
+        Assert.That(batchedScanlines, Is.EqualTo(steppedScanlines), "Rendered scanlines");
+    }
+
+    private static CPU CreateCpu(bool interruptsEnabled, out List<int> renderedScanlines)
+    {
+        var cpu = new CPU(new Memory(), null);
+
+        // The interrupt handler re-enables interrupts and returns to the HALT loop.
+        var romData = new byte[0x4000];
+        romData[0x38] = 0xFB; // EI
+        romData[0x39] = 0xC9; // RET
+        using (var rom = new TempFile(".rom").WriteAllBytes(romData))
+            cpu.MainMemory.LoadRom(rom);
+
+        // IM 1, EI/DI, HALT, JR -3
+        cpu.MainMemory.LoadData(new byte[] { 0xED, 0x56, (byte)(interruptsEnabled ? 0xFB : 0xF3), 0x76, 0x18, 0xFD }, ProgramAddr);
+        cpu.TheRegisters.PC = ProgramAddr;
+        cpu.TheRegisters.SP = 0xFF00;
+
+        var scanlines = new List<int>();
+        cpu.RenderScanline += (_, args) => scanlines.Add(args.Item2);
+        renderedScanlines = scanlines;
+        return cpu;
+    }
+}
@@ -0,0 +1,165 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using CSharp.Core;
+using CSharp.Core.Extensions;
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+using Speculator.Core.Tape;
+
+namespace UnitTests;
+
+[TestFixture]
+public class MemoryPagingTests : TestsBase
+{
+    [Test]
+    public void CheckPagingPortMapsBankAtTopOfMemory()
+    {
+        var memory = CreateMemory(is128K: true);
+        memory.Poke(0xC000, 0x10);
+        memory.Poke(0x8000, 0x22);
+
+        memory.WritePagingPort(0x03);
+        Assert.That(memory.Peek(0xC000), Is.EqualTo(0x00));
+        memory.Poke(0xC000, 0x13);
+        Assert.That(memory.Peek(0x8000), Is.EqualTo(0x22), "Bank 2 is always at 0x8000.");
+
+        memory.WritePagingPort(0x00);
+        Assert.That(memory.Peek(0xC000), Is.EqualTo(0x10));
+        Assert.That(memory.GetBank(3)[0], Is.EqualTo(0x13));
+    }
+
+    [Test]
+    public void CheckAliasedBanksShareMemory()
+    {
+        var memory = CreateMemory(is128K: true);
+        memory.WritePagingPort(0x05);
+        memory.Poke(0xC123, 0x55);
+        Assert.That(memory.Peek(0x4123), Is.EqualTo(0x55));
+    }
+
+    [Test]
+    public void CheckRomAndScreenSelection()
+    {
+        var memory = CreateMemory(is128K: true);
+        Assert.That(memory.Peek(0x0000), Is.EqualTo(0xA0));
+
+        memory.WritePagingPort(0x18);
+        Assert.That(memory.Peek(0x0000), Is.EqualTo(0xA1));
+        Assert.That(memory.Poke(0x0000, 0x00), Is.EqualTo(0xA1), "ROM is read-only.");
+
+        memory.LoadBank(7, new byte[] { 0x77 });
+        Assert.That(memory.ScreenBank[0], Is.EqualTo(0x77));
+    }
+
+    [Test]
+    public void CheckPagingLock()
+    {
+        var memory = CreateMemory(is128K: true);
+        memory.WritePagingPort(0x21);
+        memory.WritePagingPort(0x04);
+        Assert.That(memory.PagingState, Is.EqualTo(0x21));
+
+        memory.ResetPaging();
+        memory.WritePagingPort(0x04);
+        Assert.That(memory.PagingState, Is.EqualTo(0x04));
+    }
+
+    [Test]
+    public void CheckPagingIsIgnoredWith48KRom()
+    {
+        var memory = CreateMemory(is128K: false);
+        memory.Poke(0xC000, 0x10);
+        memory.WritePagingPort(0x03);
+        Assert.That(memory.Peek(0xC000), Is.EqualTo(0x10));
+    }
+
+    [Test]
+    public void CheckPagedCodeIsExecuted([Values(false, true)] bool useJit)
+    {
+        var memory = CreateMemory(is128K: true);
+        var cpu = new CPU(memory, new HeadlessPortHandler(new TapeLoader(), memory)) { UseJit = useJit };
+
+        // Bank 0: LD A,1, LD E,A, LD L,A, RET
+        // Bank 1: LD A,2, LD E,A, LD L,A, RET
+        memory.LoadBank(0, new byte[] { 0x3E, 0x01, 0x5F, 0x6F, 0xC9 });
+        memory.LoadBank(1, new byte[] { 0x3E, 0x02, 0x5F, 0x6F, 0xC9 });
+
+        // DI, CALL C000h, LD D,A, LD BC,7FFDh, LD A,1, OUT (C),A, CALL C000h, HALT
+        memory.LoadData(new byte[] { 0xF3, 0xCD, 0x00, 0xC0, 0x57, 0x01, 0xFD, 0x7F, 0x3E, 0x01, 0xED, 0x79, 0xCD, 0x00, 0xC0, 0x76 }, 0x8000);
+        cpu.TheRegisters.PC = 0x8000;
+        cpu.TheRegisters.SP = 0xBF00;
+
+        while (!cpu.IsHalted)
+        {
+            if (useJit)
+                cpu.StepBlock();
+            else
+                cpu.Step();
+        }
+
+        Assert.That(cpu.TheRegisters.Main.D, Is.EqualTo(0x01), "Bank 0");
+        Assert.That(cpu.TheRegisters.Main.A, Is.EqualTo(0x02), "Bank 1");
+    }
+
+    [Test]
+    public void CheckWritesToDecodedCodeAreSeen([Values(false, true)] bool is128K)
+    {
+        // LD A,1 - Decoding it is the first access to the slot.
+        var memory = CreateMemory(is128K);
+        var cpu = new CPU(memory);
+        memory.LoadData(new byte[] { 0x3E, 0x01 }, 0xC000);
+        cpu.TheRegisters.PC = 0xC000;
+        cpu.Step();
+        Assert.That(cpu.TheRegisters.Main.A, Is.EqualTo(0x01));
+
+        memory.Poke(0xC001, 0x02);
+        cpu.TheRegisters.PC = 0xC000;
+        cpu.Step();
+        Assert.That(cpu.TheRegisters.Main.A, Is.EqualTo(0x02));
+    }
+
+    [Test]
+    public void CheckSnaRoundTripsAllBanks()
+    {
+        var cpu = new CPU(CreateMemory(is128K: true));
+        for (var bank = 0; bank < 8; bank++)
+            cpu.MainMemory.LoadBank(bank, Enumerable.Repeat((byte)(0x10 + bank), Memory.PageSize).ToArray());
+        cpu.MainMemory.WritePagingPort(0x1B);
+        cpu.TheRegisters.PC = 0x1234;
+
+        using var stream = new MemoryStream();
+        new ZxFileIo(cpu, null, new TapeLoader()).WriteSnaToStream(stream);
+        using var sna = new TempFile(".sna").WriteAllBytes(stream.ToArray());
+
+        var loaded = new CPU(CreateMemory(is128K: true));
+        ZxFileIo.LoadSna(sna, loaded, out _);
+        Assert.That(loaded.TheRegisters.PC, Is.EqualTo(0x1234));
+        Assert.That(loaded.MainMemory.PagingState, Is.EqualTo(0x1B));
+        for (var bank = 0; bank < 8; bank++)
+            Assert.That(loaded.MainMemory.GetBank(bank).ToArray(), Is.EqualTo(cpu.MainMemory.GetBank(bank).ToArray()), $"Bank {bank}");
+    }
+
+    private static Memory CreateMemory(bool is128K)
+    {
+        // Mark the first byte of each ROM.
+        var romData = new byte[is128K ? 0x8000 : 0x4000];
+        romData[0x0000] = 0xA0;
+        if (is128K)
+            romData[0x4000] = 0xA1;
+
+        var memory = new Memory();
+        using (var rom = new TempFile(".rom").WriteAllBytes(romData))
+            memory.LoadRom(rom);
+        return memory;
+    }
+}
@@ -0,0 +1,126 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using CSharp.Core;
+using CSharp.Core.Extensions;
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+
+namespace UnitTests;
+
+[TestFixture]
+public class ProfilerTests : TestsBase
+{
+    private const ushort ProgramAddr = 0x8000;
+
+    [Test]
+    public void CheckCallGraphIsInferredFromCallsAndReturns()
+    {
+        var cpu = CreateCpu();
+
+        // DI, CALL 9000h, JR -5
+        cpu.MainMemory.LoadData(new byte[] { 0xF3, 0xCD, 0x00, 0x90, 0x18, 0xFB }, ProgramAddr);
+
+        // CALL A000h, RET
+        cpu.MainMemory.LoadData(new byte[] { 0xCD, 0x00, 0xA0, 0xC9 }, 0x9000);
+
+        // NOP, RET
+        cpu.MainMemory.LoadData(new byte[] { 0x00, 0xC9 }, 0xA000);
+
+        cpu.IsProfiling = true;
+        const int loopCount = 100;
+        for (var i = 0; i < 1 + loopCount * 6; i++)
+            cpu.StepToNextEvent();
+        cpu.IsProfiling = false;
+
+        var profiler = cpu.Profiler;
+        Assert.That(GetFoldedStacks(cpu), Is.EqualTo(new[]
+        {
+            $"root {4 + loopCount * (17 + 12)}",
+            $"root;9000 {loopCount * (17 + 10)}",
+            $"root;9000;A000 {loopCount * (4 + 10)}"
+        }));
+        Assert.That(profiler.TotalTStates, Is.EqualTo(cpu.TStatesSinceCpuStart));
+        Assert.That(profiler.HitCounts[0xA000], Is.EqualTo(loopCount));
+        Assert.That(profiler.TStates[0x9000], Is.EqualTo(loopCount * 17));
+
+        var hotList = profiler.GetHotList();
+        Assert.That(hotList, Does.Contain("9000"));
+        Assert.That(hotList, Does.Contain("NOP"));
+    }
+
+    [Test]
+    public void CheckInterruptsAreProfiledAsCalls()
+    {
+        var cpu = CreateCpu();
+
+        // IM 1, EI, HALT, JR -3
+        cpu.MainMemory.LoadData(new byte[] { 0xED, 0x56, 0xFB, 0x76, 0x18, 0xFD }, ProgramAddr);
+
+        cpu.IsProfiling = true;
+        while (cpu.TStatesSinceCpuStart < CPU.TStatesPerInterrupt * 3)
+            cpu.StepToNextEvent();
+
+        var foldedStacks = GetFoldedStacks(cpu);
+        Assert.That(foldedStacks.Length, Is.EqualTo(2));
+        Assert.That(foldedStacks[1].StartsWith("root;0038 "), Is.True);
+        Assert.That(cpu.Profiler.TotalTStates, Is.EqualTo(cpu.TStatesSinceCpuStart));
+    }
+
+    [Test]
+    public void CheckProfilingCanBeSwitchedWhileRunning()
+    {
+        var cpu = CreateCpu();
+
+        // INC A, JR -3
+        cpu.MainMemory.LoadData(new byte[] { 0x3C, 0x18, 0xFD }, ProgramAddr);
+
+        using var cancellation = new CancellationTokenSource(TimeSpan.FromSeconds(2));
+        var toggler = Task.Run(() =>
+        {
+            while (!cancellation.IsCancellationRequested)
+                cpu.IsProfiling = !cpu.IsProfiling;
+        });
+
+        while (!cancellation.IsCancellationRequested)
+        {
+            lock (cpu.CpuStepLock)
+                cpu.StepToNextEvent();
+        }
+
+        toggler.Wait();
+        Assert.That(cpu.TheRegisters.PC is ProgramAddr or ProgramAddr + 1, Is.True);
+    }
+
+    private static CPU CreateCpu()
+    {
+        var cpu = new CPU(new Memory(), null);
+
+        // The interrupt handler re-enables interrupts and returns.
+        var romData = new byte[0x4000];
+        romData[0x38] = 0xFB; // EI
+        romData[0x39] = 0xC9; // RET
+        using (var rom = new TempFile(".rom").WriteAllBytes(romData))
+            cpu.MainMemory.LoadRom(rom);
+
+        cpu.TheRegisters.PC = ProgramAddr;
+        cpu.TheRegisters.SP = 0xFF00;
+        return cpu;
+    }
+
+    private static string[] GetFoldedStacks(CPU cpu)
+    {
+        using var writer = new StringWriter();
+        cpu.Profiler.WriteFoldedStacks(writer);
+        return writer.ToString().Split(Environment.NewLine, StringSplitOptions.RemoveEmptyEntries);
+    }
+}
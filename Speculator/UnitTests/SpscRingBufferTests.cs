@@ -0,0 +1,70 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core.Utils;
+
+namespace UnitTests;
+
+[TestFixture]
+public class SpscRingBufferTests : TestsBase
+{
+    [Test]
+    public void CheckItemsWrapAroundAndRunsAreCounted()
+    {
+        var buffer = new SpscRingBuffer<int>(4);
+        Assert.That(buffer.Write(new[] { 1, 2, 3 }), Is.EqualTo(3));
+
+        var items = new int[2];
+        Assert.That(buffer.Read(items), Is.EqualTo(2));
+        Assert.That(items, Is.EqualTo(new[] { 1, 2 }));
+
+        // Crosses the end of the storage, then overflows it.
+        Assert.That(buffer.Write(new[] { 4, 5, 6, 7 }), Is.EqualTo(3));
+        Assert.That(buffer.OverrunCount, Is.EqualTo(1));
+        Assert.That(buffer.Count, Is.EqualTo(4));
+
+        items = new int[5];
+        Assert.That(buffer.Read(items), Is.EqualTo(4));
+        Assert.That(items, Is.EqualTo(new[] { 3, 4, 5, 6, 0 }));
+        Assert.That(buffer.UnderrunCount, Is.EqualTo(1));
+    }
+
+    [Test]
+    public void CheckItemsArriveInOrderAcrossThreads()
+    {
+        const int itemCount = 1000000;
+        var buffer = new SpscRingBuffer<int>(256);
+        var producer = Task.Run(() =>
+        {
+            var batch = new int[7];
+            for (var next = 0; next < itemCount;)
+            {
+                var count = Math.Min(batch.Length, itemCount - next);
+                for (var i = 0; i < count; i++)
+                    batch[i] = next + i;
+                next += buffer.Write(batch.AsSpan(0, count));
+            }
+        });
+
+        var items = new int[13];
+        var expected = 0;
+        while (expected < itemCount)
+        {
+            var count = buffer.Read(items);
+            for (var i = 0; i < count; i++)
+                Assert.That(items[i], Is.EqualTo(expected++));
+        }
+
+        producer.Wait();
+    }
+}
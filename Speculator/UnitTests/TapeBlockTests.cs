@@ -0,0 +1,77 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core.Tape;
+
+namespace UnitTests;
+
+[TestFixture]
+public class TapeBlockTests : TestsBase
+{
+    private const long StartTStates = 1000;
+
+    [Test]
+    public void CheckBlockDecodesFromPulseLengths()
+    {
+        var blockBytes = new byte[100];
+        new Random(1234).NextBytes(blockBytes);
+        var block = new TapeBlock(blockBytes, 0, blockBytes.Length).Start(StartTStates);
+
+        // Measure the length of each pulse (Each level starts on the T-state after its boundary).
+        var pulses = new List<int>();
+        var level = block.GetSignal(StartTStates + 1);
+        var pulseStart = StartTStates + 1;
+        for (var t = pulseStart + 1; level.HasValue; t++)
+        {
+            var newLevel = block.GetSignal(t);
+            if (newLevel == level)
+                continue;
+            pulses.Add((int)(t - pulseStart));
+            level = newLevel;
+            pulseStart = t;
+        }
+
+        // Pilot and sync.
+        Assert.That(pulses.Take(3224), Is.All.EqualTo(2168));
+        Assert.That(pulses.Skip(3224).Take(2), Is.EqualTo(new[] { 667, 735 }));
+
+        // Data, as pairs of equal pulses, ending the block.
+        var bits = pulses.Skip(3226).Take(blockBytes.Length * 16).ToArray();
+        var decoded = new byte[blockBytes.Length];
+        for (var i = 0; i < bits.Length; i += 2)
+        {
+            Assert.That(bits[i], Is.EqualTo(bits[i + 1]));
+            if (bits[i] == 1710)
+                decoded[i / 16] |= (byte)(0x80 >> (i / 2 % 8));
+        }
+
+        Assert.That(decoded, Is.EqualTo(blockBytes));
+        Assert.That(pulses.Skip(3226 + bits.Length), Is.Empty);
+    }
+
+    [Test]
+    public void CheckSignalIsIndependentOfQueryOrder()
+    {
+        var blockBytes = new byte[64];
+        var random = new Random(1234);
+        random.NextBytes(blockBytes);
+        var times = Enumerable.Range(0, 2000).Select(_ => StartTStates + random.NextInt64(8_000_000)).ToArray();
+
+        var forwards = new TapeBlock(blockBytes, 0, blockBytes.Length).Start(StartTStates);
+        var expected = times.Distinct().Order().ToDictionary(o => o, o => forwards.GetSignal(o));
+
+        var shuffled = new TapeBlock(blockBytes, 0, blockBytes.Length).Start(StartTStates);
+        foreach (var t in times)
+            Assert.That(shuffled.GetSignal(t), Is.EqualTo(expected[t]));
+    }
+}
@@ -0,0 +1,105 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using CSharp.Core;
+using CSharp.Core.Extensions;
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core;
+
+namespace UnitTests;
+
+[TestFixture]
+public class TapeLoaderTests : TestsBase
+{
+    private static readonly byte[] DataBlock = { 0x05, 0x00, 0xFF, 0x01, 0x02, 0x03, 0xFF };
+    private static readonly byte[] HeaderBlock = { 0x03, 0x00, 0x00, 0x42, 0x42 };
+
+    [Test]
+    public void CheckBlockIsFlashLoaded()
+    {
+        var machine = RunLoader(DataBlock, isTapeInsertedLate: false);
+
+        AssertBlockLoaded(machine);
+    }
+
+    [Test]
+    public void CheckBlockWithOtherFlagIsSkipped()
+    {
+        var machine = RunLoader(HeaderBlock.Concat(DataBlock).ToArray(), isTapeInsertedLate: false);
+
+        AssertBlockLoaded(machine);
+    }
+
+    [Test]
+    public void CheckBlockIsFlashLoadedWhenRomIsAlreadyWaiting()
+    {
+        var machine = RunLoader(DataBlock, isTapeInsertedLate: true);
+
+        AssertBlockLoaded(machine);
+    }
+
+    /// <summary>
+    /// Run a program calling LD-BYTES until it loads 3 bytes of data (Flag $FF) to $9000.
+    /// </summary>
+    /// <remarks>
+    /// The ROM's LD-BYTES is replaced by just its set-up, then the wait at LD-BREAK.
+    /// </remarks>
+    private static HeadlessZxSpectrum RunLoader(byte[] tapeBytes, bool isTapeInsertedLate)
+    {
+        var romData = new byte[0x4000];
+        new byte[]
+        {
+            0x31, 0x00, 0x80,       // LD SP,$8000
+            0xDD, 0x21, 0x00, 0x90, // LD IX,$9000
+            0x11, 0x03, 0x00,       // LD DE,3
+            0x3E, 0xFF,             // LD A,$FF
+            0x37,                   // SCF
+            0xCD, 0x56, 0x05,       // CALL LD-BYTES
+            0x30, 0xF1,             // JR NC,$-13
+            0x18, 0xFE              // JR $
+        }.CopyTo(romData, 0);
+        romData[0x053F] = 0xC9; // SA/LD-RET: RET
+        new byte[]
+        {
+            0x08,             // LD-BYTES: EX AF,AF'
+            0x21, 0x3F, 0x05, // LD HL,SA/LD-RET
+            0xE5              // PUSH HL
+        }.CopyTo(romData, 0x0556);
+        new byte[] { 0x18, 0xFE }.CopyTo(romData, 0x056B); // LD-BREAK: JR $
+        romData[0x1540] = 0x53; // Sinclair ROM signature.
+
+        using var rom = new TempFile(".rom").WriteAllBytes(romData);
+        using var tape = new TempFile(".tap").WriteAllBytes(tapeBytes);
+        var machine = new HeadlessZxSpectrum(rom) { TheTapeLoader = { IsFlashLoadEnabled = true } };
+        if (isTapeInsertedLate)
+        {
+            machine.RunFrames(1);
+            Assert.That(machine.TheCpu.TheRegisters.PC, Is.EqualTo(0x056B));
+        }
+
+        machine.TheTapeLoader.Load(tape);
+        machine.RunFrames(1);
+        return machine;
+    }
+
+    private static void AssertBlockLoaded(HeadlessZxSpectrum machine)
+    {
+        var registers = machine.TheCpu.TheRegisters;
+        Assert.That(registers.PC, Is.EqualTo(0x0012));
+        Assert.That(registers.SP, Is.EqualTo(0x8000));
+        Assert.That(registers.CarryFlag, Is.True);
+        Assert.That(registers.IX, Is.EqualTo(0x9003));
+        Assert.That(registers.Main.DE, Is.Zero);
+        Assert.That(Enumerable.Range(0x9000, 3).Select(o => machine.TheCpu.MainMemory.Peek((ushort)o)), Is.EqualTo(new byte[] { 1, 2, 3 }));
+        Assert.That(machine.TheTapeLoader.IsLoading, Is.False);
+    }
+}
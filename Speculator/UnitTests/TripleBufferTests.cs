@@ -0,0 +1,67 @@
+// Code authored by Dean Edis (DeanTheCoder).
+// Anyone is free to copy, modify, use, compile, or distribute this software,
+// either in source code form or as a compiled binary, for any non-commercial
+// purpose.
+//
+// If you modify the code, please retain this copyright header,
+// and consider contributing back to the repository or letting us know
+// about your modifications. Your contributions are valued!
+//
+// THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
+
+using CSharp.Core.UnitTesting;
+using NUnit.Framework;
+using Speculator.Core.Utils;
+
+namespace UnitTests;
+
+[TestFixture]
+public class TripleBufferTests : TestsBase
+{
+    [Test]
+    public void CheckConsumerTakesLatestPublishedBuffer()
+    {
+        var buffer = new TripleBuffer<int[]>(() => new int[1]);
+        Assert.That(buffer.TryTakeLatest(), Is.False);
+
+        buffer.Back[0] = 1;
+        buffer.Publish();
+        buffer.Back[0] = 2;
+        buffer.Publish();
+        Assert.That(buffer.DroppedCount, Is.EqualTo(1));
+
+        Assert.That(buffer.TryTakeLatest(), Is.True);
+        Assert.That(buffer.Front[0], Is.EqualTo(2));
+        Assert.That(buffer.TryTakeLatest(), Is.False);
+        Assert.That(buffer.Front[0], Is.EqualTo(2));
+    }
+
+    [Test]
+    public void CheckBuffersAreNeverShared()
+    {
+        var buffer = new TripleBuffer<int[]>(() => new int[1]);
+        var producer = Task.Run(() =>
+        {
+            for (var i = 1; i <= 100000; i++)
+            {
+                buffer.Back[0] = i;
+                buffer.Publish();
+            }
+        });
+
+        // Each buffer taken must be unchanged while held, and newer than the last.
+        var last = 0;
+        while (last < 100000)
+        {
+            if (!buffer.TryTakeLatest())
+                continue;
+            var value = buffer.Front[0];
+            Assert.That(value, Is.GreaterThan(last));
+            Thread.SpinWait(50);
+            Assert.That(buffer.Front[0], Is.EqualTo(value));
+            last = value;
+        }
+
+        producer.Wait();
+    }
+}
@@ -9,9 +9,11 @@
 //
 // THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND.
 
+using System.Collections.Concurrent;
 using System.Diagnostics;
 using CSharp.Core.Extensions;
 using CSharp.Core.UnitTesting;
+using Newtonsoft.Json;
 using NSubstitute;
 using NUnit.Framework;
 using Speculator.Core;
@@ -22,6 +24,15 @@ namespace UnitTests;
 [TestFixture]
 public class ZexAllTests : TestsBase
 {
+    private const string UnsupportedSnapName = "bit n,[b,c,d,e,h,l,(hl),a].json";
+
+    /// <summary>
+    /// The instructions timed per group by the performance gate (Enough to reach each group's main loop).
+    /// </summary>
+    private const long PerfStepsPerGroup = 2_000_000;
+    private const int PerfRepeats = 3;
+    private const double DefaultPerfThreshold = 0.2;
+
     private static DirectoryInfo SnapshotDir => ProjectDir.GetDir("ZexTestData");
 
     public static IEnumerable<string> SnapshotNames { get; } = SnapshotDir.EnumerateFiles("*.json").Select(o => o.Name);
@@ -35,15 +46,120 @@ public class ZexAllTests : TestsBase
     [Test, Sequential, Parallelizable(ParallelScope.All)]
     public void TestRunner([ValueSource(nameof(SnapshotNames))] string snapName)
     {
-        if (snapName == "bit n,<b,c,d,e,h,l,(hl),a>.json")
+        if (snapName == UnsupportedSnapName)
+            Assert.Ignore("BIT n,(HL) requires WZ register emulation (https://groups.google.com/g/sebhc/c/VwV_-ZAEVhY)");
+        Assert.That(RunZexTest(SnapshotDir.GetFile(snapName)).DidPass, Is.True);
+    }
+
+    [Test, Sequential, Parallelizable(ParallelScope.All)]
+    public void TestRunnerWithJit([ValueSource(nameof(SnapshotNames))] string snapName)
+    {
+        if (snapName == UnsupportedSnapName)
             Assert.Ignore("BIT n,(HL) requires WZ register emulation (https://groups.google.com/g/sebhc/c/VwV_-ZAEVhY)");
-        Assert.That(RunZexTest(SnapshotDir.GetFile(snapName)), Is.True);
+        Assert.That(RunZexTest(SnapshotDir.GetFile(snapName), useJit: true).DidPass, Is.True);
+    }
+
+    /// <summary>
+    /// Time the start of every test group in parallel, failing if the overall throughput (The geometric mean
+    /// across groups) has regressed by more than the baseline's threshold (Default: 0.2, i.e. 20%).
+    /// </summary>
+    /// <remarks>
+    /// The baseline (ZexPerfBaseline.json, alongside this file) records each group's emulated T-states
+    /// relative to a fixed calibration workload run on the same thread straight afterwards, so it holds
+    /// across machines and rides out a busy host.
+    /// The 'ZexPerfThreshold' test parameter overrides the threshold, and setting the 'ZexPerfUpdateBaseline'
+    /// test parameter to true rewrites the baseline from this run.
+    /// </remarks>
+    [Test, NonParallelizable]
+    public void ZexPerformanceGate()
+    {
+        var baselineFile = ProjectDir.GetFile("ZexPerfBaseline.json");
+        var updateBaseline = TestContext.Parameters.Get("ZexPerfUpdateBaseline", false);
+        var baseline = baselineFile.Exists() ? JsonConvert.DeserializeObject<ZexPerfBaseline>(baselineFile.ReadAllText()) : null;
+        if (baseline == null && !updateBaseline)
+            Assert.Fail($"No baseline at {baselineFile.FullName} - Run with ZexPerfUpdateBaseline=true to create one.");
+        var threshold = TestContext.Parameters.Get("ZexPerfThreshold", baseline?.Threshold ?? DefaultPerfThreshold);
+
+        // Warm up every group (So the .NET JIT has optimized the hot paths), then time each one
+        // several times, keeping its best throughput relative to the host.
+        var snapNames = SnapshotNames.Where(o => o != UnsupportedSnapName).OrderBy(o => o).ToArray();
+        var options = new ParallelOptions { MaxDegreeOfParallelism = Environment.ProcessorCount };
+        Parallel.ForEach(snapNames, options, snapName => RunZexTest(SnapshotDir.GetFile(snapName), maxSteps: PerfStepsPerGroup));
+        MeasureHostSpeed();
+
+        var results = new ConcurrentDictionary<string, (ZexRunResult Result, double RelativeThroughput)>();
+        Parallel.ForEach(snapNames, options, snapName =>
+            results[snapName] = Enumerable.Range(0, PerfRepeats)
+                .Select(_ =>
+                {
+                    var result = RunZexTest(SnapshotDir.GetFile(snapName), maxSteps: PerfStepsPerGroup);
+                    return (result, result.TStatesPerSecond / MeasureHostSpeed());
+                })
+                .MaxBy(o => o.Item2));
+
+        var logChangeSum = 0.0;
+        var missing = new List<string>();
+        foreach (var snapName in snapNames)
+        {
+            var (result, relativeThroughput) = results[snapName];
+            var report = $"{snapName,-45} {result.InstructionsPerSecond / 1.0e6,8:F2} MIPS {result.TStatesPerSecond / 1.0e6,8:F2} MHz";
+            if (baseline?.Groups.TryGetValue(snapName, out var baselineThroughput) == true)
+            {
+                var ratio = relativeThroughput / baselineThroughput;
+                report += $" ({ratio - 1.0:+0.0%;-0.0%} vs baseline)";
+                logChangeSum += Math.Log(ratio);
+            }
+            else
+            {
+                report += " (No baseline)";
+                missing.Add(snapName);
+            }
+
+            TestContext.Out.WriteLine(report);
+        }
+
+        if (updateBaseline)
+        {
+            var groups = new SortedDictionary<string, double>(results.ToDictionary(o => o.Key, o => o.Value.RelativeThroughput));
+            baselineFile.WriteAllText(JsonConvert.SerializeObject(new ZexPerfBaseline(baseline?.Threshold ?? DefaultPerfThreshold, groups), Formatting.Indented));
+            TestContext.Out.WriteLine($"Baseline written to {baselineFile.FullName}");
+            return;
+        }
+
+        var change = Math.Exp(logChangeSum / (snapNames.Length - missing.Count)) - 1.0;
+        TestContext.Out.WriteLine($"Overall: {change:+0.0%;-0.0%} vs baseline");
+        Assert.That(missing, Is.Empty, "Groups have no baseline");
+        Assert.That(change, Is.GreaterThanOrEqualTo(-threshold), $"Throughput regressed by more than {threshold:P0}");
+    }
+
+    /// <summary>
+    /// The throughput of a fixed table-driven workload (Similar in shape to instruction dispatch) on this thread.
+    /// </summary>
+    private static double MeasureHostSpeed()
+    {
+        const int Iterations = 5_000_000;
+        var table = new byte[0x10000];
+        var x = 0x12345678u;
+        var checksum = 0;
+        var stopwatch = Stopwatch.StartNew();
+        for (var i = 0; i < Iterations; i++)
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            table[x & 0xFFFF] += (byte)x;
+            checksum += table[x >> 16];
+        }
+
+        GC.KeepAlive(checksum);
+        return Iterations / stopwatch.Elapsed.TotalSeconds;
     }
 
     /// <summary>
     /// Run all, or a single, ZexDoc test.
     /// </summary>
-    private static bool RunZexTest(FileInfo snapshotFile = null)
+    /// <param name="maxSteps">Stop early after this many steps (Without a result).</param>
+    private static ZexRunResult RunZexTest(FileInfo snapshotFile = null, bool useJit = false, long maxSteps = long.MaxValue)
     {
         Assert.That(ProjectDir, Is.Not.Null);
         var zexDocBin = ProjectDir.GetDir("Zex").GetFile("zexall.com");
@@ -58,12 +174,17 @@ public class ZexAllTests : TestsBase
             {
                 PC = 0x0100,
                 SP = 0xF000
-            }
+            },
+            UseJit = useJit
         };
 
         // Load the ZexDoc image.
         cpu.MainMemory.LoadData(zexDocBin.ReadAllBytes(), cpu.TheRegisters.PC);
 
+        // CP/M has no interrupt source, so make the CPU's frame interrupt (RST 38h) return immediately.
+        cpu.MainMemory.Data[0x0038] = 0xFB; // EI
+        cpu.MainMemory.Data[0x0039] = 0xC9; // RET
+
         var baseMemorySnapshot = cpu.MainMemory.Data.ToArray();
         var restoredFromSnapshot = false;
         if (snapshotFile != null)
@@ -79,7 +200,10 @@ public class ZexAllTests : TestsBase
         var testsFinished = false;
         var testName = string.Empty;
         var didPass = false;
-        while (!cpu.IsHalted && !testsFinished)
+        var stepCount = 0L;
+        var startTStates = cpu.TStatesSinceCpuStart;
+        var stopwatch = Stopwatch.StartNew();
+        while (!cpu.IsHalted && !testsFinished && stepCount < maxSteps)
         {
             // Take a snapshot?
             if (makeSnapshotOnConsoleWrite && !restoredFromSnapshot)
@@ -91,7 +215,11 @@ public class ZexAllTests : TestsBase
                 snapFile.WriteAllText(snapshot.AsString());
             }
 
-            cpu.Step();
+            if (useJit)
+                cpu.StepBlock(); // Stops after each CALL, so BDOS calls are still seen.
+            else
+                cpu.Step();
+            stepCount++;
 
             // Console output callback requested?
             if (cpu.TheRegisters.PC != 0x0005)
@@ -144,6 +272,20 @@ public class ZexAllTests : TestsBase
             cpu.TheRegisters.SP += 2;
         }
 
-        return didPass;
+        return new ZexRunResult(didPass, stepCount, cpu.TStatesSinceCpuStart - startTStates, stopwatch.Elapsed);
+    }
+
+    /// <summary>
+    /// The outcome of a ZexDoc run, with the instructions (Or JIT blocks) stepped and the time taken.
+    /// </summary>
+    /// <summary>
+    /// Each group's throughput relative to the host calibration, and the fraction it may drop by.
+    /// </summary>
+    private sealed record ZexPerfBaseline(double Threshold, IDictionary<string, double> Groups);
+
+    private sealed record ZexRunResult(bool DidPass, long StepCount, long TStates, TimeSpan Elapsed)
+    {
+        public double InstructionsPerSecond => StepCount / Elapsed.TotalSeconds;
+        public double TStatesPerSecond => TStates / Elapsed.TotalSeconds;
     }
 }